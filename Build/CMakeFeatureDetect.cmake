@@ -33,6 +33,51 @@ else()
   set(CXX_DO_NOT_OPTIMIZE_SIBLING_CALLS "-fno-optimize-sibling-calls")
 endif()
 
+# Same shape as the threaded dispatch of the interpreter loop (see InterpreterLoop.inl): a table of label
+# addresses filled in by a statement expression, and indirect jumps between case labels of a switch in a
+# function with a destructor to run
+check_cxx_source_runs("
+struct Guard { int * count; ~Guard() { (*count)++; } };
+
+int run(const unsigned char * ip, int * count)
+{
+  Guard guard = { count };
+  static void * table[3];
+  static const bool initialized = ({
+    for (int i = 0; i < 3; i++) { table[i] = &&Switch; }
+    table[1] = &&Increment;
+    true;
+  });
+  (void)initialized;
+  int result = 0;
+  while (true)
+  {
+    unsigned char op = *ip++;
+Switch:
+    switch (op)
+    {
+    case 1: Increment:
+      {
+        result++;
+        op = *ip++;
+        goto *table[op];
+      }
+    default:
+      return result;
+    }
+  }
+}
+
+int main(int argc, char **argv) {
+  const unsigned char code[] = { 1, 2, 1, 1, 0 };
+  int count = 0;
+  return run(code, &count) == 1 && run(code + 2, &count) == 2 && count == 2 ? 0 : 1;
+}" CLANG_HAS_THREADED_DISPATCH_CFG)
+
+if(CLANG_HAS_THREADED_DISPATCH_CFG STREQUAL 1)
+  add_definitions(-DCLANG_HAS_THREADED_DISPATCH=1)
+endif()
+
 if(CMAKE_SYSTEM_NAME STREQUAL Darwin)
     # by default this is disabled for osx
     # disable back
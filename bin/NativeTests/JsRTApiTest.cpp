@@ -5,6 +5,7 @@
 #include "stdafx.h"
 #include "catch.hpp"
 #include <process.h>
+#include <vector>
 
 #pragma warning(disable:4100) // unreferenced formal parameter
 #pragma warning(disable:6387) // suppressing preFAST which raises warning for passing null to the JsRT APIs
@@ -1613,4 +1614,975 @@ namespace JsRTApiTest
     {
         JsRTApiTest::RunWithAttributes(JsRTApiTest::ScriptTerminationTest);
     }
+
+    // Functions are only deferred in scripts longer than the deferral threshold (4K characters)
+    std::string PadForDeferral(const char *script)
+    {
+        return std::string(script) + "\n//" + std::string(5000, '-') + "\n";
+    }
+
+    // The script buffer isn't copied and has to outlive the returned value
+    JsValueRef CreateScriptBuffer(const std::string &script)
+    {
+        JsValueRef scriptBuffer = JS_INVALID_REFERENCE;
+        REQUIRE(JsCreateExternalArrayBuffer((void *)script.c_str(), (unsigned int)script.length(), nullptr, nullptr, &scriptBuffer) == JsNoError);
+        return scriptBuffer;
+    }
+
+    JsValueRef CopyArrayBuffer(JsValueRef arrayBuffer, unsigned int length)
+    {
+        ChakraBytePtr source = nullptr;
+        unsigned int sourceLength = 0;
+        REQUIRE(JsGetArrayBufferStorage(arrayBuffer, &source, &sourceLength) == JsNoError);
+        REQUIRE(length <= sourceLength);
+
+        JsValueRef copy = JS_INVALID_REFERENCE;
+        ChakraBytePtr destination = nullptr;
+        unsigned int destinationLength = 0;
+        REQUIRE(JsCreateArrayBuffer(length, &copy) == JsNoError);
+        REQUIRE(JsGetArrayBufferStorage(copy, &destination, &destinationLength) == JsNoError);
+        memcpy(destination, source, length);
+        return copy;
+    }
+
+    int RunWithParserState(JsValueRef scriptBuffer, JsValueRef parserState)
+    {
+        JsValueRef sourceUrl = JS_INVALID_REFERENCE;
+        JsValueRef result = JS_INVALID_REFERENCE;
+        int value = 0;
+        REQUIRE(JsCreateString("parserState.js", strlen("parserState.js"), &sourceUrl) == JsNoError);
+        REQUIRE(JsRunScriptWithParserState(scriptBuffer, JS_SOURCE_CONTEXT_NONE, sourceUrl, JsParseScriptAttributeNone, parserState, &result) == JsNoError);
+        REQUIRE(JsNumberToInt(result, &value) == JsNoError);
+        return value;
+    }
+
+    void ParserStateTest(JsRuntimeAttributes attributes, JsRuntimeHandle runtime)
+    {
+        // Functions at global scope are deferred and skipped with the parser state, nested ones are deferred
+        // again when their parent is parsed on first call.
+        std::string script = PadForDeferral(
+            "function outer(a) { function inner(b) { return a + b; } return inner(1); }\n"
+            "var arrow = (x) => { return x * 2; };\n"
+            "class C { method() { return 10; } }\n"
+            "(function iife() { function nested() { return 100; } this.nested = nested; })();\n"
+            "outer(1) + arrow(2) + new C().method() + nested();");
+        const int expected = 2 + 4 + 10 + 100;
+
+        JsValueRef scriptBuffer = CreateScriptBuffer(script);
+        JsValueRef parserState = JS_INVALID_REFERENCE;
+        REQUIRE(JsSerializeParserState(scriptBuffer, &parserState, JsParseScriptAttributeNone) == JsNoError);
+
+        JsValueType type;
+        REQUIRE(JsGetValueType(parserState, &type) == JsNoError);
+        CHECK(type == JsArrayBuffer);
+
+        CHECK(RunWithParserState(scriptBuffer, parserState) == expected);
+
+        // The functions that were skipped are parsed in full when they are called later
+        JsValueRef result = JS_INVALID_REFERENCE;
+        int value = 0;
+        REQUIRE(JsRunScript(_u("outer(5) + arrow(5)"), JS_SOURCE_CONTEXT_NONE, _u(""), &result) == JsNoError);
+        REQUIRE(JsNumberToInt(result, &value) == JsNoError);
+        CHECK(value == 16);
+
+        // A state recorded for another source of the same length is ignored
+        std::string otherScript = PadForDeferral(
+            "function outer(a) { function inner(b) { return a - b; } return inner(1); }\n"
+            "var arrow = (x) => { return x * 3; };\n"
+            "class C { method() { return 20; } }\n"
+            "(function iife() { function nested() { return 200; } this.nested = nested; })();\n"
+            "outer(1) + arrow(2) + new C().method() + nested();");
+        REQUIRE(otherScript.length() == script.length());
+        JsValueRef otherScriptBuffer = CreateScriptBuffer(otherScript);
+        CHECK(RunWithParserState(otherScriptBuffer, parserState) == 0 + 6 + 20 + 200);
+    }
+
+    TEST_CASE("ApiTest_ParserStateTest", "[ApiTest]")
+    {
+        JsRTApiTest::RunWithAttributes(JsRTApiTest::ParserStateTest);
+    }
+
+    void ParserStateCorruptionTest(JsRuntimeAttributes attributes, JsRuntimeHandle runtime)
+    {
+        std::string script = PadForDeferral(
+            "function f(a) { return function g() { return a; }; }\n"
+            "function h() { return 2; }\n"
+            "f(1)() + h();");
+
+        JsValueRef scriptBuffer = CreateScriptBuffer(script);
+        JsValueRef parserState = JS_INVALID_REFERENCE;
+        REQUIRE(JsSerializeParserState(scriptBuffer, &parserState, JsParseScriptAttributeNone) == JsNoError);
+
+        ChakraBytePtr state = nullptr;
+        unsigned int stateLength = 0;
+        REQUIRE(JsGetArrayBufferStorage(parserState, &state, &stateLength) == JsNoError);
+
+        JsValueRef sourceUrl = JS_INVALID_REFERENCE;
+        JsValueRef result = JS_INVALID_REFERENCE;
+        REQUIRE(JsCreateString("parserState.js", strlen("parserState.js"), &sourceUrl) == JsNoError);
+
+        // States that aren't well formed are rejected before the script is parsed
+        CHECK(JsRunScriptWithParserState(scriptBuffer, JS_SOURCE_CONTEXT_NONE, sourceUrl, JsParseScriptAttributeNone,
+            CopyArrayBuffer(parserState, 4), &result) == JsErrorInvalidArgument);
+        CHECK(JsRunScriptWithParserState(scriptBuffer, JS_SOURCE_CONTEXT_NONE, sourceUrl, JsParseScriptAttributeNone,
+            CopyArrayBuffer(parserState, stateLength - 1), &result) == JsErrorInvalidArgument);
+        CHECK(JsRunScriptWithParserState(scriptBuffer, JS_SOURCE_CONTEXT_NONE, sourceUrl, JsParseScriptAttributeNone,
+            sourceUrl, &result) == JsErrorInvalidArgument);
+
+        // The state ends with a flag of the last function, which is out of range once its high byte is set
+        JsValueRef changedState = CopyArrayBuffer(parserState, stateLength);
+        ChakraBytePtr changed = nullptr;
+        unsigned int changedLength = 0;
+        REQUIRE(JsGetArrayBufferStorage(changedState, &changed, &changedLength) == JsNoError);
+        changed[changedLength - 1] ^= 0xff;
+        CHECK(JsRunScriptWithParserState(scriptBuffer, JS_SOURCE_CONTEXT_NONE, sourceUrl, JsParseScriptAttributeNone,
+            changedState, &result) == JsErrorInvalidArgument);
+
+        // A state from another engine version is ignored
+        JsValueRef otherVersionState = CopyArrayBuffer(parserState, stateLength);
+        ChakraBytePtr otherVersion = nullptr;
+        unsigned int otherVersionLength = 0;
+        REQUIRE(JsGetArrayBufferStorage(otherVersionState, &otherVersion, &otherVersionLength) == JsNoError);
+        otherVersion[0] ^= 0xff;
+        CHECK(RunWithParserState(scriptBuffer, otherVersionState) == 3);
+
+        CHECK(RunWithParserState(scriptBuffer, parserState) == 3);
+    }
+
+    TEST_CASE("ApiTest_ParserStateCorruptionTest", "[ApiTest]")
+    {
+        JsRTApiTest::RunWithAttributes(JsRTApiTest::ParserStateCorruptionTest);
+    }
+
+    void CHAKRA_CALLBACK CollectionEndCallback(_In_ const JsCollectionStatistics *statistics, _In_opt_ void *callbackState)
+    {
+        *static_cast<JsCollectionStatistics *>(callbackState) = *statistics;
+    }
+
+    void CollectionStatisticsTest(JsRuntimeAttributes attributes, JsRuntimeHandle runtime)
+    {
+        JsCollectionStatistics before = {};
+        REQUIRE(JsGetRuntimeCollectionStatistics(runtime, &before) == JsNoError);
+        CHECK(JsGetRuntimeCollectionStatistics(runtime, nullptr) == JsErrorNullArgument);
+
+        JsCollectionStatistics lastCollection = {};
+        REQUIRE(JsSetRuntimeCollectionEndCallback(runtime, &lastCollection, CollectionEndCallback) == JsNoError);
+
+        JsValueRef result = JS_INVALID_REFERENCE;
+        REQUIRE(JsRunScript(_u("var garbage = []; for (var i = 0; i < 10000; i++) { garbage.push({ i: i }); } garbage = null;"), JS_SOURCE_CONTEXT_NONE, _u(""), &result) == JsNoError);
+        REQUIRE(JsCollectGarbage(runtime) == JsNoError);
+
+        JsCollectionStatistics after = {};
+        REQUIRE(JsGetRuntimeCollectionStatistics(runtime, &after) == JsNoError);
+        CHECK(after.collectionCount > before.collectionCount);
+        CHECK(after.allocatedBytes > 0);
+        CHECK(after.usedBytesBefore > 0);
+        CHECK(after.usedBytesAfter > 0);
+        CHECK(after.pauseMicroseconds >= after.markPauseMicroseconds);
+        CHECK(after.pauseMicroseconds >= after.sweepPauseMicroseconds);
+        CHECK(after.maxPauseMicroseconds >= after.pauseMicroseconds);
+        CHECK(after.totalPauseMicroseconds >= after.maxPauseMicroseconds);
+        CHECK(after.totalPauseMicroseconds >= before.totalPauseMicroseconds);
+
+        // The callback saw the collection the statistics report
+        CHECK(lastCollection.collectionCount == after.collectionCount);
+        CHECK(lastCollection.pauseMicroseconds == after.pauseMicroseconds);
+        CHECK(lastCollection.usedBytesAfter == after.usedBytesAfter);
+
+        REQUIRE(JsSetRuntimeCollectionEndCallback(runtime, nullptr, nullptr) == JsNoError);
+        const unsigned int callbackCount = lastCollection.collectionCount;
+        REQUIRE(JsCollectGarbage(runtime) == JsNoError);
+        CHECK(lastCollection.collectionCount == callbackCount);
+    }
+
+    TEST_CASE("ApiTest_CollectionStatisticsTest", "[ApiTest]")
+    {
+        JsRTApiTest::RunWithAttributes(JsRTApiTest::CollectionStatisticsTest);
+    }
+
+    void HeapStatisticsTest(JsRuntimeAttributes attributes, JsRuntimeHandle runtime)
+    {
+        unsigned int sizeClassCount = 0;
+        REQUIRE(JsGetRuntimeHeapStatistics(runtime, nullptr, 0, &sizeClassCount) == JsNoError);
+        REQUIRE(sizeClassCount > 0);
+        CHECK(JsGetRuntimeHeapStatistics(runtime, nullptr, 0, nullptr) == JsErrorNullArgument);
+
+        unsigned int baselineObjectCount = 0;
+        std::vector<JsHeapSizeClassStatistics> statistics(sizeClassCount);
+        REQUIRE(JsCollectGarbage(runtime) == JsNoError);
+        REQUIRE(JsGetRuntimeHeapStatistics(runtime, statistics.data(), sizeClassCount, &sizeClassCount) == JsNoError);
+        for (unsigned int i = 0; i < sizeClassCount; i++)
+        {
+            baselineObjectCount += statistics[i].objectCount;
+        }
+
+        // Keep objects of a few sizes alive across a collection
+        JsValueRef result = JS_INVALID_REFERENCE;
+        REQUIRE(JsRunScript(_u("var live = []; for (var i = 0; i < 2000; i++) { live.push({ i: i }, [i, i, i, i, i, i, i, i], 'string' + i); }"), JS_SOURCE_CONTEXT_NONE, _u(""), &result) == JsNoError);
+        REQUIRE(JsCollectGarbage(runtime) == JsNoError);
+
+        REQUIRE(JsGetRuntimeHeapStatistics(runtime, statistics.data(), sizeClassCount, &sizeClassCount) == JsNoError);
+
+        unsigned int objectCount = 0;
+        unsigned int previousObjectSize = 0;
+        for (unsigned int i = 0; i < sizeClassCount; i++)
+        {
+            const JsHeapSizeClassStatistics& sizeClass = statistics[i];
+
+            // Size classes grow, and each accounts for whole blocks holding whole objects
+            CHECK(sizeClass.objectSize > previousObjectSize);
+            previousObjectSize = sizeClass.objectSize;
+            CHECK(sizeClass.objectBytes == sizeClass.objectCount * sizeClass.objectSize);
+            CHECK(sizeClass.emptyBlockCount <= sizeClass.blockCount);
+            CHECK(sizeClass.blockBytes % 4096 == 0);
+            CHECK(sizeClass.blockBytes >= sizeClass.objectBytes);
+            if (sizeClass.blockCount == sizeClass.emptyBlockCount)
+            {
+                CHECK(sizeClass.objectCount == 0);
+                CHECK(sizeClass.blockBytes == 0);
+            }
+            objectCount += sizeClass.objectCount;
+        }
+        CHECK(objectCount >= baselineObjectCount + 3 * 2000);
+
+        // A short buffer only receives the first size classes
+        JsHeapSizeClassStatistics first = {};
+        unsigned int actualCount = 0;
+        REQUIRE(JsGetRuntimeHeapStatistics(runtime, &first, 1, &actualCount) == JsNoError);
+        CHECK(actualCount == sizeClassCount);
+        CHECK(first.objectSize == statistics[0].objectSize);
+    }
+
+    TEST_CASE("ApiTest_HeapStatisticsTest", "[ApiTest]")
+    {
+        JsRTApiTest::RunWithAttributes(JsRTApiTest::HeapStatisticsTest);
+    }
+
+    JsValueRef CALLBACK HeapStatisticsFromScriptCallback(JsValueRef callee, bool isConstructCall, JsValueRef *arguments, unsigned short argumentCount, void *callbackState)
+    {
+        JsRuntimeHandle runtime = callbackState;
+        unsigned int sizeClassCount = 0;
+        JsHeapSizeClassStatistics sizeClass = {};
+        JsCollectionStatistics collection = {};
+
+        // The heap can't be walked while script is running; the collection statistics are just copied
+        bool heapRefused = JsGetRuntimeHeapStatistics(runtime, &sizeClass, 1, &sizeClassCount) == JsErrorRuntimeInUse;
+        bool collectionRead = JsGetRuntimeCollectionStatistics(runtime, &collection) == JsNoError;
+
+        JsValueRef result = JS_INVALID_REFERENCE;
+        JsBoolToBoolean(heapRefused && collectionRead, &result);
+        return result;
+    }
+
+    struct StatisticsThreadArgs
+    {
+        JsRuntimeHandle runtime;
+        JsErrorCode heapStatisticsError;
+        JsErrorCode collectionStatisticsError;
+    };
+
+    static unsigned int CALLBACK StatisticsThreadProc(LPVOID lpParameter)
+    {
+        StatisticsThreadArgs * args = (StatisticsThreadArgs *)lpParameter;
+        unsigned int sizeClassCount = 0;
+        JsHeapSizeClassStatistics sizeClass = {};
+        JsCollectionStatistics collection = {};
+        args->heapStatisticsError = JsGetRuntimeHeapStatistics(args->runtime, &sizeClass, 1, &sizeClassCount);
+        args->collectionStatisticsError = JsGetRuntimeCollectionStatistics(args->runtime, &collection);
+        return 0;
+    }
+
+    void StatisticsThreadingTest(JsRuntimeAttributes attributes, JsRuntimeHandle runtime)
+    {
+        JsValueRef function = JS_INVALID_REFERENCE;
+        JsValueRef global = JS_INVALID_REFERENCE;
+        JsPropertyIdRef name = JS_INVALID_REFERENCE;
+        REQUIRE(JsCreateFunction(HeapStatisticsFromScriptCallback, runtime, &function) == JsNoError);
+        REQUIRE(JsGetGlobalObject(&global) == JsNoError);
+        REQUIRE(JsGetPropertyIdFromName(_u("readStatistics"), &name) == JsNoError);
+        REQUIRE(JsSetProperty(global, name, function, true) == JsNoError);
+
+        JsValueRef result = JS_INVALID_REFERENCE;
+        bool checked = false;
+        REQUIRE(JsRunScript(_u("readStatistics()"), JS_SOURCE_CONTEXT_NONE, _u(""), &result) == JsNoError);
+        REQUIRE(JsBooleanToBool(result, &checked) == JsNoError);
+        CHECK(checked);
+
+        // The runtime is current on this thread, so other threads can't use it
+        StatisticsThreadArgs threadArgs = { runtime, JsNoError, JsNoError };
+        HANDLE threadHandle = reinterpret_cast<HANDLE>(_beginthreadex(nullptr, 0, &StatisticsThreadProc, &threadArgs, 0, nullptr));
+        REQUIRE(threadHandle != nullptr);
+        if (threadHandle == nullptr)
+        {
+            // This is to satisfy preFAST, above REQUIRE call ensuring that it will report exception when threadHandle is null.
+            return;
+        }
+        WaitForSingleObject(threadHandle, INFINITE);
+        CloseHandle(threadHandle);
+
+        CHECK(threadArgs.heapStatisticsError == JsErrorWrongThread);
+        CHECK(threadArgs.collectionStatisticsError == JsErrorWrongThread);
+    }
+
+    TEST_CASE("ApiTest_StatisticsThreadingTest", "[ApiTest]")
+    {
+        JsRTApiTest::RunWithAttributes(JsRTApiTest::StatisticsThreadingTest);
+    }
+
+    struct SourceStreamThreadArgs
+    {
+        JsScriptSourceStream stream;
+        const char * source;
+        size_t length;
+        size_t chunkLength;
+        JsErrorCode error;
+    };
+
+    static unsigned int CALLBACK SourceStreamThreadProc(LPVOID lpParameter)
+    {
+        SourceStreamThreadArgs * args = (SourceStreamThreadArgs *)lpParameter;
+        for (size_t offset = 0; offset < args->length && args->error == JsNoError; offset += args->chunkLength)
+        {
+            size_t chunkLength = args->length - offset < args->chunkLength ? args->length - offset : args->chunkLength;
+
+            // Let the parser catch up with what was appended so far, so that it has to wait for this chunk
+            Sleep(1);
+            args->error = JsAppendScriptSourceStream(args->stream, reinterpret_cast<const uint8_t *>(args->source + offset),
+                chunkLength, offset + chunkLength == args->length);
+        }
+        return 0;
+    }
+
+    // Appends the source from another thread, chunkLength bytes at a time, while this thread parses it
+    JsErrorCode ParseStreamedSource(const char * source, size_t length, size_t chunkLength, size_t expectedLength, JsValueRef * function)
+    {
+        JsScriptSourceStream stream = nullptr;
+        REQUIRE(JsCreateScriptSourceStream(expectedLength, &stream) == JsNoError);
+
+        JsValueRef sourceUrl = JS_INVALID_REFERENCE;
+        REQUIRE(JsPointerToString(_u("streamed.js"), wcslen(_u("streamed.js")), &sourceUrl) == JsNoError);
+
+        SourceStreamThreadArgs threadArgs = { stream, source, length, chunkLength, JsNoError };
+        HANDLE threadHandle = reinterpret_cast<HANDLE>(_beginthreadex(nullptr, 0, &SourceStreamThreadProc, &threadArgs, 0, nullptr));
+        REQUIRE(threadHandle != nullptr);
+        if (threadHandle == nullptr)
+        {
+            // This is to satisfy preFAST, above REQUIRE call ensuring that it will report exception when threadHandle is null.
+            return JsErrorFatal;
+        }
+
+        JsErrorCode errorCode = JsParseScriptSourceStream(stream, JS_SOURCE_CONTEXT_NONE, sourceUrl, JsParseScriptAttributeNone, function);
+        WaitForSingleObject(threadHandle, INFINITE);
+        CloseHandle(threadHandle);
+        CHECK(threadArgs.error == JsNoError);
+
+        // The source stays alive with the function
+        REQUIRE(JsDisposeScriptSourceStream(stream) == JsNoError);
+        return errorCode;
+    }
+
+    void ScriptSourceStreamTest(JsRuntimeAttributes attributes, JsRuntimeHandle runtime)
+    {
+        // Two, three and four byte sequences in a comment, an identifier, strings, a regex and a template,
+        // which the one to five byte chunks split at every possible place
+        const char source[] =
+            "// comment \xE2\x82\xAC\n"
+            "var caf\xC3\xA9 = 1;\n"
+            "var s = '\xC3\xBC\xE2\x82\xAC\xF0\x9F\x98\x80';\n"
+            "/* \xE2\x98\x83\n"
+            "   \xE2\x98\x83 */\n"
+            "var re = /a\xE2\x82\xAC+/;\n"
+            "var t = `x${caf\xC3\xA9}y`;\n"
+            "function f() { return s.length; }\n"
+            "s === '\\u00fc\\u20ac\\ud83d\\ude00' && t === 'x1y' && re.source === 'a\\u20ac+' && caf\xC3\xA9 === f() - 3";
+        const size_t chunkLengths[] = { 1, 2, 3, 4, 5, 16, 17, sizeof(source) };
+
+        JsValueRef undefined = JS_INVALID_REFERENCE;
+        REQUIRE(JsGetUndefinedValue(&undefined) == JsNoError);
+
+        for (int i = 0; i < _countof(chunkLengths); i++)
+        {
+            // Whether the parser knows the length decides whether it defers f
+            for (size_t expectedLength = 0; expectedLength <= sizeof(source) - 1; expectedLength += sizeof(source) - 1)
+            {
+                JsValueRef function = JS_INVALID_REFERENCE;
+                REQUIRE(ParseStreamedSource(source, sizeof(source) - 1, chunkLengths[i], expectedLength, &function) == JsNoError);
+
+                JsValueRef result = JS_INVALID_REFERENCE;
+                bool checked = false;
+                REQUIRE(JsCallFunction(function, &undefined, 1, &result) == JsNoError);
+                REQUIRE(JsBooleanToBool(result, &checked) == JsNoError);
+                CHECK(checked);
+            }
+        }
+    }
+
+    TEST_CASE("ApiTest_ScriptSourceStreamTest", "[ApiTest]")
+    {
+        JsRTApiTest::RunWithAttributes(JsRTApiTest::ScriptSourceStreamTest);
+    }
+
+    void ScriptSourceStreamLongTokenTest(JsRuntimeAttributes attributes, JsRuntimeHandle runtime)
+    {
+        // A string literal that keeps running into the end of the source appended so far, and for which the
+        // source buffer has to grow while it is being scanned
+        const char prefix[] = "var s = '";
+        const char suffix[] = "\xE2\x82\xAC'; /* " "\xC3\xA9" " */ s.length";
+        const size_t literalLength = 200000;
+
+        std::vector<char> source;
+        source.insert(source.end(), prefix, prefix + sizeof(prefix) - 1);
+        source.insert(source.end(), literalLength, 'a');
+        source.insert(source.end(), suffix, suffix + sizeof(suffix) - 1);
+
+        JsValueRef function = JS_INVALID_REFERENCE;
+        REQUIRE(ParseStreamedSource(source.data(), source.size(), 1000, 0, &function) == JsNoError);
+
+        JsValueRef undefined = JS_INVALID_REFERENCE;
+        JsValueRef result = JS_INVALID_REFERENCE;
+        int length = 0;
+        REQUIRE(JsGetUndefinedValue(&undefined) == JsNoError);
+        REQUIRE(JsCallFunction(function, &undefined, 1, &result) == JsNoError);
+        REQUIRE(JsNumberToInt(result, &length) == JsNoError);
+        CHECK(length == literalLength + 1);
+    }
+
+    TEST_CASE("ApiTest_ScriptSourceStreamLongTokenTest", "[ApiTest]")
+    {
+        JsRTApiTest::RunWithAttributes(JsRTApiTest::ScriptSourceStreamLongTokenTest);
+    }
+
+    void ScriptSourceStreamErrorTest(JsRuntimeAttributes attributes, JsRuntimeHandle runtime)
+    {
+        JsValueRef function = JS_INVALID_REFERENCE;
+        JsValueRef exception = JS_INVALID_REFERENCE;
+
+        // An error before the end of the source, and a string that the end of the source leaves unterminated
+        const char earlyError[] = "var 1 = 2;\nvar a = '\xE2\x82\xAC';\nvar b = a + a;\n";
+        REQUIRE(ParseStreamedSource(earlyError, sizeof(earlyError) - 1, 3, 0, &function) == JsErrorScriptCompile);
+        REQUIRE(JsGetAndClearException(&exception) == JsNoError);
+
+        const char unterminated[] = "var a = 1;\nvar b = '\xE2\x82\xAC";
+        REQUIRE(ParseStreamedSource(unterminated, sizeof(unterminated) - 1, 2, 0, &function) == JsErrorScriptCompile);
+        REQUIRE(JsGetAndClearException(&exception) == JsNoError);
+
+        // A stream is only parsed once, and nothing can be appended after its last chunk
+        const char source[] = "1 + 2";
+        JsScriptSourceStream stream = nullptr;
+        JsValueRef sourceUrl = JS_INVALID_REFERENCE;
+        REQUIRE(JsCreateScriptSourceStream(0, &stream) == JsNoError);
+        REQUIRE(JsPointerToString(_u("streamed.js"), wcslen(_u("streamed.js")), &sourceUrl) == JsNoError);
+        REQUIRE(JsAppendScriptSourceStream(stream, reinterpret_cast<const uint8_t *>(source), sizeof(source) - 1, true) == JsNoError);
+        REQUIRE(JsParseScriptSourceStream(stream, JS_SOURCE_CONTEXT_NONE, sourceUrl, JsParseScriptAttributeNone, &function) == JsNoError);
+        CHECK(JsParseScriptSourceStream(stream, JS_SOURCE_CONTEXT_NONE, sourceUrl, JsParseScriptAttributeNone, &function) == JsErrorInvalidArgument);
+        CHECK(JsAppendScriptSourceStream(stream, reinterpret_cast<const uint8_t *>(source), 1, false) == JsErrorInvalidArgument);
+        REQUIRE(JsDisposeScriptSourceStream(stream) == JsNoError);
+    }
+
+    TEST_CASE("ApiTest_ScriptSourceStreamErrorTest", "[ApiTest]")
+    {
+        JsRTApiTest::RunWithAttributes(JsRTApiTest::ScriptSourceStreamErrorTest);
+    }
+
+    void SamplingProfilerTest(JsRuntimeAttributes attributes, JsRuntimeHandle runtime)
+    {
+        JsValueRef result = JS_INVALID_REFERENCE;
+
+        // Keeps calling into the runtime, so that the ticks in jitted code are sampled soon after them as well
+        REQUIRE(JsStartSamplingProfiler(runtime, 1000) == JsNoError);
+        REQUIRE(JsRunScript(
+            _u("function hot(n) { var s = 0; for (var i = 0; i < n; i++) { s += i % 7; } return s; }\n")
+            _u("var end = Date.now() + 300;\n")
+            _u("while (Date.now() < end) { hot(1000); }\n"),
+            JS_SOURCE_CONTEXT_NONE, _u(""), &result) == JsNoError);
+        REQUIRE(JsStopSamplingProfiler(runtime) == JsNoError);
+
+        size_t length = 0;
+        REQUIRE(JsCopySamplingProfile(runtime, nullptr, 0, &length) == JsNoError);
+        REQUIRE(length != 0);
+
+        std::vector<char> profile(length);
+        size_t written = 0;
+        REQUIRE(JsCopySamplingProfile(runtime, profile.data(), profile.size(), &written) == JsNoError);
+        CHECK(written == length);
+
+        // Checks that the profile is consistent and returns how many ticks went to hot
+        JsValueRef checkProfile = JS_INVALID_REFERENCE;
+        REQUIRE(JsRunScript(
+            _u("(function (text) {\n")
+            _u("    var profile = JSON.parse(text);\n")
+            _u("    var ids = {}, ticks = 0, hotTicks = 0;\n")
+            _u("    profile.nodes.forEach(function (node) { ids[node.id] = node; ticks += node.hitCount; });\n")
+            _u("    profile.nodes.forEach(function (node) {\n")
+            _u("        node.children.forEach(function (child) { if (!ids[child]) { throw new Error('child ' + child); } });\n")
+            _u("        if (node.callFrame.functionName === 'hot') { hotTicks += node.hitCount; }\n")
+            _u("    });\n")
+            _u("    if (profile.samples.length !== profile.timeDeltas.length || profile.samples.length !== profile.sampleDelays.length) { throw new Error('lengths'); }\n")
+            _u("    if (profile.samples.length > ticks) { throw new Error('samples'); }\n")
+            _u("    profile.samples.forEach(function (id) { if (!ids[id]) { throw new Error('sample ' + id); } });\n")
+            _u("    profile.timeDeltas.concat(profile.sampleDelays).forEach(function (time) { if (time < 0) { throw new Error('time'); } });\n")
+            _u("    if (profile.endTime < profile.startTime) { throw new Error('endTime'); }\n")
+            _u("    return hotTicks;\n")
+            _u("})"),
+            JS_SOURCE_CONTEXT_NONE, _u(""), &checkProfile) == JsNoError);
+
+        JsValueRef args[2] = { JS_INVALID_REFERENCE, JS_INVALID_REFERENCE };
+        REQUIRE(JsGetUndefinedValue(&args[0]) == JsNoError);
+        REQUIRE(JsCreateString(profile.data(), profile.size(), &args[1]) == JsNoError);
+        REQUIRE(JsCallFunction(checkProfile, args, 2, &result) == JsNoError);
+
+        // Most of 300ms in hot, sampled every ms of CPU time
+        int hotTicks = 0;
+        REQUIRE(JsNumberToInt(result, &hotTicks) == JsNoError);
+        CHECK(hotTicks > 10);
+
+        // Another runtime can't take the timer while this one has it
+        JsRuntimeHandle otherRuntime = JS_INVALID_RUNTIME_HANDLE;
+        REQUIRE(JsStartSamplingProfiler(runtime, 1000) == JsNoError);
+        REQUIRE(JsCreateRuntime(JsRuntimeAttributeNone, nullptr, &otherRuntime) == JsNoError);
+        CHECK(JsStartSamplingProfiler(otherRuntime, 1000) == JsErrorAlreadyProfilingContext);
+        REQUIRE(JsStopSamplingProfiler(runtime) == JsNoError);
+        CHECK(JsStartSamplingProfiler(otherRuntime, 1000) == JsNoError);
+        REQUIRE(JsStopSamplingProfiler(otherRuntime) == JsNoError);
+        REQUIRE(JsDisposeRuntime(otherRuntime) == JsNoError);
+
+        CHECK(JsStartSamplingProfiler(runtime, 0) == JsErrorInvalidArgument);
+    }
+
+    TEST_CASE("ApiTest_SamplingProfilerTest", "[ApiTest]")
+    {
+        JsRTApiTest::RunWithAttributes(JsRTApiTest::SamplingProfilerTest);
+    }
+
+    struct SamplingProfilerThreadArgs
+    {
+        volatile bool stop;
+    };
+
+    static unsigned int CALLBACK SamplingProfilerBusyThreadProc(LPVOID lpParameter)
+    {
+        SamplingProfilerThreadArgs * args = (SamplingProfilerThreadArgs *)lpParameter;
+        volatile unsigned int spins = 0;
+        while (!args->stop)
+        {
+            spins++;
+        }
+        return 0;
+    }
+
+    void SamplingProfilerIdleTest(JsRuntimeAttributes attributes, JsRuntimeHandle runtime)
+    {
+        // Another thread burning CPU while the sampled thread sleeps doesn't show up as samples of the script
+        SamplingProfilerThreadArgs threadArgs = { false };
+        HANDLE threadHandle = reinterpret_cast<HANDLE>(_beginthreadex(nullptr, 0, &SamplingProfilerBusyThreadProc, &threadArgs, 0, nullptr));
+        REQUIRE(threadHandle != nullptr);
+        if (threadHandle == nullptr)
+        {
+            // This is to satisfy preFAST, above REQUIRE call ensuring that it will report exception when threadHandle is null.
+            return;
+        }
+
+        REQUIRE(JsStartSamplingProfiler(runtime, 1000) == JsNoError);
+        Sleep(200);
+        REQUIRE(JsStopSamplingProfiler(runtime) == JsNoError);
+
+        threadArgs.stop = true;
+        WaitForSingleObject(threadHandle, INFINITE);
+        CloseHandle(threadHandle);
+
+        size_t length = 0;
+        REQUIRE(JsCopySamplingProfile(runtime, nullptr, 0, &length) == JsNoError);
+        std::vector<char> profile(length + 1);
+        REQUIRE(JsCopySamplingProfile(runtime, profile.data(), length, &length) == JsNoError);
+        profile[length] = '\0';
+
+        // No script ran, so nothing but the root and, for the wall clock timer of Windows, (program)
+        CHECK(strstr(profile.data(), "\"samples\":[]") != nullptr);
+#ifndef _WIN32
+        // The CPU time of the other thread doesn't tick either
+        CHECK(strstr(profile.data(), "(program)") == nullptr);
+#endif
+    }
+
+    TEST_CASE("ApiTest_SamplingProfilerIdleTest", "[ApiTest]")
+    {
+        JsRTApiTest::RunWithAttributes(JsRTApiTest::SamplingProfilerIdleTest);
+    }
+
+    static void CHAKRA_CALLBACK CountExternalStringFinalize(void * callbackState)
+    {
+        (*static_cast<int *>(callbackState))++;
+    }
+
+    void ExternalStringTest(JsRuntimeAttributes attributes, JsRuntimeHandle runtime)
+    {
+        static const char oneByteContent[] = "caf\xE9 au lait";
+        static const uint16_t utf16Content[] = { 'n', 0x00EF, 'v', 'e', 0 };
+        const size_t oneByteLength = sizeof(oneByteContent) - 1;
+        const size_t utf16Length = _countof(utf16Content) - 1;
+
+        JsValueRef oneByteString = JS_INVALID_REFERENCE;
+        JsValueRef utf16String = JS_INVALID_REFERENCE;
+        REQUIRE(JsCreateExternalString(oneByteContent, oneByteLength, nullptr, nullptr, &oneByteString) == JsNoError);
+        REQUIRE(JsCreateExternalStringUtf16(utf16Content, utf16Length, nullptr, nullptr, &utf16String) == JsNoError);
+
+        // The host's characters are returned as they are
+        const void * buffer = nullptr;
+        size_t length = 0;
+        JsStringEncoding encoding = JsStringEncodingUtf16;
+        REQUIRE(JsGetStringBuffer(oneByteString, &buffer, &length, &encoding) == JsNoError);
+        CHECK(buffer == oneByteContent);
+        CHECK(length == oneByteLength);
+        CHECK(encoding == JsStringEncodingOneByte);
+
+        REQUIRE(JsGetStringBuffer(utf16String, &buffer, &length, &encoding) == JsNoError);
+        CHECK(buffer == utf16Content);
+        CHECK(length == utf16Length);
+        CHECK(encoding == JsStringEncodingUtf16);
+
+        char copied[oneByteLength] = { 0 };
+        size_t written = 0;
+        REQUIRE(JsCopyString(oneByteString, 0, (int)oneByteLength, copied, &written) == JsNoError);
+        CHECK(written == oneByteLength);
+        CHECK(memcmp(copied, oneByteContent, oneByteLength) == 0);
+
+        // Script sees the Latin-1 bytes as Utf16 characters, in concatenations and substrings as well
+        JsValueRef check = JS_INVALID_REFERENCE;
+        JsValueRef result = JS_INVALID_REFERENCE;
+        REQUIRE(JsRunScript(
+            _u("(function (oneByte, utf16) {\n")
+            _u("    return oneByte === 'caf\\u00e9 au lait' && (oneByte + ' ' + utf16) === 'caf\\u00e9 au lait n\\u00efve' &&\n")
+            _u("        oneByte.substring(2, 4) === 'f\\u00e9' && utf16.charCodeAt(1) === 0xef && utf16.length === 4;\n")
+            _u("})"),
+            JS_SOURCE_CONTEXT_NONE, _u(""), &check) == JsNoError);
+
+        JsValueRef args[3] = { JS_INVALID_REFERENCE, oneByteString, utf16String };
+        bool checked = false;
+        REQUIRE(JsGetUndefinedValue(&args[0]) == JsNoError);
+        REQUIRE(JsCallFunction(check, args, 3, &result) == JsNoError);
+        REQUIRE(JsBooleanToBool(result, &checked) == JsNoError);
+        CHECK(checked);
+
+        // Widening the one byte string for script doesn't change what the host gets back
+        REQUIRE(JsGetStringBuffer(oneByteString, &buffer, &length, &encoding) == JsNoError);
+        CHECK(buffer == oneByteContent);
+        CHECK(encoding == JsStringEncodingOneByte);
+
+        // The Utf16 characters are used in place, so they must be null terminated
+        static const uint16_t unterminated[] = { 'a', 'b' };
+        JsValueRef invalid = JS_INVALID_REFERENCE;
+        CHECK(JsCreateExternalStringUtf16(unterminated, 1, nullptr, nullptr, &invalid) == JsErrorInvalidArgument);
+        CHECK(JsCreateExternalString(nullptr, 0, nullptr, nullptr, &invalid) == JsErrorNullArgument);
+    }
+
+    TEST_CASE("ApiTest_ExternalStringTest", "[ApiTest]")
+    {
+        JsRTApiTest::RunWithAttributes(JsRTApiTest::ExternalStringTest);
+    }
+
+    void ExternalStringFinalizeTest(JsRuntimeAttributes attributes, JsRuntimeHandle runtime)
+    {
+        static const char oneByteContent[] = "one byte";
+        static const uint16_t utf16Content[] = { 'u', 't', 'f', '1', '6', 0 };
+
+        JsContextRef currentContext = JS_INVALID_REFERENCE;
+        REQUIRE(JsGetCurrentContext(&currentContext) == JsNoError);
+
+        // The host is told once about each string, at the latest when its runtime goes away
+        JsRuntimeHandle stringRuntime = JS_INVALID_RUNTIME_HANDLE;
+        JsContextRef stringContext = JS_INVALID_REFERENCE;
+        REQUIRE(JsCreateRuntime(attributes, nullptr, &stringRuntime) == JsNoError);
+        REQUIRE(JsCreateContext(stringRuntime, &stringContext) == JsNoError);
+        REQUIRE(JsSetCurrentContext(stringContext) == JsNoError);
+
+        int oneByteFinalizeCount = 0;
+        int utf16FinalizeCount = 0;
+        JsValueRef oneByteString = JS_INVALID_REFERENCE;
+        JsValueRef utf16String = JS_INVALID_REFERENCE;
+        REQUIRE(JsCreateExternalString(oneByteContent, sizeof(oneByteContent) - 1,
+            CountExternalStringFinalize, &oneByteFinalizeCount, &oneByteString) == JsNoError);
+        REQUIRE(JsCreateExternalStringUtf16(utf16Content, _countof(utf16Content) - 1,
+            CountExternalStringFinalize, &utf16FinalizeCount, &utf16String) == JsNoError);
+        REQUIRE(JsAddRef(oneByteString, nullptr) == JsNoError);
+
+        // A substring keeps the string, and so the host's characters, alive
+        JsValueRef substring = JS_INVALID_REFERENCE;
+        JsValueRef substringFunction = JS_INVALID_REFERENCE;
+        JsValueRef args[2] = { JS_INVALID_REFERENCE, utf16String };
+        REQUIRE(JsRunScript(_u("(function (s) { return s.substring(1); })"), JS_SOURCE_CONTEXT_NONE, _u(""), &substringFunction) == JsNoError);
+        REQUIRE(JsGetUndefinedValue(&args[0]) == JsNoError);
+        REQUIRE(JsCallFunction(substringFunction, args, 2, &substring) == JsNoError);
+        REQUIRE(JsAddRef(substring, nullptr) == JsNoError);
+        utf16String = JS_INVALID_REFERENCE;
+
+        REQUIRE(JsCollectGarbage(stringRuntime) == JsNoError);
+        CHECK(utf16FinalizeCount == 0);
+
+        const void * buffer = nullptr;
+        size_t length = 0;
+        JsStringEncoding encoding = JsStringEncodingOneByte;
+        REQUIRE(JsGetStringBuffer(substring, &buffer, &length, &encoding) == JsNoError);
+        CHECK(length == _countof(utf16Content) - 2);
+        CHECK(memcmp(buffer, utf16Content + 1, length * sizeof(uint16_t)) == 0);
+        REQUIRE(JsRelease(substring, nullptr) == JsNoError);
+
+        REQUIRE(JsSetCurrentContext(JS_INVALID_REFERENCE) == JsNoError);
+
+        // Borrowing a buffer may flatten the string, which needs a current context
+        CHECK(JsGetStringBuffer(oneByteString, &buffer, &length, &encoding) == JsErrorNoCurrentContext);
+        REQUIRE(JsRelease(oneByteString, nullptr) == JsNoError);
+
+        REQUIRE(JsDisposeRuntime(stringRuntime) == JsNoError);
+        CHECK(oneByteFinalizeCount == 1);
+        CHECK(utf16FinalizeCount == 1);
+
+        REQUIRE(JsSetCurrentContext(currentContext) == JsNoError);
+    }
+
+    TEST_CASE("ApiTest_ExternalStringFinalizeTest", "[ApiTest]")
+    {
+        JsRTApiTest::RunWithAttributes(JsRTApiTest::ExternalStringFinalizeTest);
+    }
+
+    void StringBufferTest(JsRuntimeAttributes attributes, JsRuntimeHandle runtime)
+    {
+        // A concatenation is made contiguous, and stays so
+        JsValueRef concatenation = JS_INVALID_REFERENCE;
+        REQUIRE(JsRunScript(_u("var x = 'abc' + Math.random(); x = x.substring(0, 3); x + x + x"), JS_SOURCE_CONTEXT_NONE, _u(""), &concatenation) == JsNoError);
+
+        const void * buffer = nullptr;
+        const void * secondBuffer = nullptr;
+        size_t length = 0;
+        JsStringEncoding encoding = JsStringEncodingOneByte;
+        REQUIRE(JsGetStringBuffer(concatenation, &buffer, &length, &encoding) == JsNoError);
+        CHECK(encoding == JsStringEncodingUtf16);
+        REQUIRE(length == 9);
+        CHECK(memcmp(buffer, _u("abcabcabc"), 9 * sizeof(uint16_t)) == 0);
+        REQUIRE(JsGetStringBuffer(concatenation, &secondBuffer, &length, &encoding) == JsNoError);
+        CHECK(secondBuffer == buffer);
+
+        JsValueRef number = JS_INVALID_REFERENCE;
+        REQUIRE(JsIntToNumber(1, &number) == JsNoError);
+        CHECK(JsGetStringBuffer(number, &buffer, &length, &encoding) == JsErrorInvalidArgument);
+        CHECK(JsGetStringBuffer(concatenation, nullptr, &length, &encoding) == JsErrorNullArgument);
+    }
+
+    TEST_CASE("ApiTest_StringBufferTest", "[ApiTest]")
+    {
+        JsRTApiTest::RunWithAttributes(JsRTApiTest::StringBufferTest);
+    }
+
+    // Runs a script whose byte code is shared in a new context of the runtime, and returns its result as a string
+    std::string RunSharedScript(JsRuntimeHandle runtime, const char * script, size_t length)
+    {
+        JsContextRef currentContext = JS_INVALID_REFERENCE;
+        JsContextRef context = JS_INVALID_REFERENCE;
+        REQUIRE(JsGetCurrentContext(&currentContext) == JsNoError);
+        REQUIRE(JsCreateContext(runtime, &context) == JsNoError);
+        REQUIRE(JsSetCurrentContext(context) == JsNoError);
+
+        JsValueRef scriptBuffer = JS_INVALID_REFERENCE;
+        JsValueRef sourceUrl = JS_INVALID_REFERENCE;
+        JsValueRef result = JS_INVALID_REFERENCE;
+        JsValueRef resultString = JS_INVALID_REFERENCE;
+        REQUIRE(JsCreateExternalArrayBuffer((void *)script, (unsigned int)length, nullptr, nullptr, &scriptBuffer) == JsNoError);
+        REQUIRE(JsCreateString("shared.js", strlen("shared.js"), &sourceUrl) == JsNoError);
+        REQUIRE(JsRun(scriptBuffer, JS_SOURCE_CONTEXT_NONE, sourceUrl, JsParseScriptAttributeShareByteCode, &result) == JsNoError);
+        REQUIRE(JsConvertValueToString(result, &resultString) == JsNoError);
+
+        size_t written = 0;
+        REQUIRE(JsCopyString(resultString, 0, -1, nullptr, &written) == JsNoError);
+        std::string resultText(written, '\0');
+        if (written != 0)
+        {
+            REQUIRE(JsCopyString(resultString, 0, (int)written, &resultText[0], &written) == JsNoError);
+        }
+
+        REQUIRE(JsSetCurrentContext(currentContext) == JsNoError);
+        return resultText;
+    }
+
+    void SharedByteCodeTest(JsRuntimeAttributes attributes, JsRuntimeHandle runtime)
+    {
+        // The globals of every context start over, only the byte code is shared
+        const char script[] =
+            "var counter = (typeof counter === 'number' ? counter : 0) + 1;\n"
+            "function outer(s) { function inner(t) { return t.toUpperCase(); } return inner(s) + counter; }\n"
+            "outer('shared') + ':' + outer.toString().length";
+        const std::string expected = "SHARED1:" + std::to_string(strlen("function outer(s) { function inner(t) { return t.toUpperCase(); } return inner(s) + counter; }"));
+
+        // The first context parses the script and caches its byte code, the others load it from the cache
+        for (int i = 0; i < 3; i++)
+        {
+            CHECK(RunSharedScript(runtime, script, strlen(script)) == expected);
+        }
+
+        // A script that differs by a character doesn't get the byte code of the first
+        std::string changed = script;
+        changed.replace(changed.find("toUpperCase"), strlen("toUpperCase"), "toLowerCase");
+        CHECK(RunSharedScript(runtime, changed.c_str(), changed.length()) == "shared1:" + expected.substr(strlen("SHARED1:")));
+
+        // Nor does the same script loaded as a string, whose load flags differ
+        JsValueRef scriptString = JS_INVALID_REFERENCE;
+        JsValueRef sourceUrl = JS_INVALID_REFERENCE;
+        JsValueRef result = JS_INVALID_REFERENCE;
+        JsValueRef expectedString = JS_INVALID_REFERENCE;
+        bool equals = false;
+        REQUIRE(JsCreateString(script, strlen(script), &scriptString) == JsNoError);
+        REQUIRE(JsCreateString("shared.js", strlen("shared.js"), &sourceUrl) == JsNoError);
+        REQUIRE(JsRun(scriptString, JS_SOURCE_CONTEXT_NONE, sourceUrl, JsParseScriptAttributeShareByteCode, &result) == JsNoError);
+        REQUIRE(JsCreateString(expected.c_str(), expected.length(), &expectedString) == JsNoError);
+        REQUIRE(JsStrictEquals(result, expectedString, &equals) == JsNoError);
+        CHECK(equals);
+    }
+
+    TEST_CASE("ApiTest_SharedByteCodeTest", "[ApiTest]")
+    {
+        JsRTApiTest::RunWithAttributes(JsRTApiTest::SharedByteCodeTest);
+    }
+
+    void SharedByteCodeHashCollisionTest(JsRuntimeAttributes attributes, JsRuntimeHandle runtime)
+    {
+        // The cache is keyed by a hash of the script that rotates by 7 bits a character, so changing two characters
+        // 32 apart in the same way leaves it as it is. The second script must not get the byte code of the first.
+        std::string first = "'" + std::string(40, 'a') + "'";
+        std::string second = first;
+        second[1] = 'c';
+        second[33] = 'c';
+
+        CHECK(RunSharedScript(runtime, first.c_str(), first.length()) == first.substr(1, 40));
+        CHECK(RunSharedScript(runtime, second.c_str(), second.length()) == second.substr(1, 40));
+        CHECK(RunSharedScript(runtime, first.c_str(), first.length()) == first.substr(1, 40));
+        CHECK(RunSharedScript(runtime, second.c_str(), second.length()) == second.substr(1, 40));
+    }
+
+    TEST_CASE("ApiTest_SharedByteCodeHashCollisionTest", "[ApiTest]")
+    {
+        JsRTApiTest::RunWithAttributes(JsRTApiTest::SharedByteCodeHashCollisionTest);
+    }
+
+    void SharedByteCodeSourceLifetimeTest(JsRuntimeAttributes attributes, JsRuntimeHandle runtime)
+    {
+        // The cache keeps a copy of the script, so the host's buffer only has to live as long as the context it was
+        // loaded in needs it
+        const char script[] = "function f() { return 'from the first buffer'; } f() + '|' + f.toString()";
+        const std::string expected = "from the first buffer|function f() { return 'from the first buffer'; }";
+
+        std::vector<char> firstBuffer(script, script + strlen(script));
+        CHECK(RunSharedScript(runtime, firstBuffer.data(), firstBuffer.size()) == expected);
+
+        // The first context is done with its buffer; a hit must not read it
+        memset(firstBuffer.data(), ' ', firstBuffer.size());
+        firstBuffer.clear();
+        firstBuffer.shrink_to_fit();
+
+        std::vector<char> secondBuffer(script, script + strlen(script));
+        CHECK(RunSharedScript(runtime, secondBuffer.data(), secondBuffer.size()) == expected);
+    }
+
+    TEST_CASE("ApiTest_SharedByteCodeSourceLifetimeTest", "[ApiTest]")
+    {
+        JsRTApiTest::RunWithAttributes(JsRTApiTest::SharedByteCodeSourceLifetimeTest);
+    }
+
+    static void CHAKRA_CALLBACK HeapSnapshotWriteCallback(const char * chunk, size_t length, void * callbackState)
+    {
+        static_cast<std::string *>(callbackState)->append(chunk, length);
+    }
+
+    void HeapSnapshotTest(JsRuntimeAttributes attributes, JsRuntimeHandle runtime)
+    {
+        JsValueRef result = JS_INVALID_REFERENCE;
+
+        // A function that is the only way to reach a thousand objects
+        REQUIRE(JsRunScript(
+            _u("function heapSnapshotTarget() {}\n")
+            _u("heapSnapshotTarget.payload = [];\n")
+            _u("for (var i = 0; i < 1000; i++) { heapSnapshotTarget.payload.push({ index: i }); }\n"),
+            JS_SOURCE_CONTEXT_NONE, _u(""), &result) == JsNoError);
+
+        // Checks that the snapshot is consistent, and returns the retained size of heapSnapshotTarget after checking
+        // it against the nodes that can't be reached without going through it, or -1 without retained sizes
+        JsValueRef checkSnapshot = JS_INVALID_REFERENCE;
+        REQUIRE(JsRunScript(
+            _u("(function (text) {\n")
+            _u("    var snapshot = JSON.parse(text), meta = snapshot.snapshot.meta;\n")
+            _u("    var nodes = snapshot.nodes, edges = snapshot.edges, fieldCount = meta.node_fields.length;\n")
+            _u("    var typeField = meta.node_fields.indexOf('type'), nameField = meta.node_fields.indexOf('name');\n")
+            _u("    var sizeField = meta.node_fields.indexOf('self_size'), edgeCountField = meta.node_fields.indexOf('edge_count');\n")
+            _u("    var retainedField = meta.node_fields.indexOf('retained_size');\n")
+            _u("    var nodeCount = nodes.length / fieldCount;\n")
+            _u("    if (nodeCount !== snapshot.snapshot.node_count || edges.length !== snapshot.snapshot.edge_count * meta.edge_fields.length) { throw new Error('counts'); }\n")
+            _u("    var firstEdges = [], edgeCount = 0, target = -1;\n")
+            _u("    for (var node = 0; node < nodeCount; node++) {\n")
+            _u("        firstEdges.push(edgeCount);\n")
+            _u("        edgeCount += nodes[node * fieldCount + edgeCountField];\n")
+            _u("        var name = snapshot.strings[nodes[node * fieldCount + nameField]];\n")
+            _u("        if (name === undefined) { throw new Error('name ' + node); }\n")
+            _u("        if (name === 'heapSnapshotTarget' && meta.node_types[0][nodes[node * fieldCount + typeField]] === 'closure') {\n")
+            _u("            if (target !== -1) { throw new Error('target'); }\n")
+            _u("            target = node;\n")
+            _u("        }\n")
+            _u("        if (retainedField !== -1 && nodes[node * fieldCount + retainedField] < nodes[node * fieldCount + sizeField]) { throw new Error('retained ' + node); }\n")
+            _u("    }\n")
+            _u("    firstEdges.push(edgeCount);\n")
+            _u("    if (edgeCount * 3 !== edges.length) { throw new Error('edge_count'); }\n")
+            _u("    for (var edge = 0; edge < edges.length; edge += 3) {\n")
+            _u("        if (edges[edge + 2] % fieldCount !== 0 || edges[edge + 2] >= nodes.length) { throw new Error('to_node ' + edge); }\n")
+            _u("    }\n")
+            _u("    if (target === -1) { throw new Error('no target'); }\n")
+            _u("    // Sums the sizes of the nodes reached from the root without going through the excluded node\n")
+            _u("    function reachableSize(excluded, reached) {\n")
+            _u("        var stack = [0], size = 0;\n")
+            _u("        reached[0] = 1;\n")
+            _u("        while (stack.length !== 0) {\n")
+            _u("            var node = stack.pop();\n")
+            _u("            size += nodes[node * fieldCount + sizeField];\n")
+            _u("            for (var edge = firstEdges[node]; edge < firstEdges[node + 1]; edge++) {\n")
+            _u("                var to = edges[edge * 3 + 2] / fieldCount;\n")
+            _u("                if (to !== excluded && !reached[to]) { reached[to] = 1; stack.push(to); }\n")
+            _u("            }\n")
+            _u("        }\n")
+            _u("        return size;\n")
+            _u("    }\n")
+            _u("    var reached = new Uint8Array(nodeCount), totalSize = reachableSize(-1, reached);\n")
+            _u("    if (reached.indexOf(0) !== -1) { throw new Error('unreachable ' + reached.indexOf(0)); }\n")
+            _u("    if (retainedField === -1) { return -1; }\n")
+            _u("    if (nodes[retainedField] !== totalSize) { throw new Error('root'); }\n")
+            _u("    var retainedSize = totalSize - reachableSize(target, new Uint8Array(nodeCount));\n")
+            _u("    if (nodes[target * fieldCount + retainedField] !== retainedSize) { throw new Error('target retained'); }\n")
+            _u("    return retainedSize;\n")
+            _u("})"),
+            JS_SOURCE_CONTEXT_NONE, _u(""), &checkSnapshot) == JsNoError);
+
+        JsHeapSnapshotAttributes snapshotAttributes[] = { JsHeapSnapshotAttributeNone, JsHeapSnapshotAttributeRetainedSizes };
+        for (JsHeapSnapshotAttributes snapshotAttribute : snapshotAttributes)
+        {
+            std::string snapshot;
+            REQUIRE(JsTakeHeapSnapshot(runtime, snapshotAttribute, HeapSnapshotWriteCallback, &snapshot) == JsNoError);
+            REQUIRE(!snapshot.empty());
+
+            JsValueRef args[2] = { JS_INVALID_REFERENCE, JS_INVALID_REFERENCE };
+            REQUIRE(JsGetUndefinedValue(&args[0]) == JsNoError);
+            REQUIRE(JsCreateString(snapshot.c_str(), snapshot.length(), &args[1]) == JsNoError);
+            REQUIRE(JsCallFunction(checkSnapshot, args, 2, &result) == JsNoError);
+
+            double retainedSize = 0;
+            REQUIRE(JsNumberToDouble(result, &retainedSize) == JsNoError);
+            if (snapshotAttribute == JsHeapSnapshotAttributeNone)
+            {
+                CHECK(retainedSize == -1);
+            }
+            else
+            {
+                // At least the objects of the payload, which are bigger than a vtable and a type
+                CHECK(retainedSize >= 1000 * 2 * sizeof(void *));
+            }
+        }
+    }
+
+    TEST_CASE("ApiTest_HeapSnapshotTest", "[ApiTest]")
+    {
+        JsRTApiTest::RunWithAttributes(JsRTApiTest::HeapSnapshotTest);
+    }
 }
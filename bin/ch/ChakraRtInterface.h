@@ -77,6 +77,8 @@ struct JsAPIHooks
     typedef JsErrorCode(WINAPI *JsrtCreateStringUtf8)(const uint8_t *content, size_t length, JsValueRef *value);
     typedef JsErrorCode(WINAPI *JsrtCreateExternalArrayBuffer)(void *data, unsigned int byteLength, JsFinalizeCallback finalizeCallback, void *callbackState, JsValueRef *result);
     typedef JsErrorCode(WINAPI *JsrtCreatePropertyIdUtf8)(const char *name, size_t length, JsPropertyIdRef *propertyId);
+    typedef JsErrorCode(WINAPI *JsrtGetRuntimeCollectionStatistics)(JsRuntimeHandle runtime, JsCollectionStatistics *statistics);
+    typedef JsErrorCode(WINAPI *JsrtGetRuntimeJitStatistics)(JsRuntimeHandle runtime, JsJitStatistics *statistics);
 
     typedef JsErrorCode(WINAPI *JsrtTTDCreateRecordRuntimePtr)(JsRuntimeAttributes attributes, const byte* infoUri, size_t infoUriCount, size_t snapInterval, size_t snapHistoryLength, JsTTDInitializeForWriteLogStreamCallback writeInitializeFunction, TTDOpenResourceStreamCallback openResourceStream, JsTTDReadBytesFromStreamCallback readBytesFromStream, JsTTDWriteBytesToStreamCallback writeBytesToStream, JsTTDFlushAndCloseStreamCallback flushAndCloseStream, JsThreadServiceCallback threadService, JsRuntimeHandle *runtime);
     typedef JsErrorCode(WINAPI *JsrtTTDCreateReplayRuntimePtr)(JsRuntimeAttributes attributes, const byte* infoUri, size_t infoUriCount, bool enableDebugging, JsTTDInitializeForWriteLogStreamCallback writeInitializeFunction, TTDOpenResourceStreamCallback openResourceStream, JsTTDReadBytesFromStreamCallback readBytesFromStream, JsTTDWriteBytesToStreamCallback writeBytesToStream, JsTTDFlushAndCloseStreamCallback flushAndCloseStream, JsThreadServiceCallback threadService, JsRuntimeHandle *runtime);
@@ -168,6 +170,8 @@ struct JsAPIHooks
     JsrtCopyStringUtf8 pfJsrtCopyStringUtf8;
     JsrtCreatePropertyIdUtf8 pfJsrtCreatePropertyIdUtf8;
     JsrtCreateExternalArrayBuffer pfJsrtCreateExternalArrayBuffer;
+    JsrtGetRuntimeCollectionStatistics pfJsrtGetRuntimeCollectionStatistics;
+    JsrtGetRuntimeJitStatistics pfJsrtGetRuntimeJitStatistics;
 
     JsrtTTDCreateRecordRuntimePtr pfJsrtTTDCreateRecordRuntime;
     JsrtTTDCreateReplayRuntimePtr pfJsrtTTDCreateReplayRuntime;
@@ -372,6 +376,8 @@ public:
     static JsErrorCode WINAPI JsCreateStringUtf8(const uint8_t *content, size_t length, JsValueRef *value) { return HOOK_JS_API(CreateStringUtf8(content, length, value)); }
     static JsErrorCode WINAPI JsCreatePropertyIdUtf8(const char *name, size_t length, JsPropertyIdRef *propertyId) { return HOOK_JS_API(CreatePropertyIdUtf8(name, length, propertyId)); }
     static JsErrorCode WINAPI JsCreateExternalArrayBuffer(void *data, unsigned int byteLength, JsFinalizeCallback finalizeCallback, void *callbackState, JsValueRef *result)  { return HOOK_JS_API(CreateExternalArrayBuffer(data, byteLength, finalizeCallback, callbackState, result)); }
+    static JsErrorCode WINAPI JsGetRuntimeCollectionStatistics(JsRuntimeHandle runtime, JsCollectionStatistics *statistics) { return HOOK_JS_API(GetRuntimeCollectionStatistics(runtime, statistics)); }
+    static JsErrorCode WINAPI JsGetRuntimeJitStatistics(JsRuntimeHandle runtime, JsJitStatistics *statistics) { return HOOK_JS_API(GetRuntimeJitStatistics(runtime, statistics)); }
 };
 
 class AutoRestoreContext
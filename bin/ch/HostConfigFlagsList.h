@@ -11,5 +11,8 @@ FLAG(int,  InspectMaxStringLength,          "Max string length to dump in locals
 FLAG(BSTR, Serialized,                      "If source is UTF8, deserializes from bytecode file", NULL)
 FLAG(bool, OOPJIT,                          "Run JIT in a separate process", false)
 FLAG(bool, EnsureCloseJITServer,            "JIT process will be force closed when ch is terminated", true)
+FLAG(bool, PrintRuntimeStatistics,          "Print the JIT and GC counters of the runtime once the script has run", false)
+FLAG(bool, ShareByteCode,                   "Share the byte code of the scripts of WScript.LoadScript across the contexts of the runtime", false)
+FLAG(int,  InterpreterBenchmark,            "Run the script this many times with the JIT disabled and print the time of each run", 5)
 #undef FLAG
 #endif
@@ -359,6 +359,11 @@ JsErrorCode WScriptJsrt::LoadModuleFromString(LPCSTR fileName, LPCSTR fileConten
     return JsNoError;
 }
 
+JsParseScriptAttributes WScriptJsrt::GetLoadScriptAttributes()
+{
+    return HostConfigFlags::flags.ShareByteCode ? JsParseScriptAttributeShareByteCode : JsParseScriptAttributeNone;
+}
+
 JsValueRef WScriptJsrt::LoadScript(JsValueRef callee, LPCSTR fileName,
     LPCSTR fileContent, LPCSTR scriptInjectType, bool isSourceModule)
 {
@@ -416,7 +421,7 @@ JsValueRef WScriptJsrt::LoadScript(JsValueRef callee, LPCSTR fileName,
         IfJsrtErrorSetGo(ChakraRTInterface::JsCreateStringUtf8((const uint8_t*)fullPathNarrow,
             strlen(fullPathNarrow), &fname));
         errorCode = ChakraRTInterface::JsRun(scriptSource, GetNextSourceContext(),
-            fname, JsParseScriptAttributeNone, &returnValue);
+            fname, GetLoadScriptAttributes(), &returnValue);
 
         if(errorCode == JsNoError)
         {
@@ -449,7 +454,7 @@ JsValueRef WScriptJsrt::LoadScript(JsValueRef callee, LPCSTR fileName,
         IfJsrtErrorSetGo(ChakraRTInterface::JsCreateStringUtf8((const uint8_t*)fullPathNarrow,
             strlen(fullPathNarrow), &fname));
         errorCode = ChakraRTInterface::JsRun(scriptSource, GetNextSourceContext(),
-            fname, JsParseScriptAttributeNone, &returnValue);
+            fname, GetLoadScriptAttributes(), &returnValue);
 
         if (errorCode == JsNoError)
         {
@@ -248,6 +248,25 @@ static bool CHAKRA_CALLBACK DummyJsSerializedScriptLoadUtf8Source(
     return true;
 }
 
+// Prints the counters of the runtime in the "### " format of the drivers of test/benchmarks
+static void PrintRuntimeStatistics(JsRuntimeHandle runtime)
+{
+    JsJitStatistics jitStatistics;
+    JsCollectionStatistics collectionStatistics;
+    if (ChakraRTInterface::JsGetRuntimeJitStatistics(runtime, &jitStatistics) != JsNoError ||
+        ChakraRTInterface::JsGetRuntimeCollectionStatistics(runtime, &collectionStatistics) != JsNoError)
+    {
+        return;
+    }
+
+    wprintf(_u("### JIT: simpleJitFunctions %u fullJitFunctions %u loopBodies %u failed %u bailOuts %u rejits %u\n"),
+        jitStatistics.simpleJitFunctionCount, jitStatistics.fullJitFunctionCount, jitStatistics.loopBodyCount,
+        jitStatistics.failedCount, jitStatistics.bailOutCount, jitStatistics.rejitCount);
+    wprintf(_u("### GC: collections %u totalPauseMicroseconds %.0f maxPauseMicroseconds %.0f usedBytes %.0f\n"),
+        collectionStatistics.collectionCount, (double)collectionStatistics.totalPauseMicroseconds,
+        (double)collectionStatistics.maxPauseMicroseconds, (double)collectionStatistics.usedBytesAfter);
+}
+
 HRESULT RunScript(const char* fileName, LPCSTR fileContents, BYTE *bcBuffer, char *fullPath)
 {
     HRESULT hr = S_OK;
@@ -380,6 +399,11 @@ HRESULT RunScript(const char* fileName, LPCSTR fileContents, BYTE *bcBuffer, cha
             {
                 IfFailGo(messageQueue->ProcessAll(fileName));
             } while(!messageQueue->IsEmpty());
+
+            if (HostConfigFlags::flags.PrintRuntimeStatistics)
+            {
+                PrintRuntimeStatistics(chRuntime);
+            }
         }
     }
 
@@ -407,6 +431,64 @@ Error:
     return hr;
 }
 
+// Runs the script the number of times given by -InterpreterBenchmark, each time in a new context so that the
+// top level declarations of one run don't collide with the last one, and prints the time of each run. The
+// runtime was created with the JIT disabled, so the time is that of the interpreter (and the parser). Like
+// RunScript, it takes over the file contents.
+static HRESULT RunInterpreterBenchmark(const char* fileName, LPCSTR fileContents, char *fullPath)
+{
+    HRESULT hr = S_OK;
+    const size_t length = strlen(fileContents);
+    const int runCount = HostConfigFlags::flags.InterpreterBenchmark > 0 ? HostConfigFlags::flags.InterpreterBenchmark : 1;
+    double bestMilliseconds = 0;
+    double totalMilliseconds = 0;
+
+    LARGE_INTEGER frequency;
+    QueryPerformanceFrequency(&frequency);
+
+    for (int run = 0; run < runCount; run++)
+    {
+        if (run > 0)
+        {
+            JsContextRef context = JS_INVALID_REFERENCE;
+            IfJsErrorFailLog(ChakraRTInterface::JsCreateContext(chRuntime, &context));
+            IfJsErrorFailLog(ChakraRTInterface::JsSetCurrentContext(context));
+            if (!WScriptJsrt::Initialize())
+            {
+                IfFailGo(E_FAIL);
+            }
+        }
+
+        // The script source frees its contents once it is collected, so each run gets its own copy
+        char * contents = (char *)malloc(length + 1);
+        if (contents == nullptr)
+        {
+            IfFailGo(E_OUTOFMEMORY);
+        }
+        memcpy(contents, fileContents, length + 1);
+
+        LARGE_INTEGER start, end;
+        QueryPerformanceCounter(&start);
+        IfFailGo(RunScript(fileName, contents, nullptr, fullPath));
+        QueryPerformanceCounter(&end);
+
+        const double milliseconds = (double)(end.QuadPart - start.QuadPart) * 1000.0 / (double)frequency.QuadPart;
+        if (run == 0 || milliseconds < bestMilliseconds)
+        {
+            bestMilliseconds = milliseconds;
+        }
+        totalMilliseconds += milliseconds;
+        wprintf(_u("### Interpreter benchmark: run %d %.3f ms\n"), run + 1, milliseconds);
+    }
+
+    wprintf(_u("### Interpreter benchmark: runs %d best %.3f ms mean %.3f ms\n"),
+        runCount, bestMilliseconds, totalMilliseconds / runCount);
+
+Error:
+    free((void *)fileContents);
+    return hr;
+}
+
 static HRESULT CreateRuntime(JsRuntimeHandle *runtime)
 {
     HRESULT hr = E_FAIL;
@@ -525,6 +607,11 @@ HRESULT ExecuteTest(const char* fileName)
             jsrtAttributes = (JsRuntimeAttributes)(jsrtAttributes | JsRuntimeAttributeSerializeLibraryByteCode);
         }
 
+        if (HostConfigFlags::flags.InterpreterBenchmarkIsEnabled)
+        {
+            jsrtAttributes = (JsRuntimeAttributes)(jsrtAttributes | JsRuntimeAttributeDisableNativeCodeGeneration);
+        }
+
 #if ENABLE_TTD
         if (doTTRecord)
         {
@@ -624,6 +711,10 @@ HRESULT ExecuteTest(const char* fileName)
         {
             CreateAndRunSerializedScript(fileName, fileContents, fullPath);
         }
+        else if (HostConfigFlags::flags.InterpreterBenchmarkIsEnabled)
+        {
+            IfFailGo(RunInterpreterBenchmark(fileName, fileContents, fullPath));
+        }
         else
         {
             IfFailGo(RunScript(fileName, fileContents, nullptr, fullPath));
@@ -34,6 +34,9 @@ PRINT_USAGE() {
     echo "      --create-deb=V   Create .deb package with given V version"
     echo "  -d, --debug          Debug build (by default Release build)"
     echo "      --embed-icu      Download and embed ICU-57 statically"
+    echo "      --fast-arraybuffer"
+    echo "                       Skip array bounds checks in jitted code, relying on"
+    echo "                       guard pages and the SIGSEGV handler (x64 Linux only)"
     echo "  -h, --help           Show help"
     echo "      --icu=PATH       Path to ICU include folder (see example below)"
     echo "  -j [N], --jobs[=N]   Multicore build, allow N jobs at once"
@@ -46,6 +49,8 @@ PRINT_USAGE() {
     echo "      --sanitize=CHECKS Build with clang -fsanitize checks,"
     echo "                       e.g. undefined,signed-integer-overflow"
     echo "  -t, --test-build     Test build (by default Release build)"
+    echo "      --transparent-huge-pages"
+    echo "                       Support -TransparentHugePages (Linux only)"
     echo "      --xcode          Generate XCode project"
     echo "      --without=FEATURE,FEATURE,..."
     echo "                       Disable FEATUREs from JSRT experimental"
@@ -68,6 +73,8 @@ CMAKE_GEN=
 MAKE=make
 MULTICORE_BUILD=""
 NO_JIT=
+FAST_ARRAYBUFFER=
+HUGE_PAGES=
 ICU_PATH="-DICU_SETTINGS_RESET=1"
 STATIC_LIBRARY="-DSHARED_LIBRARY_SH=1"
 SANITIZE=
@@ -211,6 +218,14 @@ while [[ $# -gt 0 ]]; do
         NO_JIT="-DNO_JIT_SH=1"
         ;;
 
+    --fast-arraybuffer)
+        FAST_ARRAYBUFFER="-DFAST_ARRAYBUFFER_SH=1"
+        ;;
+
+    --transparent-huge-pages)
+        HUGE_PAGES="-DTRANSPARENT_HUGE_PAGES_SH=1"
+        ;;
+
     --xcode)
         CMAKE_GEN="-G Xcode -DCC_XCODE_PROJECT=1"
         MAKE=0
@@ -333,7 +348,7 @@ fi
 
 echo Generating $BUILD_TYPE makefiles
 cmake $CMAKE_GEN $CC_PREFIX $ICU_PATH $LTO $STATIC_LIBRARY $ARCH \
-    -DCMAKE_BUILD_TYPE=$BUILD_TYPE $SANITIZE $NO_JIT $WITHOUT_FEATURES ../..
+    -DCMAKE_BUILD_TYPE=$BUILD_TYPE $SANITIZE $NO_JIT $FAST_ARRAYBUFFER $HUGE_PAGES $WITHOUT_FEATURES ../..
 
 _RET=$?
 if [[ $? == 0 ]]; then
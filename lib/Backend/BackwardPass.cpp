@@ -160,7 +160,7 @@ BackwardPass::DoTrackNegativeZero() const
 bool
 BackwardPass::DoTrackBitOpsOrNumber() const
 {
-#if _WIN64
+#if ENABLE_FAST_ARRAYBUFFER
     return
         !PHASE_OFF1(Js::TypedArrayVirtualPhase) &&
         tag == Js::BackwardPhase &&
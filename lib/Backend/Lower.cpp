@@ -22290,6 +22290,9 @@ Lowerer::LowerNewConcatStrMulti(IR::Instr * instr)
         this->LoadLibraryValueOpnd(instr, LibraryValue::ValueStringTypeStatic), instr);
     GenerateRecyclerMemInitNull(dstOpnd, Js::ConcatStringMulti::GetOffsetOfpszValue(), instr);
     GenerateRecyclerMemInit(dstOpnd, Js::ConcatStringMulti::GetOffsetOfcharLength(), 0, instr);
+#ifdef TARGET_64
+    GenerateRecyclerMemInit(dstOpnd, Js::ConcatStringMulti::GetOffsetOfHashCode(), 0, instr);
+#endif
     GenerateRecyclerMemInit(dstOpnd, Js::ConcatStringMulti::GetOffsetOfSlotCount(), countOpnd->AsUint32(), instr);
 
     instr->Remove();
@@ -1944,6 +1944,7 @@ NativeCodeGenerator::JobProcessed(JsUtil::Job *const job, const bool succeeded)
 
     Js::FunctionBody* functionBody = nullptr;
     CodeGenWorkItemType workitemType = workItem->Type();
+    ThreadContextJitStatistics *const jitStatistics = scriptContext->GetThreadContext()->GetJitStatistics();
 
     if (workitemType == JsFunctionType)
     {
@@ -1956,9 +1957,20 @@ NativeCodeGenerator::JobProcessed(JsUtil::Job *const job, const bool succeeded)
             entryPointInfo->SetJitMode(jitMode);
             Assert(workItem->GetCodeAddress() != NULL);
             entryPointInfo->SetCodeGenDone();
+
+            if (jitMode == ExecutionMode::SimpleJit)
+            {
+                jitStatistics->simpleJitFunctionCount++;
+            }
+            else
+            {
+                jitStatistics->fullJitFunctionCount++;
+            }
         }
         else
         {
+            jitStatistics->failedCount++;
+
 #if DBG
             functionBody->m_nativeEntryPointIsInterpreterThunk = true;
 #endif
@@ -2004,9 +2016,12 @@ NativeCodeGenerator::JobProcessed(JsUtil::Job *const job, const bool succeeded)
             uint loopNum = loopBodyCodeGen->GetJITData()->loopNumber;
             functionBody->SetLoopBodyEntryPoint(loopBodyCodeGen->loopHeader, entryPoint, (Js::JavascriptMethod)workItem->GetCodeAddress(), loopNum);            
             entryPoint->SetCodeGenDone();
+            jitStatistics->loopBodyCount++;
         }
         else
         {
+            jitStatistics->failedCount++;
+
             // We re-use failed loop body entry points.
             // The loop body entry point could have been cleaned up if the parent function JITed,
             // in which case we don't want to reset it.
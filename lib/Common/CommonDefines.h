@@ -88,6 +88,9 @@
 // ByteCode
 #define VARIABLE_INT_ENCODING 1                     // Byte code serialization variable size int field encoding
 #define BYTECODE_BRANCH_ISLAND                      // Byte code short branch and branch island
+#if CLANG_HAS_THREADED_DISPATCH                     // The build checks that the compiler takes the constructs (see CMakeFeatureDetect.cmake)
+#define ENABLE_INTERPRETER_THREADED_DISPATCH        // Computed goto dispatch in the interpreter loop (needs labels as values)
+#endif
 #if defined(_WIN32) || defined(HAS_REAL_ICU)
 #define ENABLE_UNICODE_API 1                        // Enable use of Unicode-related APIs
 #endif
@@ -120,10 +123,14 @@
 
 // GC features
 
-// Concurrent and Partial GC are disabled on non-Windows builds
-// xplat-todo: re-enable this in the future
-// These are disabled because these GC features depend on hardware
-// write-watch support that the Windows Memory Manager provides.
+// Concurrent and Partial GC depend on the write-watch support that the
+// Windows Memory Manager provides. The Linux PAL's write watch reports every
+// committed page as written, so a rescan there revisits the whole heap:
+// partial collections would be full collections with more foreground work,
+// and the recycler only marks concurrently when forced to. Linux gets the
+// concurrent thread for sweeping and for zeroing and freeing pages in the
+// background, which don't need write watch.
+// xplat-todo: precise write tracking, and the other platforms
 #ifdef _WIN32
 #define SYSINFO_IMAGE_BASE_AVAILABLE 1
 #define ENABLE_CONCURRENT_GC 1
@@ -132,6 +139,13 @@
 #define ENABLE_BACKGROUND_PAGE_FREEING 1
 #define ENABLE_RECYCLER_TYPE_TRACKING 1
 #define ENABLE_JS_ETW                               // ETW support
+#elif defined(__linux__)
+#define SYSINFO_IMAGE_BASE_AVAILABLE 0
+#define ENABLE_CONCURRENT_GC 1
+#define ENABLE_PARTIAL_GC 0
+#define ENABLE_BACKGROUND_PAGE_ZEROING 1
+#define ENABLE_BACKGROUND_PAGE_FREEING 1
+#define ENABLE_RECYCLER_TYPE_TRACKING 0
 #else
 #define SYSINFO_IMAGE_BASE_AVAILABLE 0
 #define ENABLE_CONCURRENT_GC 0
@@ -141,6 +155,16 @@
 #define ENABLE_RECYCLER_TYPE_TRACKING 0
 #endif
 
+// Huge page segments double the page bit vectors of every page segment, so they are opted into by the
+// build (build.sh --transparent-huge-pages) before -TransparentHugePages can turn them on
+#ifndef ENABLE_TRANSPARENT_HUGE_PAGES
+#define ENABLE_TRANSPARENT_HUGE_PAGES 0
+#endif
+
+#if ENABLE_TRANSPARENT_HUGE_PAGES && !defined(__linux__)
+#error "Transparent huge pages are only supported on Linux"
+#endif
+
 #if ENABLE_BACKGROUND_PAGE_ZEROING && !ENABLE_BACKGROUND_PAGE_FREEING
 #error "Background page zeroing can't be turned on if freeing pages in the background is disabled"
 #endif
@@ -349,14 +373,17 @@
 #define ENABLE_TTD_INTERNAL_DIAGNOSTICS 0
 #endif
 
+//Keep the output readable when diagnosing TTD itself, otherwise write compact binary compressed on a background thread
+#if ENABLE_TTD_INTERNAL_DIAGNOSTICS
 #define TTD_COMPRESSED_OUTPUT 0
 #define TTD_LOG_READER TextFormatReader
 #define TTD_LOG_WRITER TextFormatWriter
-
-#if ENABLE_TTD_INTERNAL_DIAGNOSTICS
 #define TTD_SNAP_READER TextFormatReader
 #define TTD_SNAP_WRITER TextFormatWriter
 #else
+#define TTD_COMPRESSED_OUTPUT 1
+#define TTD_LOG_READER BinaryFormatReader
+#define TTD_LOG_WRITER BinaryFormatWriter
 #define TTD_SNAP_READER BinaryFormatReader
 #define TTD_SNAP_WRITER BinaryFormatWriter
 #endif
@@ -573,6 +600,17 @@
 #define ENABLE_WASM
 #endif
 
+// Array buffers reserve a 4GB guard region, so that jitted code can skip bounds checks and rely on
+// the access violation handler to complete out of bounds accesses (see ResumeForOutOfBoundsArrayRefs).
+// On Linux the PAL's SIGSEGV handler completes them, which the build opts into (build.sh --fast-arraybuffer)
+#if defined(_M_X64) && defined(_WIN32)
+#define ENABLE_FAST_ARRAYBUFFER 1
+#endif
+
+#if ENABLE_FAST_ARRAYBUFFER && !(defined(_M_X64) && (defined(_WIN32) || defined(__linux__)))
+#error "Array buffers with guard regions are only supported on x64 Windows and Linux"
+#endif
+
 #if _M_IX86
 #define I386_ASM 1
 #endif //_M_IX86
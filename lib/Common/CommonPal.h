@@ -361,9 +361,81 @@ typedef union _SLIST_HEADER {
 
 #endif
 
-PALIMPORT VOID PALAPI InitializeSListHead(IN OUT PSLIST_HEADER ListHead);
-PALIMPORT PSLIST_ENTRY PALAPI InterlockedPushEntrySList(IN OUT PSLIST_HEADER ListHead, IN OUT PSLIST_ENTRY  ListEntry);
-PALIMPORT PSLIST_ENTRY PALAPI InterlockedPopEntrySList(IN OUT PSLIST_HEADER ListHead);
+//
+// The PAL has no interlocked SList. The functions below use the header as a
+// list head, a depth and a spin lock instead. The lists are only shared with
+// a background GC thread and each operation holds the lock for a few
+// instructions, so a lock-free list would not buy much here.
+//
+typedef struct _SLIST_HEADER_DATA {
+  PSLIST_ENTRY Next;
+  WORD Depth;
+  WORD Lock;
+} SLIST_HEADER_DATA, *PSLIST_HEADER_DATA;
+
+static_assert(sizeof(SLIST_HEADER_DATA) <= sizeof(SLIST_HEADER), "SLIST_HEADER_DATA must fit in SLIST_HEADER");
+
+inline PSLIST_HEADER_DATA SListLock(IN OUT PSLIST_HEADER ListHead)
+{
+  PSLIST_HEADER_DATA data = (PSLIST_HEADER_DATA)ListHead;
+  while (__sync_lock_test_and_set(&data->Lock, 1) != 0)
+  {
+    while (data->Lock != 0)
+    {
+      YieldProcessor();
+    }
+  }
+  return data;
+}
+
+inline void SListUnlock(IN OUT PSLIST_HEADER_DATA data)
+{
+  __sync_lock_release(&data->Lock);
+}
+
+inline VOID InitializeSListHead(IN OUT PSLIST_HEADER ListHead)
+{
+  memset(ListHead, 0, sizeof(SLIST_HEADER));
+}
+
+inline PSLIST_ENTRY InterlockedPushEntrySList(IN OUT PSLIST_HEADER ListHead, IN OUT PSLIST_ENTRY ListEntry)
+{
+  PSLIST_HEADER_DATA data = SListLock(ListHead);
+  PSLIST_ENTRY first = data->Next;
+  ListEntry->Next = first;
+  data->Next = ListEntry;
+  data->Depth++;
+  SListUnlock(data);
+  return first;
+}
+
+inline PSLIST_ENTRY InterlockedPopEntrySList(IN OUT PSLIST_HEADER ListHead)
+{
+  PSLIST_HEADER_DATA data = SListLock(ListHead);
+  PSLIST_ENTRY first = data->Next;
+  if (first != NULL)
+  {
+    data->Next = first->Next;
+    data->Depth--;
+  }
+  SListUnlock(data);
+  return first;
+}
+
+inline PSLIST_ENTRY InterlockedFlushSList(IN OUT PSLIST_HEADER ListHead)
+{
+  PSLIST_HEADER_DATA data = SListLock(ListHead);
+  PSLIST_ENTRY first = data->Next;
+  data->Next = NULL;
+  data->Depth = 0;
+  SListUnlock(data);
+  return first;
+}
+
+inline USHORT QueryDepthSList(IN PSLIST_HEADER ListHead)
+{
+  return ((volatile SLIST_HEADER_DATA *)ListHead)->Depth;
+}
 
 
 template <class T>
@@ -677,4 +749,5 @@ namespace PlatformAgnostic
 #include "PlatformAgnostic/DateTime.h"
 #include "PlatformAgnostic/Numbers.h"
 #include "PlatformAgnostic/SystemInfo.h"
+#include "PlatformAgnostic/SamplingTimer.h"
 #include "PlatformAgnostic/Thread.h"
@@ -306,6 +306,9 @@ PHASE(All)
             PHASE(ObjectHeaderInliningForObjectLiterals)
             PHASE(ObjectHeaderInliningForEmptyObjects)
         PHASE(OptUnknownElementName)
+        PHASE(MegamorphicPropertyCache)
+        PHASE(StringKeyedElementFastPath)
+        PHASE(PropertyRecordStringCache)
 #if DBG_DUMP
         PHASE(TypePropertyCache)
         PHASE(InlineSlots)
@@ -626,6 +629,7 @@ PHASE(All)
 #define DEFAULT_CONFIG_MaxLinearStringCaseCount (4)     // Maximum number of String cases (in switch statement) for which instructions can be generated linearly.
 
 #define DEFAULT_CONFIG_MinDeferredFuncTokenCount (20)   // Minimum size in tokens of a defer-parsed function
+#define DEFAULT_CONFIG_ParallelParseThreshold (0)      // Minimum size in characters of a script whose top-level functions are parsed in parallel
 
 #if DBG
 #define DEFAULT_CONFIG_SkipFuncCountForBailOnNoProfile (0) //Initial Number of functions in a func body to be skipped from forcibly inserting BailOnNoProfile.
@@ -715,6 +719,10 @@ PHASE(All)
 #define DEFAULT_CONFIG_ZeroMemoryWithNonTemporalStore (true)
 #endif
 
+#if ENABLE_TRANSPARENT_HUGE_PAGES
+#define DEFAULT_CONFIG_TransparentHugePages (false)
+#endif
+
 #define TraceLevel_Error        (1)
 #define TraceLevel_Warning      (2)
 #define TraceLevel_Info         (3)
@@ -1067,7 +1075,7 @@ FLAGNR(Number,  ForceOOMOnEBCommit, "Force CommitBuffer to return OOM", 0)
 FLAGR (Boolean, ForceDynamicProfile   , "Force to always generate profiling byte code", DEFAULT_CONFIG_ForceDynamicProfile)
 FLAGNR(Boolean, ForceES5Array         , "Force using ES5Array", DEFAULT_CONFIG_ForceES5Array)
 FLAGNR(Boolean, ForceAsmJsLinkFail    , "Force asm.js link time validation to fail", DEFAULT_CONFIG_ForceAsmJsLinkFail)
-FLAGNR(Boolean, ForceExpireOnNonCacheCollect, "Allow expiration collect outside of cache collection cleanups", DEFAULT_CONFIG_ForceExpireOnNonCacheCollect)
+FLAGR (Boolean, ForceExpireOnNonCacheCollect, "Allow expiration collect outside of cache collection cleanups", DEFAULT_CONFIG_ForceExpireOnNonCacheCollect)
 FLAGNR(Boolean, ForceFastPath         , "Force fast-paths in native codegen", DEFAULT_CONFIG_ForceFastPath)
 FLAGNR(Boolean, ForceFloatPref        , "Force float preferencing (JIT only)", false)
 FLAGNR(Boolean, ForceJITLoopBody      , "Force jit loop body only", DEFAULT_CONFIG_ForceJITLoopBody)
@@ -1081,6 +1089,7 @@ FLAGR (Boolean, ForceNative           , "Force JIT everything that is called bef
 FLAGNR(Boolean, ForceSerialized       , "Always serialize and deserialize byte codes before execution", DEFAULT_CONFIG_ForceSerialized)
 FLAGNR(Number,  ForceSerializedBytecodeMajorVersion, "Force the byte code serializer to write this major version number", 0)
 FLAGNR(Number,  ForceSerializedBytecodeVersionSchema, "Force the byte code serializer to write this kind of version. Decimal 10 is engineering, 20 is release mode, and 0 means use the default setting.", 0)
+FLAGNR(Number,  CorruptSharedByteCode , "Damage the byte code a runtime shares across its contexts as it is cached: 1 makes it look like another engine version wrote it. 0 leaves it alone.", 0)
 FLAGNR(Boolean, ForceStrictMode, "Force strict mode checks on all functions", false)
 FLAGNR(Boolean, ForceUndoDefer        , "Defer parsing of all function bodies, but undo deferral", false)
 FLAGNR(Boolean, ForceBlockingConcurrentCollect, "Force doing in-thread GC on concurrent thread- this will skip doing concurrent collect", false)
@@ -1193,6 +1202,7 @@ FLAGNR(Number,  MaxSingleCharStrJumpTableRatio, "Maximum single char string jump
 FLAGNR(Number,  MinSwitchJumpTableSize , "Minimum size of the jump table, that is created for consecutive integer case arms in a Switch Statement",DEFAULT_CONFIG_MinSwitchJumpTableSize)
 FLAGNR(Number,  MaxLinearStringCaseCount,  "Maximum number of string cases(in switch statement) for which instructions can be generated linearly",DEFAULT_CONFIG_MaxLinearStringCaseCount)
 FLAGR(Number,   MinDeferredFuncTokenCount, "Minimum length in tokens of defer-parsed function", DEFAULT_CONFIG_MinDeferredFuncTokenCount)
+FLAGR(Number,   ParallelParseThreshold, "Minimum length in characters of a script whose top-level functions are parsed eagerly on background threads (0 to disable)", DEFAULT_CONFIG_ParallelParseThreshold)
 #if DBG
 FLAGNR(Number,  SkipFuncCountForBailOnNoProfile,  "Initial Number of functions in a func body to be skipped from forcibly inserting BailOnNoProfile.", DEFAULT_CONFIG_SkipFuncCountForBailOnNoProfile)
 #endif
@@ -1437,6 +1447,9 @@ FLAGNR(Number,  MinBackgroundRepeatMarkRescanBytes, "Minimum number of bytes res
 #if defined(_M_IX86) || defined(_M_X64)
 FLAGNR(Boolean, ZeroMemoryWithNonTemporalStore, "Zero free memory with non-temporal stores to avoid evicting other content from processor cache", DEFAULT_CONFIG_ZeroMemoryWithNonTemporalStore)
 #endif
+#if ENABLE_TRANSPARENT_HUGE_PAGES
+FLAGR(Boolean, TransparentHugePages, "Allocate the recycler's heap in huge page segments that the OS can back with transparent huge pages", DEFAULT_CONFIG_TransparentHugePages)
+#endif
 
 // recycler memory restrict test flags
 FLAGNR(Number,  MaxMarkStackPageCount , "Restrict recycler mark stack size (in pages)", -1)
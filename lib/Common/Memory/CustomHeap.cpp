@@ -812,7 +812,21 @@ bool Heap::FreeAllocation(Allocation* object)
         FreeAllocationHelper(object, index, length);
         Assert(page->IsEmpty());
 
+        // Nothing else lives on this page any more- hand it back to the page allocator
+        // so that code freed by entry point expiration doesn't stay committed
+        void* pageAddress = page->address;
+
         this->buckets[page->currentBucket].RemoveElement(this->auxiliaryAllocator, page);
+
+#if DBG_DUMP
+        this->freeObjectSize -= pageSize;
+        this->totalAllocationSize -= pageSize;
+#endif
+        {
+            CodePageAllocators::AutoLock autoLock(this->codePageAllocators);
+            this->codePageAllocators->ReleasePages(pageAddress, 1, segment);
+        }
+        VerboseHeapTrace(_u("Released empty page 0x%p\n"), pageAddress);
         return false;
     }
     else
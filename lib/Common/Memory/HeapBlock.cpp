@@ -1766,7 +1766,6 @@ void SmallHeapBlockT<TBlockAttributes>::Verify(bool pendingDispose)
 }
 #endif
 
-#ifdef DUMP_FRAGMENTATION_STATS
 template <class TBlockAttributes>
 void
 SmallHeapBlockT<TBlockAttributes>::AggregateBlockStats(HeapBucketStats& stats, bool isAllocatorBlock, FreeObject* freeObjectList, bool isBumpAllocated)
@@ -1823,7 +1822,7 @@ SmallHeapBlockT<TBlockAttributes>::AggregateBlockStats(HeapBucketStats& stats, b
     // Don't count empty blocks as allocable
     if (this->segment != nullptr)
     {
-        stats.totalByteCount += AutoSystemInfo::PageSize;
+        stats.totalByteCount += (uint)(this->GetPageCount() * AutoSystemInfo::PageSize);
     }
 
     stats.objectCount += objectCount;
@@ -1840,7 +1839,6 @@ SmallHeapBlockT<TBlockAttributes>::AggregateBlockStats(HeapBucketStats& stats, b
         }
     }
 }
-#endif
 
 #ifdef RECYCLER_PERF_COUNTERS
 template <class TBlockAttributes>
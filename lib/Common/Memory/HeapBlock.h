@@ -37,7 +37,6 @@ template <typename TBlockType> class HeapBucketT;
 class  RecyclerSweep;
 class MarkContext;
 
-#ifdef DUMP_FRAGMENTATION_STATS
 struct HeapBucketStats
 {
     uint totalBlockCount;
@@ -48,7 +47,6 @@ struct HeapBucketStats
     uint objectByteCount;
     uint totalByteCount;
 };
-#endif
 
 #if defined(PROFILE_RECYCLER_ALLOC) || defined(RECYCLER_MEMORY_VERIFY) || defined(MEMSPECT_TRACKING) || defined(RECYCLER_PERF_COUNTERS) || defined(ETW_MEMORY_TRACKING)
 #define RECYCLER_TRACK_NATIVE_ALLOCATED_OBJECTS
@@ -486,9 +484,7 @@ public:
     void InduceFalsePositive(Recycler * recycler);
 #endif
 
-#ifdef DUMP_FRAGMENTATION_STATS
     void AggregateBlockStats(HeapBucketStats& stats, bool isAllocatorBlock = false, FreeObject* freeObjectList = nullptr, bool isBumpAllocated = false);
-#endif
 
     /*
     * Quick description of the bit vectors
@@ -418,7 +418,7 @@ HeapBucketT<TBlockType>::SnailAlloc(Recycler * recycler, TBlockAllocatorType * a
     AllocationVerboseTrace(recycler->GetRecyclerFlagsTable(), _u("TryAlloc failed, forced collection on allocation [Collected: %d]\n"), collected);
     if (!collected)
     {
-#if ENABLE_CONCURRENT_GC
+#if ENABLE_CONCURRENT_GC && ENABLE_PARTIAL_GC
         // wait for background sweeping finish if there are too many pages allocated during background sweeping
         if (recycler->IsConcurrentSweepExecutingState() && this->heapInfo->uncollectedNewPageCount > (uint)CONFIG_FLAG(NewPagesCapDuringBGSweeping))
         {
@@ -1089,7 +1089,6 @@ HeapBucketT<TBlockType>::Check(bool checkCount)
 }
 #endif
 
-#ifdef DUMP_FRAGMENTATION_STATS
 template <typename TBlockType>
 void
 HeapBucketT<TBlockType>::AggregateBucketStats(HeapBucketStats& stats)
@@ -1115,7 +1114,6 @@ HeapBucketT<TBlockType>::AggregateBucketStats(HeapBucketStats& stats)
     HeapBlockList::ForEach(fullBlockList, blockStatsAggregator);
     HeapBlockList::ForEach(heapBlockList, blockStatsAggregator);
 }
-#endif
 
 #ifdef RECYCLER_MEMORY_VERIFY
 template <typename TBlockType>
@@ -1314,6 +1312,19 @@ HeapBucketGroup<TBlockAttributes>::EnumerateObjects(ObjectInfoBits infoBits, voi
     finalizableHeapBucket.EnumerateObjects(infoBits, CallBackFunction);
 }
 
+template <class TBlockAttributes>
+void
+HeapBucketGroup<TBlockAttributes>::AggregateBucketStats(HeapBucketStats& stats)
+{
+    heapBucket.AggregateBucketStats(stats);
+    leafHeapBucket.AggregateBucketStats(stats);
+#ifdef RECYCLER_WRITE_BARRIER
+    smallNormalWithBarrierHeapBucket.AggregateBucketStats(stats);
+    smallFinalizableWithBarrierHeapBucket.AggregateBucketStats(stats);
+#endif
+    finalizableHeapBucket.AggregateBucketStats(stats);
+}
+
 template <class TBlockAttributes>
 void
 HeapBucketGroup<TBlockAttributes>::FinalizeAllObjects()
@@ -138,9 +138,7 @@ public:
     void ResetMarks(ResetMarkFlags flags);
     void ScanNewImplicitRoots(Recycler * recycler);
 
-#ifdef DUMP_FRAGMENTATION_STATS
     void AggregateBucketStats(HeapBucketStats& stats);
-#endif
     uint Rescan(Recycler * recycler, RescanFlags flags);
 #if ENABLE_CONCURRENT_GC
     void MergeNewHeapBlock(TBlockType * heapBlock);
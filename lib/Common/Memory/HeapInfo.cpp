@@ -1048,6 +1048,36 @@ void DumpBucket(uint bucketIndex, typename SmallHeapBlockType<TBucketType, TBloc
     Output::Print(_u("%d,%d,%d,%d,%d,%d,%d\n"), stats.totalBlockCount, stats.finalizeBlockCount, stats.emptyBlockCount, stats.objectCount, stats.finalizeCount, stats.objectByteCount, stats.totalByteCount);
 }
 
+uint
+HeapInfo::GetSizeClassCount()
+{
+#if defined(BUCKETIZE_MEDIUM_ALLOCATIONS) && SMALLBLOCK_MEDIUM_ALLOC
+    return HeapConstants::BucketCount + HeapConstants::MediumBucketCount;
+#else
+    return HeapConstants::BucketCount;
+#endif
+}
+
+uint
+HeapInfo::AggregateSizeClassStats(uint sizeClassIndex, HeapBucketStats& stats)
+{
+    Assert(sizeClassIndex < GetSizeClassCount());
+
+    if (sizeClassIndex < HeapConstants::BucketCount)
+    {
+        heapBuckets[sizeClassIndex].AggregateBucketStats(stats);
+        return HeapInfo::GetObjectSizeForBucketIndex<SmallAllocationBlockAttributes>(sizeClassIndex);
+    }
+
+#if defined(BUCKETIZE_MEDIUM_ALLOCATIONS) && SMALLBLOCK_MEDIUM_ALLOC
+    uint mediumBucketIndex = sizeClassIndex - HeapConstants::BucketCount;
+    mediumHeapBuckets[mediumBucketIndex].AggregateBucketStats(stats);
+    return HeapInfo::GetObjectSizeForBucketIndex<MediumAllocationBlockAttributes>(mediumBucketIndex);
+#else
+    return 0;
+#endif
+}
+
 #ifdef DUMP_FRAGMENTATION_STATS
 void
 HeapInfo::DumpFragmentationStats()
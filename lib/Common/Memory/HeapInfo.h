@@ -50,6 +50,11 @@ public:
     void DumpFragmentationStats();
 #endif
 
+    // Occupancy of the small and medium size classes, the small ones first. AggregateSizeClassStats returns the object
+    // size of the size class.
+    static uint GetSizeClassCount();
+    uint AggregateSizeClassStats(uint sizeClassIndex, HeapBucketStats& stats);
+
     template <ObjectInfoBits attributes, bool nothrow>
     char * MediumAlloc(Recycler * recycler, size_t sizeCat, size_t size);
 
@@ -103,6 +103,13 @@ SegmentBase<T>::Initialize(DWORD allocFlags, bool excludeGuardPages)
         return false;
     }
 
+#if ENABLE_TRANSPARENT_HUGE_PAGES
+    if (this->GetAllocator()->hugePageSegments)
+    {
+        allocFlags |= MEM_LARGE_PAGES;
+    }
+#endif
+
     this->address = (char *)GetAllocator()->GetVirtualAllocator()->Alloc(NULL, totalPages * AutoSystemInfo::PageSize, MEM_RESERVE | allocFlags, PAGE_READWRITE, this->IsInCustomHeapAllocator(), this->GetAllocator()->processHandle);
 
     if (this->address == nullptr)
@@ -590,6 +597,34 @@ PageAllocatorBase<T>::GetMaxAllocPageCount()
     return maxAllocPageCount;
 }
 
+#if ENABLE_TRANSPARENT_HUGE_PAGES
+// Switch to page segments of one huge page each, without guard pages, reserved so that the OS
+// can back them with transparent huge pages. Only whole segments are decommitted from then on,
+// short of decommitting everything. This must be done before the first segment is allocated.
+template<typename T>
+bool
+PageAllocatorBase<T>::EnableHugePageSegments()
+{
+    Assert(segments.Empty());
+    Assert(fullSegments.Empty());
+    Assert(emptySegments.Empty());
+    Assert(decommitSegments.Empty());
+    Assert(largeSegments.Empty());
+
+    size_t hugePageCount = ::GetLargePageMinimum() / AutoSystemInfo::PageSize;
+    if (hugePageCount == 0 || hugePageCount > PageSegmentBase<T>::MaxDataPageCount ||
+        this->secondaryAllocPageCount != 0 || this->processHandle != GetCurrentProcess())
+    {
+        return false;
+    }
+
+    this->maxAllocPageCount = (uint)hugePageCount;
+    this->excludeGuardPages = true;
+    this->hugePageSegments = true;
+    return true;
+}
+#endif
+
 template<typename T>
 PageAllocatorBase<T>::PageAllocatorBase(AllocationPolicyManager * policyManager,
 #ifndef JD_PRIVATE
@@ -623,6 +658,9 @@ PageAllocatorBase<T>::PageAllocatorBase(AllocationPolicyManager * policyManager,
     disableAllocationOutOfMemory(false),
     secondaryAllocPageCount(secondaryAllocPageCount),
     excludeGuardPages(excludeGuardPages),
+#if ENABLE_TRANSPARENT_HUGE_PAGES
+    hugePageSegments(false),
+#endif
     type(type)
     , reservedBytes(0)
     , committedBytes(0)
@@ -1546,7 +1584,13 @@ PageAllocatorBase<T>::ReleasePages(__in void * address, uint pageCount, __in voi
      *  Now that we've either decommitted or freed the pages in the segment,
      *  move the segment to the right segment list
      */
-    if (this->freePageCount + pageCount > maxFreePageCount)
+    if (this->freePageCount + pageCount > maxFreePageCount
+#if ENABLE_TRANSPARENT_HUGE_PAGES
+        // Decommitting part of a huge page segment would split its huge pages, so
+        // those pages are kept free until DecommitNow can release segments whole
+        && (!this->hugePageSegments || (!ZeroPages() && !emptySegments.Empty()))
+#endif
+        )
     {
         // Release a whole segment if possible to reduce the number of VirtualFree and fragmentation
         if (!ZeroPages() && !emptySegments.Empty())
@@ -1933,6 +1977,13 @@ PageAllocatorBase<T>::DecommitNow(bool all)
 
     // decommit pages that are empty
 
+#if ENABLE_TRANSPARENT_HUGE_PAGES
+    // Short of decommitting everything, only release huge page segments whole
+    const bool decommitPartialSegments = all || !this->hugePageSegments;
+#else
+    const bool decommitPartialSegments = true;
+#endif
+
     while (pageToDecommit > 0 && !emptySegments.Empty())
     {
         if (pageToDecommit >= maxAllocPageCount)
@@ -1947,6 +1998,10 @@ PageAllocatorBase<T>::DecommitNow(bool all)
             deleteCount += maxAllocPageCount;
 #endif
         }
+        else if (!decommitPartialSegments)
+        {
+            break;
+        }
         else
         {
             size_t pageDecommitted = emptySegments.Head().DecommitFreePages(pageToDecommit);
@@ -1960,6 +2015,7 @@ PageAllocatorBase<T>::DecommitNow(bool all)
         }
     }
 
+    if (decommitPartialSegments)
     {
         typename DListBase<PageSegmentBase<T>>::EditingIterator i(&segments);
 
@@ -1979,7 +2035,9 @@ PageAllocatorBase<T>::DecommitNow(bool all)
     }
 
 
-    Assert(pageToDecommit == 0);
+    Assert(pageToDecommit == 0 || !decommitPartialSegments);
+
+    newFreePageCount += pageToDecommit;
 
 #if DBG_DUMP
     Assert(this->freePageCount == newFreePageCount + decommitCount);
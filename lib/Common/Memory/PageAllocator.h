@@ -230,9 +230,13 @@ public:
     PageSegmentBase(PageAllocatorBase<TVirtualAlloc> * allocator, bool committed, bool allocated);
     PageSegmentBase(PageAllocatorBase<TVirtualAlloc> * allocator, void* address, uint pageCount, uint committedCount);
     // Maximum possible size of a PageSegment; may be smaller.
+#if ENABLE_TRANSPARENT_HUGE_PAGES
+    static const uint MaxDataPageCount = 512;     // 2 MB, one huge page
+#else
     static const uint MaxDataPageCount = 256;     // 1 MB
+#endif
     static const uint MaxGuardPageCount = 16;
-    static const uint MaxPageCount = MaxDataPageCount + MaxGuardPageCount;  // 272 Pages
+    static const uint MaxPageCount = MaxDataPageCount + MaxGuardPageCount;  // 272 Pages (528 with huge page segments)
 
     typedef BVStatic<MaxPageCount> PageBitVector;
 
@@ -525,6 +529,9 @@ public:
     AllocationPolicyManager * GetAllocationPolicyManager() { return policyManager; }
 
     uint GetMaxAllocPageCount();
+#if ENABLE_TRANSPARENT_HUGE_PAGES
+    bool EnableHugePageSegments();
+#endif
 
     //VirtualAllocator APIs
     TVirtualAlloc * GetVirtualAllocator() const;
@@ -680,6 +687,9 @@ protected:
     bool stopAllocationOnOutOfMemory;
     bool disableAllocationOutOfMemory;
     bool excludeGuardPages;
+#if ENABLE_TRANSPARENT_HUGE_PAGES
+    bool hugePageSegments;
+#endif
     AllocationPolicyManager * policyManager;
 
 #ifndef JD_PRIVATE
@@ -282,6 +282,13 @@ Recycler::Recycler(AllocationPolicyManager * policyManager, IdleDecommitPageAllo
 
     this->inDispose = false;
 
+    memset(&this->collectionStatistics, 0, sizeof(this->collectionStatistics));
+    memset(&this->currentCollectionStatistics, 0, sizeof(this->currentCollectionStatistics));
+    this->pauseStartTime = 0;
+    this->isInPause = false;
+    this->isInPausePhase = false;
+    this->isRecordingCollectionStatistics = false;
+
 #if DBG
     this->heapBlockCount = 0;
     this->collectionCount = 0;
@@ -826,6 +833,19 @@ Recycler::Initialize(const bool forceInThread, JsUtil::ThreadService *threadServ
 #endif
 #endif
 
+#if ENABLE_TRANSPARENT_HUGE_PAGES
+    if (GetRecyclerFlagsTable().TransparentHugePages)
+    {
+        // Must happen before any segment is allocated; the allocators fall back to regular
+        // segments if the OS doesn't report a usable huge page size
+        recyclerPageAllocator.EnableHugePageSegments();
+        recyclerLargeBlockPageAllocator.EnableHugePageSegments();
+#ifdef RECYCLER_WRITE_BARRIER_ALLOC_SEPARATE_PAGE
+        recyclerWithBarrierPageAllocator.EnableHugePageSegments();
+#endif
+    }
+#endif
+
     bool needWriteWatch = false;
 
 #if ENABLE_CONCURRENT_GC
@@ -1562,6 +1582,18 @@ Recycler::ScanStack()
 }
 #pragma warning(pop)
 
+#pragma warning(push)
+#pragma warning(disable:4731) // 'pointer' : frame pointer register 'register' modified by inline assembly code
+// Saves the registers of the thread for walks of the heap that scan the registers and the stack like ScanStack does,
+// and returns the base of the stack
+void *
+Recycler::SaveThreadContext()
+{
+    SAVE_THREAD_CONTEXT();
+    return GetStackBase();
+}
+#pragma warning(pop)
+
 template <bool background>
 size_t Recycler::ScanPinnedObjects()
 {
@@ -2046,6 +2078,8 @@ Recycler::ProcessParallelMark(bool background, MarkContext * markContext)
 void
 Recycler::Mark()
 {
+    AutoRecordPause autoRecordPause(this, &RecyclerCollectionStatistics::markPauseMicroseconds);
+
     // Marking in thread, we can just pre-mark them
     ResetMarks(this->enableScanImplicitRoots ? ResetMarkFlags_InThreadImplicitRoots : ResetMarkFlags_InThread);
     collectionState = CollectionStateFindRoots;
@@ -2243,6 +2277,8 @@ Recycler::RescanMark(DWORD waitTime)
 size_t
 Recycler::FinishMark(DWORD waitTime)
 {
+    AutoRecordPause autoRecordPause(this, &RecyclerCollectionStatistics::markPauseMicroseconds);
+
     size_t scannedRootBytes = RescanMark(waitTime);
     Assert(waitTime != INFINITE || scannedRootBytes != Recycler::InvalidScanRootBytes);
     if (scannedRootBytes != Recycler::InvalidScanRootBytes)
@@ -2543,6 +2579,8 @@ Recycler::EndMarkCheckOOMRescan()
 bool
 Recycler::EndMark()
 {
+    AutoRecordPause autoRecordPause(this, &RecyclerCollectionStatistics::markPauseMicroseconds);
+
 #if ENABLE_CONCURRENT_GC
     Assert(!this->DoQueueTrackedObject());
 #endif
@@ -2780,6 +2818,8 @@ bool
 Recycler::Sweep(bool concurrent)
 #endif
 {
+    AutoRecordPause autoRecordPause(this, &RecyclerCollectionStatistics::sweepPauseMicroseconds);
+
 #if ENABLE_PARTIAL_GC && ENABLE_CONCURRENT_GC
     Assert(!this->hasBackgroundFinishPartial);
 #endif
@@ -3491,6 +3531,7 @@ Recycler::DoCollectWrapped(CollectionFlags flags)
 #endif
 
     this->allowDispose = (flags & CollectOverride_AllowDispose) == CollectOverride_AllowDispose;
+    AutoRecordPause autoRecordPause(this);
     BOOL collected = collectionWrapper->ExecuteRecyclerCollectionFunction(this, &Recycler::DoCollect, flags);
 
 #if ENABLE_CONCURRENT_GC
@@ -3605,6 +3646,12 @@ Recycler::DoCollect(CollectionFlags flags)
         collectionWrapper->PreCollectionCallBack(flags);
         collectionState = CollectionStateNotCollecting;
 
+#if ENABLE_PARTIAL_GC
+        this->BeginCollectionStatistics(!!partial, concurrent);
+#else
+        this->BeginCollectionStatistics(false, concurrent);
+#endif
+
         hasExhaustiveCandidate = false;         // reset the candidate detection
 
 #ifdef RECYCLER_STATS
@@ -4620,6 +4667,14 @@ Recycler::EnableConcurrent(JsUtil::ThreadService *threadService, bool startAllTh
     this->enableConcurrentSweep = true;
 #endif
 
+#ifndef _WIN32
+    // Off Windows, write watch reports every committed page as written (see GetWriteWatch in the PAL),
+    // so the rescan that finishes a background mark would redo all of it in the foreground.
+    // Mark in thread (in parallel) and only sweep concurrently, unless concurrent mark is forced.
+    this->enableConcurrentMark = this->enableConcurrentMark
+        && CUSTOM_PHASE_FORCE1(GetRecyclerFlagsTable(), Js::ConcurrentMarkPhase);
+#endif
+
     if (this->enableParallelMark && this->maxParallelism == 1)
     {
         // Disable parallel mark if only 1 CPU
@@ -5193,6 +5248,7 @@ Recycler::FinishConcurrentCollectWrapped(CollectionFlags flags)
     this->skipStack = ((flags & CollectOverride_SkipStack) != 0);
     DebugOnly(this->isConcurrentGCOnIdle = (flags == CollectOnScriptIdle));
 #endif
+    AutoRecordPause autoRecordPause(this);
     BOOL collected = collectionWrapper->ExecuteRecyclerCollectionFunction(this, &Recycler::FinishConcurrentCollect, flags);
     return collected;
 }
@@ -5442,6 +5498,7 @@ Recycler::FinishConcurrentCollect(CollectionFlags flags)
     return true;
 }
 
+#ifndef DISABLE_SEH
 int
 Recycler::ExceptFilter(LPEXCEPTION_POINTERS pEP)
 {
@@ -5472,24 +5529,30 @@ Recycler::ExceptFilter(LPEXCEPTION_POINTERS pEP)
     return EXCEPTION_CONTINUE_SEARCH;
 
 }
+#endif
 
 unsigned int
 Recycler::StaticThreadProc(LPVOID lpParameter)
 {
     DWORD ret = (DWORD)-1;
-    __try
-    {
-        Recycler * recycler = (Recycler *)lpParameter;
+    Recycler * recycler = (Recycler *)lpParameter;
 
 #if DBG
-        recycler->concurrentThreadExited = false;
+    recycler->concurrentThreadExited = false;
 #endif
+
+#ifdef DISABLE_SEH
+    ret = recycler->ThreadProc();
+#else
+    __try
+    {
         ret = recycler->ThreadProc();
     }
     __except(Recycler::ExceptFilter(GetExceptionInformation()))
     {
         Assert(false);
     }
+#endif
 
     return ret;
 }
@@ -5777,6 +5840,8 @@ Recycler::FinishCollection()
     // Reset the time heuristics
     ScheduleNextCollection();
 
+    this->EndCollectionStatistics();
+
     {
         AutoSwitchCollectionStates collectionState(this,
             /* entry  state */ CollectionStatePostCollectionCallback,
@@ -5841,6 +5906,119 @@ Recycler::FinishCollection()
     RECORD_TIMESTAMP(currentCollectionEndTime);
 }
 
+uint64
+Recycler::GetPauseTimestamp()
+{
+    LARGE_INTEGER frequency;
+    LARGE_INTEGER counter;
+    if (!QueryPerformanceFrequency(&frequency) || frequency.QuadPart == 0 || !QueryPerformanceCounter(&counter))
+    {
+        return 0;
+    }
+
+    // Split the conversion so that the multiplication doesn't overflow
+    const uint64 ticks = (uint64)counter.QuadPart;
+    const uint64 ticksPerSecond = (uint64)frequency.QuadPart;
+    return (ticks / ticksPerSecond) * 1000000 + (ticks % ticksPerSecond) * 1000000 / ticksPerSecond;
+}
+
+void
+Recycler::BeginCollectionStatistics(bool isPartial, bool isConcurrent)
+{
+    RecyclerCollectionStatistics& statistics = this->currentCollectionStatistics;
+    statistics.isPartial = isPartial;
+    statistics.isConcurrent = isConcurrent;
+    statistics.markPauseMicroseconds = 0;
+    statistics.sweepPauseMicroseconds = 0;
+    statistics.pauseMicroseconds = 0;
+    statistics.allocatedBytes = autoHeap.uncollectedAllocBytes;
+    statistics.usedBytesBefore = this->GetUsedBytes();
+    statistics.usedBytesAfter = 0;
+    this->isRecordingCollectionStatistics = true;
+
+    // Disposing objects before the collection started is not part of its pause
+    if (this->isInPause)
+    {
+        this->pauseStartTime = GetPauseTimestamp();
+    }
+}
+
+void
+Recycler::EndCollectionStatistics()
+{
+    if (!this->isRecordingCollectionStatistics)
+    {
+        return;
+    }
+    this->isRecordingCollectionStatistics = false;
+
+    RecyclerCollectionStatistics& statistics = this->currentCollectionStatistics;
+    if (this->isInPause)
+    {
+        statistics.pauseMicroseconds += GetPauseTimestamp() - this->pauseStartTime;
+    }
+    statistics.usedBytesAfter = this->GetUsedBytes();
+    statistics.collectionCount = this->collectionStatistics.collectionCount + 1;
+    statistics.totalPauseMicroseconds = this->collectionStatistics.totalPauseMicroseconds + statistics.pauseMicroseconds;
+    statistics.maxPauseMicroseconds = max(this->collectionStatistics.maxPauseMicroseconds, statistics.pauseMicroseconds);
+
+    this->collectionStatistics = statistics;
+}
+
+Recycler::AutoRecordPause::AutoRecordPause(Recycler* recycler, uint64 RecyclerCollectionStatistics::* phase) :
+    _recycler(recycler),
+    _phase(phase),
+    _startTime(0),
+    _isActive(false)
+{
+    if (phase == nullptr)
+    {
+        _isActive = !recycler->isInPause;
+        recycler->isInPause = true;
+    }
+    else
+    {
+        _isActive = recycler->isInPause && recycler->isRecordingCollectionStatistics && !recycler->isInPausePhase;
+        recycler->isInPausePhase = recycler->isInPausePhase || _isActive;
+    }
+
+    if (_isActive)
+    {
+        _startTime = GetPauseTimestamp();
+        if (phase == nullptr)
+        {
+            recycler->pauseStartTime = _startTime;
+        }
+    }
+}
+
+Recycler::AutoRecordPause::~AutoRecordPause()
+{
+    if (!_isActive)
+    {
+        return;
+    }
+
+    const uint64 endTime = GetPauseTimestamp();
+    if (_phase == nullptr)
+    {
+        // A collection that is still in progress continues in a later pause
+        if (_recycler->isRecordingCollectionStatistics)
+        {
+            _recycler->currentCollectionStatistics.pauseMicroseconds += endTime - _recycler->pauseStartTime;
+        }
+        _recycler->isInPause = false;
+    }
+    else
+    {
+        if (_recycler->isRecordingCollectionStatistics)
+        {
+            _recycler->currentCollectionStatistics.*_phase += endTime - _startTime;
+        }
+        _recycler->isInPausePhase = false;
+    }
+}
+
 
 char *
 Recycler::Realloc(void* buffer, size_t existingBytes, size_t requestedBytes, bool truncate)
@@ -6159,77 +6337,88 @@ unsigned int
 RecyclerParallelThread::StaticThreadProc(LPVOID lpParameter)
 {
     DWORD ret = (DWORD)-1;
+    RecyclerParallelThread * parallelThread = (RecyclerParallelThread *)lpParameter;
+
+#ifdef DISABLE_SEH
+    ret = parallelThread->ThreadProc();
+#else
     __try
     {
-        RecyclerParallelThread * parallelThread = (RecyclerParallelThread *)lpParameter;
-        Recycler * recycler = parallelThread->recycler;
-        RecyclerParallelThread::WorkFunc workFunc = parallelThread->workFunc;
+        ret = parallelThread->ThreadProc();
+    }
+    __except(Recycler::ExceptFilter(GetExceptionInformation()))
+    {
+        Assert(false);
+    }
+#endif
 
-        Assert(recycler->IsConcurrentEnabled());
+    return ret;
+}
+
+DWORD
+RecyclerParallelThread::ThreadProc()
+{
+    RecyclerParallelThread * parallelThread = this;
+    Recycler * recycler = parallelThread->recycler;
+    RecyclerParallelThread::WorkFunc workFunc = parallelThread->workFunc;
+
+    Assert(recycler->IsConcurrentEnabled());
 
 #if !defined(_UCRT)
-        HMODULE dllHandle = NULL;
-        if (!GetModuleHandleEx(GET_MODULE_HANDLE_EX_FLAG_FROM_ADDRESS, (LPCTSTR)&RecyclerParallelThread::StaticThreadProc, &dllHandle))
-        {
-            dllHandle = NULL;
-        }
+    HMODULE dllHandle = NULL;
+    if (!GetModuleHandleEx(GET_MODULE_HANDLE_EX_FLAG_FROM_ADDRESS, (LPCTSTR)&RecyclerParallelThread::StaticThreadProc, &dllHandle))
+    {
+        dllHandle = NULL;
+    }
 #endif
 #ifdef ENABLE_JS_ETW
-        // Create an ETW ActivityId for this thread, to help tools correlate ETW events we generate
-        GUID activityId = { 0 };
-        auto eventActivityIdControlResult = EventActivityIdControl(EVENT_ACTIVITY_CTRL_CREATE_SET_ID, &activityId);
-        Assert(eventActivityIdControlResult == ERROR_SUCCESS);
+    // Create an ETW ActivityId for this thread, to help tools correlate ETW events we generate
+    GUID activityId = { 0 };
+    auto eventActivityIdControlResult = EventActivityIdControl(EVENT_ACTIVITY_CTRL_CREATE_SET_ID, &activityId);
+    Assert(eventActivityIdControlResult == ERROR_SUCCESS);
 #endif
 
-        // If this thread is created on demand we already have work to process and do not need to wait
-        bool mustWait = parallelThread->synchronizeOnStartup;
+    // If this thread is created on demand we already have work to process and do not need to wait
+    bool mustWait = parallelThread->synchronizeOnStartup;
 
-        do
+    do
+    {
+        if (mustWait)
         {
-            if (mustWait)
-            {
-                // Signal completion and wait for next work
-                SetEvent(parallelThread->concurrentWorkDoneEvent);
-                DWORD result = WaitForSingleObject(parallelThread->concurrentWorkReadyEvent, INFINITE);
-                Assert(result == WAIT_OBJECT_0);
-            }
+            // Signal completion and wait for next work
+            SetEvent(parallelThread->concurrentWorkDoneEvent);
+            DWORD result = WaitForSingleObject(parallelThread->concurrentWorkReadyEvent, INFINITE);
+            Assert(result == WAIT_OBJECT_0);
+        }
 
-            if (recycler->collectionState == CollectionStateExit)
-            {
-                // Exit thread
-                break;
-            }
+        if (recycler->collectionState == CollectionStateExit)
+        {
+            // Exit thread
+            break;
+        }
 
-            // Invoke the workFunc to do real work
-            (recycler->*workFunc)();
+        // Invoke the workFunc to do real work
+        (recycler->*workFunc)();
 
-            // We always wait after the first time
-            mustWait = true;
-        }
-        while (true);
+        // We always wait after the first time
+        mustWait = true;
+    }
+    while (true);
 
-        // Signal to main thread that we have stopped processing and will shut down.
-        // Note that after this point, we cannot access anything on the Recycler instance
-        // because the main thread may have torn it down already.
-        SetEvent(parallelThread->concurrentWorkDoneEvent);
+    // Signal to main thread that we have stopped processing and will shut down.
+    // Note that after this point, we cannot access anything on the Recycler instance
+    // because the main thread may have torn it down already.
+    SetEvent(parallelThread->concurrentWorkDoneEvent);
 
 #if !defined(_UCRT)
-        if (dllHandle)
-        {
-            FreeLibraryAndExitThread(dllHandle, 0);
-        }
-#endif
-        ret = 0;
-    }
-    __except(Recycler::ExceptFilter(GetExceptionInformation()))
+    if (dllHandle)
     {
-        Assert(false);
+        FreeLibraryAndExitThread(dllHandle, 0);
     }
-
-    return ret;
+#endif
+    return 0;
 }
 
-
 // static
 void
 RecyclerParallelThread::StaticBackgroundWorkCallback(void * callbackData)
@@ -396,6 +396,27 @@ private:
 };
 
 
+// Statistics of the last finished collection, kept in all builds so that hosts can monitor collections in production.
+// Pauses are the time spent in the recycler on the thread that owns it. The work that a concurrent collection does on the
+// background threads does not block script and is not counted.
+struct RecyclerCollectionStatistics
+{
+    uint collectionCount;                   // Finished collections, including this one
+    bool isPartial;
+    bool isConcurrent;
+
+    uint64 markPauseMicroseconds;           // Finding roots and marking in thread, including the final rescan
+    uint64 sweepPauseMicroseconds;          // Sweeping in thread
+    uint64 pauseMicroseconds;               // Every pause of the collection, from its start until it finished
+
+    uint64 totalPauseMicroseconds;          // Sum of pauseMicroseconds of all collections
+    uint64 maxPauseMicroseconds;            // Largest pauseMicroseconds of all collections
+
+    size_t allocatedBytes;                  // Allocated since the previous collection
+    size_t usedBytesBefore;                 // Pages in use by the recycler when the collection started
+    size_t usedBytesAfter;                  // Pages in use by the recycler when the collection finished
+};
+
 #ifdef RECYCLER_STATS
 struct RecyclerCollectionStats
 {
@@ -593,6 +614,7 @@ public:
 private:
     // Static entry point for thread creation
     static unsigned int CALLBACK StaticThreadProc(LPVOID lpParameter);
+    DWORD ThreadProc();
 
     // Static entry point for thread service usage
     static void CALLBACK StaticBackgroundWorkCallback(void * callbackData);
@@ -647,6 +669,7 @@ class Recycler
     friend class ActiveScriptProfilerHeapEnum;
 #endif
     friend class ScriptEngineBase;  // This is for disabling GC for certain Host operations.
+    friend class RecyclerHeapSnapshot;
     friend class ::CodeGenNumberThreadAllocator;
     friend struct ::XProcNumberPageSegmentManager;
 public:
@@ -710,6 +733,21 @@ private:
         CollectionState _exitState;
     };
 
+    // Adds the time spent in its scope to the statistics of the collection in progress: the whole pause when
+    // phase is null, or the given phase of the pause otherwise. Nested scopes are not counted again.
+    class AutoRecordPause
+    {
+    public:
+        AutoRecordPause(Recycler* recycler, uint64 RecyclerCollectionStatistics::* phase = nullptr);
+        ~AutoRecordPause();
+
+    private:
+        Recycler* _recycler;
+        uint64 RecyclerCollectionStatistics::* _phase;
+        uint64 _startTime;
+        bool _isActive;
+    };
+
     CollectionState collectionState;
     IdleDecommitPageAllocator * threadPageAllocator;
 #ifdef RECYCLER_WRITE_BARRIER_ALLOC_SEPARATE_PAGE
@@ -1025,6 +1063,13 @@ private:
 #endif
     ThreadContextId mainThreadId;
 
+    RecyclerCollectionStatistics collectionStatistics;
+    RecyclerCollectionStatistics currentCollectionStatistics;
+    uint64 pauseStartTime;
+    bool isInPause;
+    bool isInPausePhase;
+    bool isRecordingCollectionStatistics;
+
 #if DBG
     uint heapBlockCount;
     bool disableThreadAccessCheck;
@@ -1093,6 +1138,10 @@ public:
         return usedBytes;
     }
 
+    const RecyclerCollectionStatistics& GetCollectionStatistics() const { return collectionStatistics; }
+    static uint GetSizeClassCount() { return HeapInfo::GetSizeClassCount(); }
+    uint AggregateSizeClassStats(uint sizeClassIndex, HeapBucketStats& stats) { return autoHeap.AggregateSizeClassStats(sizeClassIndex, stats); }
+
     void LogMemProtectHeapSize(bool fromGC);
 
     char* Realloc(void* buffer, DECLSPEC_GUARD_OVERFLOW size_t existingBytes, DECLSPEC_GUARD_OVERFLOW size_t requestedBytes, bool truncate = true);
@@ -1586,6 +1635,7 @@ private:
     template <bool background>
     size_t ScanPinnedObjects();
     size_t ScanStack();
+    void * SaveThreadContext();
     size_t ScanArena(ArenaData * alloc, bool background);
     void ScanImplicitRoots();
     void ScanInitialImplicitRoots();
@@ -1660,6 +1710,10 @@ private:
     void FinishCollection(bool needConcurrentSweep);
     void EndCollection();
 
+    static uint64 GetPauseTimestamp();
+    void BeginCollectionStatistics(bool isPartial, bool isConcurrent);
+    void EndCollectionStatistics();
+
     void ResetCollectionState();
     void ResetMarkCollectionState();
     void ResetHeuristicCounters();
@@ -1714,7 +1768,9 @@ private:
     void FinalizeConcurrent(bool restoreState);
 
     static unsigned int CALLBACK StaticThreadProc(LPVOID lpParameter);
+#ifndef DISABLE_SEH
     static int ExceptFilter(LPEXCEPTION_POINTERS pEP);
+#endif
     DWORD ThreadProc();
 
     void DoBackgroundWork(bool forceForeground = false);
@@ -0,0 +1,339 @@
+//-------------------------------------------------------------------------------------------------------
+// Copyright (C) Microsoft. All rights reserved.
+// Licensed under the MIT license. See LICENSE.txt file in the project root for full license information.
+//-------------------------------------------------------------------------------------------------------
+#include "CommonMemoryPch.h"
+#include "DataStructures/List.h"
+#include "Memory/RecyclerHeapSnapshot.h"
+
+RecyclerHeapSnapshot::RecyclerHeapSnapshot(Recycler * recycler) :
+    recycler(recycler),
+    autoSetupRecyclerForNonCollectingMark(*recycler, true /* setupForHeapEnumeration */),
+    nodes(&HeapAllocator::Instance),
+    edges(&HeapAllocator::Instance),
+    nodeIndices(&HeapAllocator::Instance)
+{
+    autoSetupRecyclerForNonCollectingMark.SetupForHeapEnumeration();
+}
+
+uint
+RecyclerHeapSnapshot::AddNode(void * address, size_t size, bool isLeaf)
+{
+    Node node;
+    node.address = address;
+    node.size = size;
+    node.retainedSize = 0;
+    node.firstEdge = 0;
+    node.edgeCount = 0;
+    node.isLeaf = isLeaf;
+    return (uint)nodes.Add(node);
+}
+
+void
+RecyclerHeapSnapshot::AddEdge(void * candidate, uint index)
+{
+    // Same filter as the mark
+    if ((size_t)candidate < 0x10000)
+    {
+        return;
+    }
+
+    uint toNode;
+    if (!nodeIndices.TryGetValue(candidate, &toNode))
+    {
+        RecyclerHeapObjectInfo heapObject;
+        if (!recycler->FindHeapObject(candidate, FindHeapObjectFlags_NoFlags, heapObject))
+        {
+            return;
+        }
+
+        toNode = AddNode(candidate, heapObject.GetSize(), heapObject.IsLeaf());
+        nodeIndices.Add(candidate, toNode);
+    }
+
+    Edge edge;
+    edge.toNode = toNode;
+    edge.index = index;
+    edges.Add(edge);
+}
+
+void
+RecyclerHeapSnapshot::AddEdges(void ** references, size_t byteCount, uint * nextIndex)
+{
+    void ** referencesEnd = references + (byteCount / sizeof(void *));
+    for (; references < referencesEnd; references++)
+    {
+        AddEdge(*references, (*nextIndex)++);
+    }
+}
+
+void
+RecyclerHeapSnapshot::AddGuestArenaEdges(ArenaData * arena, uint * nextIndex)
+{
+    for (BigBlock * blockp = arena->GetBigBlocks(false); blockp != nullptr; blockp = blockp->nextBigBlock)
+    {
+        AddEdges((void **)blockp->GetBytes(), blockp->currentByte, nextIndex);
+    }
+    for (BigBlock * blockp = arena->GetFullBlocks(); blockp != nullptr; blockp = blockp->nextBigBlock)
+    {
+        AddEdges((void **)blockp->GetBytes(), blockp->currentByte, nextIndex);
+    }
+    for (ArenaMemoryBlock * blockp = arena->GetMemoryBlocks(); blockp != nullptr; blockp = blockp->next)
+    {
+        AddEdges((void **)blockp->GetBytes(), blockp->nbytes, nextIndex);
+    }
+}
+
+void
+RecyclerHeapSnapshot::SetEdges(uint nodeIndex, uint firstEdge)
+{
+    Node& node = nodes.Item(nodeIndex);
+    node.firstEdge = firstEdge;
+    node.edgeCount = (uint)edges.Count() - firstEdge;
+}
+
+void
+RecyclerHeapSnapshot::AddRootEdges()
+{
+    uint firstEdge = (uint)edges.Count();
+    uint nextIndex = 0;
+    AddEdge(recycler->transientPinnedObject, nextIndex++);
+    recycler->pinnedObjectMap.Map([&](void * obj, Recycler::PinRecord const& refCount)
+    {
+        if (refCount != 0)
+        {
+            AddEdge(obj, nextIndex++);
+        }
+    });
+    SetEdges(FirstRootKindNodeIndex + RootKind_Pinned, firstEdge);
+
+    firstEdge = (uint)edges.Count();
+    nextIndex = 0;
+    DListBase<Recycler::GuestArenaAllocator>::Iterator guestArenaIter(&recycler->guestArenaList);
+    while (guestArenaIter.Next())
+    {
+        Recycler::GuestArenaAllocator& allocator = guestArenaIter.Data();
+#if ENABLE_CONCURRENT_GC
+        if (allocator.pendingDelete)
+        {
+            continue;
+        }
+#endif
+        AddGuestArenaEdges(&allocator, &nextIndex);
+    }
+    DListBase<ArenaData *>::Iterator externalGuestArenaIter(&recycler->externalGuestArenaList);
+    while (externalGuestArenaIter.Next())
+    {
+        AddGuestArenaEdges(externalGuestArenaIter.Data(), &nextIndex);
+    }
+    SetEdges(FirstRootKindNodeIndex + RootKind_GuestArena, firstEdge);
+
+    firstEdge = (uint)edges.Count();
+    nextIndex = 0;
+    if (!recycler->skipStack)
+    {
+        // Scan from this frame up: the frames of the calls made while scanning are below it, and only hold what the
+        // snapshot found.
+        void * stackBase = recycler->SaveThreadContext();
+        void ** stackTop = (void **)&stackBase;
+        Assert(stackBase > stackTop);
+        AddEdges(recycler->savedThreadContext.GetRegisters(), sizeof(void *) * Recycler::SavedRegisterState::NumRegistersToSave, &nextIndex);
+        AddEdges(stackTop, (char *)stackBase - (char *)stackTop, &nextIndex);
+    }
+    SetEdges(FirstRootKindNodeIndex + RootKind_Stack, firstEdge);
+}
+
+void
+RecyclerHeapSnapshot::Build(bool computeRetainedSizes)
+{
+    Assert(nodes.Count() == 0);
+
+    AddNode(nullptr, 0, false);
+    for (uint rootKind = 0; rootKind < RootKindCount; rootKind++)
+    {
+        Edge edge;
+        edge.toNode = AddNode(nullptr, 0, false);
+        edge.index = rootKind;
+        edges.Add(edge);
+    }
+    SetEdges(RootNodeIndex, 0);
+
+    AddRootEdges();
+
+    // The nodes found by the scan of a node are appended, so walking the list in order is a breadth first walk
+    for (uint nodeIndex = FirstObjectNodeIndex; nodeIndex < (uint)nodes.Count(); nodeIndex++)
+    {
+        uint firstEdge = (uint)edges.Count();
+        const Node& node = nodes.Item(nodeIndex);
+        if (!node.isLeaf)
+        {
+            void ** address = (void **)node.address;
+            size_t size = node.size;
+            uint nextIndex = 0;
+            AddEdges(address, size, &nextIndex);
+        }
+        SetEdges(nodeIndex, firstEdge);
+    }
+
+    if (computeRetainedSizes)
+    {
+        ComputeRetainedSizes();
+    }
+}
+
+// Builds the dominator tree with the iterative algorithm of Cooper, Harvey and Kennedy ("A Simple, Fast Dominance
+// Algorithm"), which is simple and fast on graphs as shallow as heaps, and adds the size of each node to the retained
+// size of its dominators.
+void
+RecyclerHeapSnapshot::ComputeRetainedSizes()
+{
+    static const uint NoNodeIndex = (uint)-1;
+
+    const uint nodeCount = (uint)nodes.Count();
+    const uint edgeCount = (uint)edges.Count();
+
+    // Post order of a depth first walk from the root, which is last
+    AutoArrayPtr<uint> postOrder(HeapNewArray(uint, nodeCount), nodeCount);
+    AutoArrayPtr<uint> reversePostOrderNumbers(HeapNewArray(uint, nodeCount), nodeCount);
+    {
+        AutoArrayPtr<uint> stack(HeapNewArray(uint, nodeCount), nodeCount);
+        AutoArrayPtr<uint> stackEdgeCounts(HeapNewArray(uint, nodeCount), nodeCount);
+        for (uint i = 0; i < nodeCount; i++)
+        {
+            reversePostOrderNumbers[i] = NoNodeIndex;
+        }
+
+        uint postOrderCount = 0;
+        uint stackDepth = 1;
+        stack[0] = RootNodeIndex;
+        stackEdgeCounts[0] = 0;
+        reversePostOrderNumbers[RootNodeIndex] = 0;
+        while (stackDepth != 0)
+        {
+            const uint nodeIndex = stack[stackDepth - 1];
+            const Node& node = nodes.Item(nodeIndex);
+            if (stackEdgeCounts[stackDepth - 1] == node.edgeCount)
+            {
+                postOrder[postOrderCount++] = nodeIndex;
+                stackDepth--;
+                continue;
+            }
+
+            const uint toNode = edges.Item(node.firstEdge + stackEdgeCounts[stackDepth - 1]++).toNode;
+            if (reversePostOrderNumbers[toNode] == NoNodeIndex)
+            {
+                // Mark it as seen; the number is set once the walk is done
+                reversePostOrderNumbers[toNode] = 0;
+                stack[stackDepth] = toNode;
+                stackEdgeCounts[stackDepth] = 0;
+                stackDepth++;
+            }
+        }
+
+        // Every node was found from the root
+        Assert(postOrderCount == nodeCount);
+        for (uint i = 0; i < nodeCount; i++)
+        {
+            reversePostOrderNumbers[postOrder[i]] = nodeCount - 1 - i;
+        }
+    }
+
+    // Predecessors of each node
+    AutoArrayPtr<uint> firstPredecessors(HeapNewArray(uint, nodeCount + 1), nodeCount + 1);
+    AutoArrayPtr<uint> predecessors(HeapNewArray(uint, edgeCount), edgeCount);
+    for (uint i = 0; i <= nodeCount; i++)
+    {
+        firstPredecessors[i] = 0;
+    }
+    for (uint i = 0; i < edgeCount; i++)
+    {
+        firstPredecessors[edges.Item(i).toNode + 1]++;
+    }
+    for (uint i = 0; i < nodeCount; i++)
+    {
+        firstPredecessors[i + 1] += firstPredecessors[i];
+    }
+    {
+        AutoArrayPtr<uint> predecessorCounts(HeapNewArray(uint, nodeCount), nodeCount);
+        for (uint i = 0; i < nodeCount; i++)
+        {
+            predecessorCounts[i] = 0;
+        }
+        for (uint nodeIndex = 0; nodeIndex < nodeCount; nodeIndex++)
+        {
+            const Node& node = nodes.Item(nodeIndex);
+            for (uint i = node.firstEdge; i < node.firstEdge + node.edgeCount; i++)
+            {
+                const uint toNode = edges.Item(i).toNode;
+                predecessors[firstPredecessors[toNode] + predecessorCounts[toNode]++] = nodeIndex;
+            }
+        }
+    }
+
+    AutoArrayPtr<uint> dominators(HeapNewArray(uint, nodeCount), nodeCount);
+    for (uint i = 0; i < nodeCount; i++)
+    {
+        dominators[i] = NoNodeIndex;
+    }
+    dominators[RootNodeIndex] = RootNodeIndex;
+
+    bool changed = true;
+    while (changed)
+    {
+        changed = false;
+
+        // Reverse post order, without the root
+        for (uint i = nodeCount - 1; i-- != 0;)
+        {
+            const uint nodeIndex = postOrder[i];
+            uint dominator = NoNodeIndex;
+            for (uint j = firstPredecessors[nodeIndex]; j < firstPredecessors[nodeIndex + 1]; j++)
+            {
+                uint predecessor = predecessors[j];
+                if (dominators[predecessor] == NoNodeIndex)
+                {
+                    continue;
+                }
+                if (dominator == NoNodeIndex)
+                {
+                    dominator = predecessor;
+                    continue;
+                }
+
+                // Walk up from both to their nearest common dominator
+                while (predecessor != dominator)
+                {
+                    while (reversePostOrderNumbers[predecessor] > reversePostOrderNumbers[dominator])
+                    {
+                        predecessor = dominators[predecessor];
+                    }
+                    while (reversePostOrderNumbers[dominator] > reversePostOrderNumbers[predecessor])
+                    {
+                        dominator = dominators[dominator];
+                    }
+                }
+            }
+
+            Assert(dominator != NoNodeIndex);
+            if (dominators[nodeIndex] != dominator)
+            {
+                dominators[nodeIndex] = dominator;
+                changed = true;
+            }
+        }
+    }
+
+    for (uint nodeIndex = 0; nodeIndex < nodeCount; nodeIndex++)
+    {
+        Node& node = nodes.Item(nodeIndex);
+        node.retainedSize = node.size;
+    }
+
+    // A dominator comes before the nodes it dominates in reverse post order, so it gets their sizes before its own
+    // is added to its dominator.
+    for (uint i = 0; i < nodeCount - 1; i++)
+    {
+        const uint nodeIndex = postOrder[i];
+        nodes.Item(dominators[nodeIndex]).retainedSize += nodes.Item(nodeIndex).retainedSize;
+    }
+}
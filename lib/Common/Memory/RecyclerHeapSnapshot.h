@@ -0,0 +1,80 @@
+//-------------------------------------------------------------------------------------------------------
+// Copyright (C) Microsoft. All rights reserved.
+// Licensed under the MIT license. See LICENSE.txt file in the project root for full license information.
+//-------------------------------------------------------------------------------------------------------
+#pragma once
+
+// Graph of the objects of a recycler that are reachable from its roots, for heap snapshots in any build.
+//
+// The RecyclerObjectGraphDumper hooks the mark of debug builds. The snapshot walks the heap on its own instead, while
+// the recycler is set up for heap enumeration for the lifetime of the snapshot: collections are finished and disabled,
+// so the objects of the graph stay where they are until the snapshot is deleted. The roots are found the way FindRoots
+// finds them (pinned objects, guest arenas and the stack and registers of the thread) and the objects are scanned
+// conservatively, word by word, like the mark scans them. Interior pointers and implicit roots, which are only used by
+// the MemProtect heap, aren't followed.
+//
+// Node 0 is a synthetic root whose edges lead to a synthetic node per root kind, so every object is reachable from
+// node 0 and the dominator tree of the graph gives the retained size of each object: the memory that would be freed if
+// the object were collected. Nodes are numbered in the order they are found, breadth first, so the edges of a node are
+// contiguous and the nodes closer to the roots come first.
+class RecyclerHeapSnapshot
+{
+public:
+    enum RootKind
+    {
+        RootKind_Pinned,
+        RootKind_GuestArena,
+        RootKind_Stack,
+        RootKindCount
+    };
+
+    static const uint RootNodeIndex = 0;
+    static const uint FirstRootKindNodeIndex = 1;
+    static const uint FirstObjectNodeIndex = FirstRootKindNodeIndex + RootKindCount;
+
+    struct Node
+    {
+        // Null for the synthetic nodes
+        void * address;
+        size_t size;
+        size_t retainedSize;
+        uint firstEdge;
+        uint edgeCount;
+        bool isLeaf;
+    };
+
+    struct Edge
+    {
+        uint toNode;
+
+        // Pointer sized offset of the reference in the object, or in the roots of its kind
+        uint index;
+    };
+
+    RecyclerHeapSnapshot(Recycler * recycler);
+
+    // Walks the heap. The retained sizes are left at zero unless asked for, since they cost a dominator tree.
+    void Build(bool computeRetainedSizes);
+
+    uint GetNodeCount() const { return (uint)nodes.Count(); }
+    const Node& GetNode(uint nodeIndex) const { return nodes.Item(nodeIndex); }
+    uint GetEdgeCount() const { return (uint)edges.Count(); }
+    const Edge& GetEdge(uint edgeIndex) const { return edges.Item(edgeIndex); }
+
+private:
+    typedef JsUtil::BaseDictionary<void *, uint, HeapAllocator, PrimeSizePolicy, RecyclerPointerComparer> NodeIndexMap;
+
+    uint AddNode(void * address, size_t size, bool isLeaf);
+    void AddEdge(void * candidate, uint index);
+    void AddEdges(void ** references, size_t byteCount, uint * nextIndex);
+    void AddGuestArenaEdges(ArenaData * arena, uint * nextIndex);
+    void AddRootEdges();
+    void SetEdges(uint nodeIndex, uint firstEdge);
+    void ComputeRetainedSizes();
+
+    Recycler * recycler;
+    Recycler::AutoSetupRecyclerForNonCollectingMark autoSetupRecyclerForNonCollectingMark;
+    JsUtil::List<Node, HeapAllocator> nodes;
+    JsUtil::List<Edge, HeapAllocator> edges;
+    NodeIndexMap nodeIndices;
+};
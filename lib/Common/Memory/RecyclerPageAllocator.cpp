@@ -82,15 +82,24 @@ RecyclerPageAllocator::ResetWriteWatch(DListBase<PageSegment> * segmentList)
         size_t pageCount = segment.GetAvailablePageCount();
         Assert(pageCount <= MAXUINT32);
         PageSegment::PageBitVector unallocPages = segment.GetUnAllocatedPages();
-        for (uint index = 0u; index < pageCount; index++)
+
+        // Reset runs of allocated pages with one call each; per-page resets are expensive on
+        // platforms that emulate write watch, and they split huge pages there.
+        uint index = 0u;
+        while (index < pageCount)
         {
             if (unallocPages.Test(index))
             {
+                index++;
                 continue;
             }
-            char * address = segment.GetAddress() + index * AutoSystemInfo::PageSize;
-            if (::ResetWriteWatch(address, AutoSystemInfo::PageSize) != 0)
-
+            uint runStart = index;
+            while (index < pageCount && !unallocPages.Test(index))
+            {
+                index++;
+            }
+            char * address = segment.GetAddress() + runStart * AutoSystemInfo::PageSize;
+            if (::ResetWriteWatch(address, (index - runStart) * AutoSystemInfo::PageSize) != 0)
             {
 #if DBG_DUMP
                 Output::Print(_u("ResetWriteWatch failed for %p\n"), address);
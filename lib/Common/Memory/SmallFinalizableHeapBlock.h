@@ -98,11 +98,9 @@ public:
 #endif
     void FinalizeAllObjects();
 
-#ifdef DUMP_FRAGMENTATION_STATS
     ushort GetFinalizeCount() {
         return finalizeCount;
     }
-#endif
 
     virtual bool FindHeapObject(void* objectAddress, Recycler * recycler, FindHeapObjectFlags flags, RecyclerHeapObjectInfo& heapObject) override
     {
@@ -80,7 +80,6 @@ SmallFinalizableHeapBucketBaseT<TBlockType>::ResetMarks(ResetMarkFlags flags)
     }
 }
 
-#ifdef DUMP_FRAGMENTATION_STATS
 template <class TBlockType>
 void
 SmallFinalizableHeapBucketBaseT<TBlockType>::AggregateBucketStats(HeapBucketStats& stats)
@@ -91,7 +90,6 @@ SmallFinalizableHeapBucketBaseT<TBlockType>::AggregateBucketStats(HeapBucketStat
         heapBlock->AggregateBlockStats(stats);
     });
 }
-#endif
 
 template<class TBlockType>
 void
@@ -19,9 +19,7 @@ public:
     void FinalizeAllObjects();
     static void FinalizeHeapBlockList(THeapBlockType * list);
 
-#ifdef DUMP_FRAGMENTATION_STATS
     void AggregateBucketStats(HeapBucketStats& stats);
-#endif
 protected:
     void EnumerateObjects(ObjectInfoBits infoBits, void (*CallBackFunction)(void * address, size_t size));
 
@@ -252,6 +250,7 @@ public:
     void DisposeObjects();
     void TransferDisposedObjects();
     void EnumerateObjects(ObjectInfoBits infoBits, void (*CallBackFunction)(void * address, size_t size));
+    void AggregateBucketStats(HeapBucketStats& stats);
     void FinalizeAllObjects();
     static unsigned int GetHeapBucketOffset() { return offsetof(HeapBucketGroup<TBlockAttributes>, heapBucket); }
 
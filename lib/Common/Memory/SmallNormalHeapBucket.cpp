@@ -16,21 +16,23 @@ SmallNormalHeapBucketBase<TBlockType>::SmallNormalHeapBucketBase()
 {
 }
 
-#ifdef DUMP_FRAGMENTATION_STATS
 template <typename TBlockType>
 void
 SmallNormalHeapBucketBase<TBlockType>::AggregateBucketStats(HeapBucketStats& stats)
 {
     __super::AggregateBucketStats(stats);
 
-    HeapBlockList::ForEach(partialHeapBlockList, [&stats](SmallHeapBlock* heapBlock) {
+#if ENABLE_PARTIAL_GC
+    HeapBlockList::ForEach(partialHeapBlockList, [&stats](TBlockType* heapBlock) {
         heapBlock->AggregateBlockStats(stats);
     });
-    HeapBlockList::ForEach(partialSweptHeapBlockList, [&stats](SmallHeapBlock* heapBlock) {
+#if ENABLE_CONCURRENT_GC
+    HeapBlockList::ForEach(partialSweptHeapBlockList, [&stats](TBlockType* heapBlock) {
         heapBlock->AggregateBlockStats(stats);
     });
-}
 #endif
+#endif
+}
 
 template <typename TBlockType>
 void
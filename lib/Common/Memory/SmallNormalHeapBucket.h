@@ -20,9 +20,7 @@ public:
     friend class ::ScriptMemoryDumper;
 #endif
 
-#ifdef DUMP_FRAGMENTATION_STATS
     void AggregateBucketStats(HeapBucketStats& stats);
-#endif
 protected:
     template <class TBlockAttributes>
     friend class HeapBucketGroup;
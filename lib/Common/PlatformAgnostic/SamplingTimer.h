@@ -0,0 +1,31 @@
+//-------------------------------------------------------------------------------------------------------
+// Copyright (C) Microsoft. All rights reserved.
+// Licensed under the MIT license. See LICENSE.txt file in the project root for full license information.
+//-------------------------------------------------------------------------------------------------------
+
+#ifndef RUNTIME_PLATFORM_AGNOSTIC_COMMON_SAMPLINGTIMER
+#define RUNTIME_PLATFORM_AGNOSTIC_COMMON_SAMPLINGTIMER
+
+namespace PlatformAgnostic
+{
+    // Process wide timer driving a sampling profiler of the thread that starts it. There is only one, owned by
+    // whoever started it last.
+    //
+    // On Linux the ticks are SIGPROF signals of a timer on the CPU time clock of the sampled thread, delivered to
+    // that thread, so the callback runs in a signal handler that interrupted it. On other POSIX platforms they are
+    // SIGPROF signals of the ITIMER_PROF timer of the process, and the ticks that land on other threads are dropped.
+    // On Windows they are counted in wall clock time and the callback runs on a timer thread. Either way the
+    // callback must only do async-signal-safe work: no locks, no allocations.
+    class SamplingTimer
+    {
+    public:
+        typedef void (*TickCallback)(void * state);
+
+        static bool Start(unsigned int intervalMicroseconds, TickCallback tickCallback, void * state);
+
+        // Once Stop returns, the callback is not running and won't be called anymore
+        static void Stop();
+    };
+} // namespace PlatformAgnostic
+
+#endif // RUNTIME_PLATFORM_AGNOSTIC_COMMON_SAMPLINGTIMER
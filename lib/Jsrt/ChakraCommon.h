@@ -506,6 +506,11 @@ typedef UINT32 DWORD;
         ///     This one needs to be set for Utf16
         /// </summary>
         JsParseScriptAttributeArrayBufferIsUtf16Encoded = 0x2,
+        /// <summary>
+        ///     The byte code of the script is kept by the runtime and shared with the other
+        ///     contexts of the runtime that load the same script with the same attributes
+        /// </summary>
+        JsParseScriptAttributeShareByteCode = 0x4,
     } JsParseScriptAttributes;
 
     /// <summary>
@@ -326,6 +326,118 @@ CHAKRA_API
         _Out_opt_ uint16_t* buffer,
         _Out_opt_ size_t* written);
 
+/// <summary>
+///     Creates a string whose one byte characters stay in memory owned by the host.
+/// </summary>
+/// <remarks>
+///     <para>
+///         Requires an active script context.
+///     </para>
+///     <para>
+///         The characters are Latin-1, each byte is one UTF-16 code unit. They are not copied: the
+///         memory must stay valid and unchanged until <c>finalizeCallback</c> is called, when the
+///         string is collected. The first operation that needs the UTF-16 characters of the string
+///         widens them into the garbage collected heap; <c>JsCopyString</c> and
+///         <c>JsGetStringBuffer</c> read the host memory. Time travel debugging records the
+///         characters of the string, so they are widened when recording.
+///     </para>
+/// </remarks>
+/// <param name="content">Pointer to string memory.</param>
+/// <param name="length">Number of bytes within the string</param>
+/// <param name="finalizeCallback">
+///     The function called when the string is collected, or <c>nullptr</c>.
+/// </param>
+/// <param name="callbackState">User provided state passed to <c>finalizeCallback</c>.</param>
+/// <param name="value">JsValueRef representing the JavascriptString</param>
+/// <returns>
+///     The code <c>JsNoError</c> if the operation succeeded, a failure code otherwise.
+/// </returns>
+CHAKRA_API
+    JsCreateExternalString(
+        _In_reads_(length) const char *content,
+        _In_ size_t length,
+        _In_opt_ JsFinalizeCallback finalizeCallback,
+        _In_opt_ void *callbackState,
+        _Out_ JsValueRef *value);
+
+/// <summary>
+///     Creates a string whose Utf16 characters stay in memory owned by the host.
+/// </summary>
+/// <remarks>
+///     <para>
+///         Requires an active script context.
+///     </para>
+///     <para>
+///         The characters are not copied: the memory must stay valid and unchanged until
+///         <c>finalizeCallback</c> is called, when the string is collected. The string is used
+///         in place, so <c>content[length]</c> must be a null character; otherwise the call
+///         returns <c>JsErrorInvalidArgument</c>.
+///     </para>
+/// </remarks>
+/// <param name="content">Pointer to string memory, followed by a null character.</param>
+/// <param name="length">Number of characters within the string, without the null character</param>
+/// <param name="finalizeCallback">
+///     The function called when the string is collected, or <c>nullptr</c>.
+/// </param>
+/// <param name="callbackState">User provided state passed to <c>finalizeCallback</c>.</param>
+/// <param name="value">JsValueRef representing the JavascriptString</param>
+/// <returns>
+///     The code <c>JsNoError</c> if the operation succeeded, a failure code otherwise.
+/// </returns>
+CHAKRA_API
+    JsCreateExternalStringUtf16(
+        _In_reads_(length + 1) const uint16_t *content,
+        _In_ size_t length,
+        _In_opt_ JsFinalizeCallback finalizeCallback,
+        _In_opt_ void *callbackState,
+        _Out_ JsValueRef *value);
+
+/// <summary>
+///     Encoding of the characters of a string buffer.
+/// </summary>
+typedef enum _JsStringEncoding
+{
+    /// <summary>
+    ///     One byte per character, Latin-1.
+    /// </summary>
+    JsStringEncodingOneByte = 0,
+    /// <summary>
+    ///     Two bytes per character, Utf16.
+    /// </summary>
+    JsStringEncodingUtf16 = 1,
+} JsStringEncoding;
+
+/// <summary>
+///     Gets the characters of a string without copying them.
+/// </summary>
+/// <remarks>
+///     <para>
+///         Requires an active script context.
+///     </para>
+///     <para>
+///         A string created with <c>JsCreateExternalString</c> returns its host memory in
+///         <c>JsStringEncodingOneByte</c>. Any other string returns its Utf16 characters, after
+///         making them contiguous if the string was built by concatenation.
+///     </para>
+///     <para>
+///         The buffer is not necessarily null terminated. It is valid as long as the string is
+///         alive and must not be modified.
+///     </para>
+/// </remarks>
+/// <param name="value">JavascriptString value</param>
+/// <param name="buffer">The characters of the string.</param>
+/// <param name="length">Number of characters of the string</param>
+/// <param name="encoding">Encoding of the characters.</param>
+/// <returns>
+///     The code <c>JsNoError</c> if the operation succeeded, a failure code otherwise.
+/// </returns>
+CHAKRA_API
+    JsGetStringBuffer(
+        _In_ JsValueRef value,
+        _Outptr_result_buffer_(*length) const void **buffer,
+        _Out_ size_t *length,
+        _Out_ JsStringEncoding *encoding);
+
 /// <summary>
 ///     Parses a script and returns a function representing the script.
 /// </summary>
@@ -396,6 +508,120 @@ CHAKRA_API
         _In_ JsParseScriptAttributes parseAttributes,
         _Out_ JsValueRef *result);
 
+/// <summary>
+///     A reference to a script source that is handed to the runtime in chunks.
+/// </summary>
+typedef void* JsScriptSourceStream;
+
+/// <summary>
+///     Creates a stream that accumulates Utf8 script source as the host reads it.
+/// </summary>
+/// <remarks>
+///     <para>
+///         Does not require an active script context. The stream has to be disposed with
+///         <c>JsDisposeScriptSourceStream</c>.
+///     </para>
+///     <para>
+///         When the size of the script is known up front (e.g. from the file size), passing it as
+///         <c>expectedLength</c> lets the chunks be appended without reallocating the source buffer.
+///         The parser also goes by it to decide whether to defer parsing the script's functions before
+///         all of the script has arrived.
+///     </para>
+/// </remarks>
+/// <param name="expectedLength">Expected length of the script in bytes, 0 if unknown.</param>
+/// <param name="stream">The new script source stream.</param>
+/// <returns>
+///     The code <c>JsNoError</c> if the operation succeeded, a failure code otherwise.
+/// </returns>
+CHAKRA_API
+    JsCreateScriptSourceStream(
+        _In_ size_t expectedLength,
+        _Out_ JsScriptSourceStream *stream);
+
+/// <summary>
+///     Appends a chunk of Utf8 script source to a script source stream.
+/// </summary>
+/// <remarks>
+///     <para>
+///         Does not require an active script context and can be called from any thread, e.g.
+///         from the thread reading the script from disk or from a pipe, while the thread that
+///         owns the script context keeps running script.
+///     </para>
+///     <para>
+///         Chunk boundaries need not align with Utf8 character boundaries. The chunk is copied,
+///         so the memory can be reused as soon as the call returns.
+///     </para>
+/// </remarks>
+/// <param name="stream">The script source stream.</param>
+/// <param name="chunk">The next bytes of the script.</param>
+/// <param name="length">Number of bytes in the chunk.</param>
+/// <param name="isLastChunk">Whether this chunk completes the script.</param>
+/// <returns>
+///     The code <c>JsNoError</c> if the operation succeeded, a failure code otherwise.
+///     <c>JsErrorInvalidArgument</c> if the last chunk was already appended.
+/// </returns>
+CHAKRA_API
+    JsAppendScriptSourceStream(
+        _In_ JsScriptSourceStream stream,
+        _In_reads_(length) const uint8_t *chunk,
+        _In_ size_t length,
+        _In_ bool isLastChunk);
+
+/// <summary>
+///     Parses the script accumulated in a script source stream and returns a function
+///     representing the script.
+/// </summary>
+/// <remarks>
+///     <para>
+///        Requires an active script context.
+///     </para>
+///     <para>
+///         Parsing starts on the chunks appended so far, while the host may still be appending the
+///         rest from another thread, and waits for the next chunks as the parser gets to them. The
+///         call returns once the last chunk has been appended and parsed. The source is parsed in
+///         place, without copying it; the runtime keeps it alive for as long as functions created
+///         from it are, even after the stream is disposed. A stream can only be parsed once.
+///     </para>
+///     <para>
+///         When <c>JsParseScriptAttributeShareByteCode</c> is passed, or time travel debugging is
+///         recording or replaying, parsing only starts once the last chunk has been appended.
+///     </para>
+/// </remarks>
+/// <param name="stream">The script source stream.</param>
+/// <param name="sourceContext">
+///     A cookie identifying the script that can be used by debuggable script contexts.
+/// </param>
+/// <param name="sourceUrl">The location the script came from.</param>
+/// <param name="parseAttributes">Attribute mask for parsing the script</param>
+/// <param name="result">The result of the compiled script.</param>
+/// <returns>
+///     The code <c>JsNoError</c> if the operation succeeded, a failure code otherwise.
+/// </returns>
+CHAKRA_API
+    JsParseScriptSourceStream(
+        _In_ JsScriptSourceStream stream,
+        _In_ JsSourceContext sourceContext,
+        _In_ JsValueRef sourceUrl,
+        _In_ JsParseScriptAttributes parseAttributes,
+        _Out_ JsValueRef *result);
+
+/// <summary>
+///     Disposes a script source stream.
+/// </summary>
+/// <remarks>
+///     <para>
+///         Does not require an active script context. The stream must not be used afterwards,
+///         and no other thread may still be appending to it.
+///     </para>
+/// </remarks>
+/// <param name="stream">The script source stream to dispose.</param>
+/// <returns>
+///     The code <c>JsNoError</c> if the operation succeeded, a failure code otherwise.
+/// </returns>
+CHAKRA_API
+    JsDisposeScriptSourceStream(
+        _In_ JsScriptSourceStream stream);
+
 /// <summary>
 ///     Creates the property ID associated with the name.
 /// </summary>
@@ -552,5 +778,382 @@ CHAKRA_API
         _In_ JsSourceContext sourceContext,
         _In_ JsValueRef sourceUrl,
         _Out_ JsValueRef *result);
+
+/// <summary>
+///     Parses a script and returns its parser state: the extents of the script's functions.
+/// </summary>
+/// <remarks>
+///     <para>
+///     Requires an active script context.
+///     </para>
+///     <para>
+///     Unlike a serialized script, the parser state does not replace the script source, which is
+///     still parsed when the script is run. But when it is passed to <c>JsRunScriptWithParserState</c>
+///     along with the same script, the initial parse skips over the bodies of deferred functions
+///     instead of scanning them. The functions are still fully parsed on first call.
+///     </para>
+///     <para>
+///     The parser state is only valid for the exact script it was created from and for the same
+///     version of the runtime. Hosts can store it alongside the script or keyed by its hash.
+///     </para>
+/// </remarks>
+/// <param name="script">The script to parse, a JavascriptString or JavascriptExternalArrayBuffer.</param>
+/// <param name="bufferVal">A new ArrayBuffer containing the parser state.</param>
+/// <param name="parseAttributes">Encoding for the script.</param>
+/// <returns>
+///     The code <c>JsNoError</c> if the operation succeeded, a failure code otherwise.
+/// </returns>
+CHAKRA_API
+    JsSerializeParserState(
+        _In_ JsValueRef script,
+        _Out_ JsValueRef *bufferVal,
+        _In_ JsParseScriptAttributes parseAttributes);
+
+/// <summary>
+///     Executes a script with the parser state created for it by <c>JsSerializeParserState</c>.
+/// </summary>
+/// <remarks>
+///     <para>
+///     Requires an active script context.
+///     </para>
+///     <para>
+///     A parser state that was created for another script or runtime version is ignored, and the
+///     script is then run as with <c>JsRun</c>. One that isn't well formed is rejected with
+///     <c>JsErrorInvalidArgument</c>.
+///     </para>
+/// </remarks>
+/// <param name="script">The script to run.</param>
+/// <param name="sourceContext">
+///     A cookie identifying the script that can be used by debuggable script contexts.
+/// </param>
+/// <param name="sourceUrl">The location the script came from.</param>
+/// <param name="parseAttributes">Attribute mask for parsing the script</param>
+/// <param name="parserState">The ArrayBuffer returned by <c>JsSerializeParserState</c>.</param>
+/// <param name="result">The result of the script, if any. This parameter can be null.</param>
+/// <returns>
+///     The code <c>JsNoError</c> if the operation succeeded, a failure code otherwise.
+/// </returns>
+CHAKRA_API
+    JsRunScriptWithParserState(
+        _In_ JsValueRef script,
+        _In_ JsSourceContext sourceContext,
+        _In_ JsValueRef sourceUrl,
+        _In_ JsParseScriptAttributes parseAttributes,
+        _In_ JsValueRef parserState,
+        _Out_ JsValueRef *result);
+
+/// <summary>
+///     Statistics of the last garbage collection of a runtime.
+/// </summary>
+/// <remarks>
+///     Pauses are the time the collection blocked the thread that owns the runtime. The work a
+///     concurrent collection does on background threads is not counted. The garbage collector is
+///     not generational; the memory that survived a collection is reported by <c>usedBytesAfter</c>.
+/// </remarks>
+typedef struct JsCollectionStatistics
+{
+    /// <summary>Number of collections finished so far, including this one.</summary>
+    unsigned int collectionCount;
+    /// <summary>Whether only recently allocated memory was collected.</summary>
+    bool isPartial;
+    /// <summary>Whether the collection was requested to mark and sweep on background threads.</summary>
+    bool isConcurrent;
+    /// <summary>Time spent finding roots and marking on the runtime's thread.</summary>
+    uint64_t markPauseMicroseconds;
+    /// <summary>Time spent sweeping on the runtime's thread.</summary>
+    uint64_t sweepPauseMicroseconds;
+    /// <summary>Sum of all pauses of this collection.</summary>
+    uint64_t pauseMicroseconds;
+    /// <summary>Sum of the pauses of all collections so far.</summary>
+    uint64_t totalPauseMicroseconds;
+    /// <summary>Largest pause of a single collection so far.</summary>
+    uint64_t maxPauseMicroseconds;
+    /// <summary>Bytes allocated since the previous collection.</summary>
+    size_t allocatedBytes;
+    /// <summary>Bytes of pages in use by the garbage collector when the collection started.</summary>
+    size_t usedBytesBefore;
+    /// <summary>Bytes of pages in use by the garbage collector when the collection finished.</summary>
+    size_t usedBytesAfter;
+} JsCollectionStatistics;
+
+/// <summary>
+///     Occupancy of the garbage collected heap for one size class of small or medium objects.
+/// </summary>
+typedef struct JsHeapSizeClassStatistics
+{
+    /// <summary>Size of the objects of this size class in bytes.</summary>
+    unsigned int objectSize;
+    /// <summary>Number of heap blocks of this size class.</summary>
+    unsigned int blockCount;
+    /// <summary>Number of heap blocks without any live object.</summary>
+    unsigned int emptyBlockCount;
+    /// <summary>Number of live objects.</summary>
+    unsigned int objectCount;
+    /// <summary>Bytes of the live objects.</summary>
+    unsigned int objectBytes;
+    /// <summary>Bytes of the heap blocks.</summary>
+    unsigned int blockBytes;
+} JsHeapSizeClassStatistics;
+
+/// <summary>
+///     A callback called after every garbage collection of a runtime.
+/// </summary>
+/// <remarks>
+///     The callback runs on the runtime's thread, after the collection has finished but before
+///     finalizers run. It must not run script or allocate from the runtime.
+/// </remarks>
+/// <param name="statistics">The statistics of the collection that just finished.</param>
+/// <param name="callbackState">The state passed to <c>JsSetRuntimeCollectionEndCallback</c>.</param>
+typedef void (CHAKRA_CALLBACK *JsCollectionEndCallback)(_In_ const JsCollectionStatistics *statistics, _In_opt_ void *callbackState);
+
+/// <summary>
+///     Gets the statistics of the last garbage collection of a runtime.
+/// </summary>
+/// <remarks>
+///     The statistics are kept in all builds and are cheap to query, so hosts can poll them to
+///     monitor pause times in production. <c>collectionCount</c> is 0 until the first collection
+///     has finished.
+/// </remarks>
+/// <param name="runtime">The runtime.</param>
+/// <param name="statistics">The statistics of the last collection.</param>
+/// <returns>
+///     The code <c>JsNoError</c> if the operation succeeded, a failure code otherwise.
+/// </returns>
+CHAKRA_API
+    JsGetRuntimeCollectionStatistics(
+        _In_ JsRuntimeHandle runtime,
+        _Out_ JsCollectionStatistics *statistics);
+
+/// <summary>
+///     Gets the occupancy of the garbage collected heap of a runtime by size class.
+/// </summary>
+/// <remarks>
+///     <para>
+///     The small and medium size classes are reported in increasing order of object size. Large
+///     objects have pages of their own and are not included.
+///     </para>
+///     <para>
+///     Walks all heap blocks, so it is meant for periodic monitoring rather than for hot paths.
+///     </para>
+/// </remarks>
+/// <param name="runtime">The runtime.</param>
+/// <param name="statistics">
+///     Buffer receiving the statistics of the size classes. Can be null to only query the count.
+/// </param>
+/// <param name="count">Number of elements in the buffer.</param>
+/// <param name="actualCount">Number of size classes of the heap.</param>
+/// <returns>
+///     The code <c>JsNoError</c> if the operation succeeded, a failure code otherwise.
+///     <c>JsErrorRuntimeInUse</c> if script or a garbage collection is running, for instance when
+///     called from a native function called by script. <c>JsErrorWrongThread</c> if the runtime is
+///     active on another thread.
+/// </returns>
+CHAKRA_API
+    JsGetRuntimeHeapStatistics(
+        _In_ JsRuntimeHandle runtime,
+        _Out_writes_opt_(count) JsHeapSizeClassStatistics *statistics,
+        _In_ unsigned int count,
+        _Out_ unsigned int *actualCount);
+
+/// <summary>
+///     Sets a callback function that is called after every garbage collection.
+/// </summary>
+/// <remarks>
+///     Passing a null callback removes the current one.
+/// </remarks>
+/// <param name="runtime">The runtime.</param>
+/// <param name="callbackState">
+///     User provided state that will be passed back to the callback.
+/// </param>
+/// <param name="collectionEndCallback">The callback function being set.</param>
+/// <returns>
+///     The code <c>JsNoError</c> if the operation succeeded, a failure code otherwise.
+/// </returns>
+CHAKRA_API
+    JsSetRuntimeCollectionEndCallback(
+        _In_ JsRuntimeHandle runtime,
+        _In_opt_ void *callbackState,
+        _In_opt_ JsCollectionEndCallback collectionEndCallback);
+
+/// <summary>
+///     Counts of the work of the JIT of a runtime since it was created.
+/// </summary>
+/// <remarks>
+///     A function that is jitted again, by the full JIT after the simple JIT or after a bailout,
+///     is counted again. All the counts are 0 in builds without a JIT or when it is disabled.
+/// </remarks>
+typedef struct JsJitStatistics
+{
+    /// <summary>Number of functions jitted by the simple JIT.</summary>
+    unsigned int simpleJitFunctionCount;
+    /// <summary>Number of functions jitted by the full JIT.</summary>
+    unsigned int fullJitFunctionCount;
+    /// <summary>Number of loop bodies jitted.</summary>
+    unsigned int loopBodyCount;
+    /// <summary>Number of functions and loop bodies whose JIT failed or was aborted.</summary>
+    unsigned int failedCount;
+    /// <summary>Number of bailouts from jitted code to the interpreter that could lead to a rejit.</summary>
+    unsigned int bailOutCount;
+    /// <summary>Number of functions and loop bodies scheduled to be jitted again after a bailout.</summary>
+    unsigned int rejitCount;
+} JsJitStatistics;
+
+/// <summary>
+///     Gets the counts of the work of the JIT of a runtime.
+/// </summary>
+/// <remarks>
+///     Jobs of the background JIT are counted once they are done, so the counts can lag behind
+///     the script that is running.
+/// </remarks>
+/// <param name="runtime">The runtime.</param>
+/// <param name="statistics">The counts of the JIT.</param>
+/// <returns>
+///     The code <c>JsNoError</c> if the operation succeeded, a failure code otherwise.
+/// </returns>
+CHAKRA_API
+    JsGetRuntimeJitStatistics(
+        _In_ JsRuntimeHandle runtime,
+        _Out_ JsJitStatistics *statistics);
+
+/// <summary>
+///     Starts the sampling CPU profiler of a runtime.
+/// </summary>
+/// <remarks>
+///     <para>
+///     At every interval the profiler records the script stack of the runtime at the next stack
+///     probe of the runtime: the entry of an interpreted function or of a library function, or a
+///     loop of interpreted code. Time spent in jitted code is recorded when it next calls out, so
+///     the profile is biased towards the frames of the calls out of hot jitted loops. Besides the
+///     fields of the format, the profile has a <c>sampleDelays</c> array giving, for each sample,
+///     how many microseconds after its tick it was recorded. Time spent outside of script is
+///     recorded as "(program)".
+///     </para>
+///     <para>
+///     The profiler samples the thread that starts it, which must be the thread that runs the
+///     script of the runtime. Starting the profiler discards the previous profile. Only one runtime
+///     of the process can be profiled at a time. On POSIX platforms the profiler uses the
+///     <c>SIGPROF</c> signal, so the host must not use it while profiling. On Linux the interval
+///     is in CPU time of the sampled thread; on other POSIX platforms it is in CPU time of the
+///     process and the <c>ITIMER_PROF</c> timer is used. On Windows the interval is in wall clock
+///     time, rounded to milliseconds.
+///     </para>
+/// </remarks>
+/// <param name="runtime">The runtime.</param>
+/// <param name="intervalMicroseconds">The interval between samples, in microseconds.</param>
+/// <returns>
+///     The code <c>JsNoError</c> if the operation succeeded, a failure code otherwise.
+///     <c>JsErrorAlreadyProfilingContext</c> if another runtime is being profiled.
+///     <c>JsErrorRuntimeInUse</c> if the runtime is running script on another thread.
+/// </returns>
+CHAKRA_API
+    JsStartSamplingProfiler(
+        _In_ JsRuntimeHandle runtime,
+        _In_ unsigned int intervalMicroseconds);
+
+/// <summary>
+///     Stops the sampling CPU profiler of a runtime.
+/// </summary>
+/// <remarks>
+///     The profile is kept until the profiler is started again or the runtime is disposed.
+/// </remarks>
+/// <param name="runtime">The runtime.</param>
+/// <returns>
+///     The code <c>JsNoError</c> if the operation succeeded, a failure code otherwise.
+///     <c>JsErrorRuntimeInUse</c> if the runtime is running script on another thread.
+/// </returns>
+CHAKRA_API
+    JsStopSamplingProfiler(
+        _In_ JsRuntimeHandle runtime);
+
+/// <summary>
+///     Writes the profile recorded by the sampling CPU profiler of a runtime into a Utf8 buffer.
+/// </summary>
+/// <remarks>
+///     <para>
+///     The profile is in the JSON <c>.cpuprofile</c> format of the Chrome DevTools. It can be
+///     copied while the profiler runs.
+///     </para>
+///     <para>
+///     When the size of the profile is unknown, <c>buffer</c> can be null. In that case,
+///     <c>written</c> returns the size needed. The buffer is not null terminated.
+///     </para>
+/// </remarks>
+/// <param name="runtime">The runtime.</param>
+/// <param name="buffer">Pointer to buffer</param>
+/// <param name="bufferSize">Buffer size</param>
+/// <param name="written">Total number of bytes written</param>
+/// <returns>
+///     The code <c>JsNoError</c> if the operation succeeded, a failure code otherwise.
+///     <c>JsErrorRuntimeInUse</c> if the runtime is running script on another thread.
+/// </returns>
+CHAKRA_API
+    JsCopySamplingProfile(
+        _In_ JsRuntimeHandle runtime,
+        _Out_writes_opt_(bufferSize) char *buffer,
+        _In_ size_t bufferSize,
+        _Out_opt_ size_t *written);
+
+/// <summary>
+///     Attributes of a heap snapshot.
+/// </summary>
+typedef enum _JsHeapSnapshotAttributes
+{
+    /// <summary>
+    ///     Default attributes of a heap snapshot.
+    /// </summary>
+    JsHeapSnapshotAttributeNone = 0x0,
+    /// <summary>
+    ///     Adds the retained size of each node, the bytes that would be freed if nothing else
+    ///     referenced it, as the <c>retained_size</c> node field. It costs a dominator tree.
+    /// </summary>
+    JsHeapSnapshotAttributeRetainedSizes = 0x1,
+} JsHeapSnapshotAttributes;
+
+/// <summary>
+///     A callback called with the successive chunks of a heap snapshot.
+/// </summary>
+/// <remarks>
+///     The callback runs on the runtime's thread while the heap is paused. It must not run script
+///     or call into the runtime.
+/// </remarks>
+/// <param name="chunk">The next bytes of the snapshot.</param>
+/// <param name="length">The number of bytes of the chunk.</param>
+/// <param name="callbackState">The state passed to <c>JsTakeHeapSnapshot</c>.</param>
+typedef void (CHAKRA_CALLBACK *JsHeapSnapshotWriteCallback)(_In_reads_(length) const char *chunk, _In_ size_t length, _In_opt_ void *callbackState);
+
+/// <summary>
+///     Writes a snapshot of the garbage collected heap of a runtime.
+/// </summary>
+/// <remarks>
+///     <para>
+///     The snapshot is in the JSON <c>.heapsnapshot</c> format of the Chrome DevTools, in UTF-8.
+///     It has a node per object reachable from the roots of the garbage collector, with its size,
+///     under synthetic nodes for the pinned objects, the guest arenas and the stack of the thread.
+///     JavaScript objects are named after their type, function or string value; the engine's
+///     own objects are hidden nodes.
+///     </para>
+///     <para>
+///     The heap is paused, and no collection happens, until the whole snapshot has been written.
+///     Like the garbage collector, the snapshot scans the objects conservatively, so an edge can
+///     come from stale data that happens to look like a reference.
+///     </para>
+/// </remarks>
+/// <param name="runtime">The runtime.</param>
+/// <param name="attributes">The attributes of the snapshot.</param>
+/// <param name="writeCallback">The callback the snapshot is written to.</param>
+/// <param name="callbackState">
+///     User provided state that will be passed back to the callback.
+/// </param>
+/// <returns>
+///     The code <c>JsNoError</c> if the operation succeeded, a failure code otherwise.
+///     <c>JsErrorHeapEnumInProgress</c> if the heap is already being enumerated.
+///     <c>JsErrorWrongThread</c> if the runtime is active on another thread.
+/// </returns>
+CHAKRA_API
+    JsTakeHeapSnapshot(
+        _In_ JsRuntimeHandle runtime,
+        _In_ JsHeapSnapshotAttributes attributes,
+        _In_ JsHeapSnapshotWriteCallback writeCallback,
+        _In_opt_ void *callbackState);
 #endif // NTBUILD
 #endif // _CHAKRACORE_H_
@@ -721,6 +721,12 @@ typedef __int64 int64_t;
     ///     TTD API -- may change in future versions:
     ///     A callback for writing data to a handle.
     /// </summary>
+    /// <remarks>
+    ///     <para>
+    ///     Compressed recordings are written from a background thread. The writes to a handle are never concurrent
+    ///     and all of them are done before the handle is closed.
+    ///     </para>
+    /// </remarks>
     /// <param name="handle">The JsTTDStreamHandle to write the data to.</param>
     /// <param name="buff">The buffer to copy the data from.</param>
     /// <param name="size">The max number of bytes that should be written.</param>
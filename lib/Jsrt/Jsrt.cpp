@@ -6,6 +6,9 @@
 #include "JsrtInternal.h"
 #include "JsrtExternalObject.h"
 #include "JsrtExternalArrayBuffer.h"
+#include "JsrtExternalString.h"
+#include "JsrtHeapSnapshot.h"
+#include "JsrtScriptSourceStream.h"
 #include "jsrtHelper.h"
 
 #include "JsrtSourceHolder.h"
@@ -2866,16 +2869,100 @@ CHAKRA_API JsSetPromiseContinuationCallback(_In_ JsPromiseContinuationCallback p
     /*allowInObjectBeforeCollectCallback*/true);
 }
 
+static bool CanShareByteCode(Js::ScriptContext * scriptContext, size_t cb, bool isSourceModule)
+{
+    // Shared byte code is generated and loaded as a serialized script, with the same limitations
+    return !isSourceModule
+        && cb <= DWORD_MAX
+        && !scriptContext->IsScriptContextInDebugMode()
+#if ENABLE_TTD
+        && !scriptContext->IsTTDRecordOrReplayModeEnabled()
+#endif
+        ;
+}
+
+static Js::JavascriptFunction * LoadSharedByteCode(Js::ScriptContext * scriptContext,
+    const JsrtByteCodeCache::Entry * entry, SRCINFO const * si)
+{
+    uint32 flags = 0;
+
+    if (CONFIG_FLAG(CreateFunctionProxy) && !scriptContext->IsProfiling())
+    {
+        flags = fscrAllowFunctionProxy;
+    }
+
+    Js::ISourceHolder * sourceHolder = RecyclerNew(scriptContext->GetRecycler(), Js::SimpleSourceHolder,
+        entry->utf8Source, entry->cbUtf8Source);
+
+    // The byte code blocks of the functions point into the shared buffer, only the per-context data is
+    // allocated here
+    Js::FunctionBody * functionBody = nullptr;
+    HRESULT hr = Js::ByteCodeSerializer::DeserializeFromBuffer(scriptContext, flags, sourceHolder,
+        scriptContext->AddHostSrcInfo(si), entry->buffer, nullptr, &functionBody);
+
+    if (FAILED(hr))
+    {
+        return nullptr;
+    }
+
+    return scriptContext->GetLibrary()->CreateScriptFunction(functionBody);
+}
+
+static void AddSharedByteCode(Js::ScriptContext * scriptContext, JsrtByteCodeCache * byteCodeCache,
+    const byte * script, size_t cb, LoadScriptFlag loadScriptFlag, Js::JavascriptFunction * scriptFunction)
+{
+    if (CONFIG_FLAG(ForceSerialized) && scriptFunction->GetFunctionProxy() != nullptr)
+    {
+        scriptFunction->GetFunctionProxy()->EnsureDeserialized();
+    }
+
+    Js::FunctionBody * functionBody = scriptFunction->GetFunctionBody();
+    Js::Utf8SourceInfo * sourceInfo = functionBody->GetUtf8SourceInfo();
+    size_t cbUtf8Source = sourceInfo->GetCbLength(_u("JsrtByteCodeCache"));
+    if (cbUtf8Source > DWORD_MAX)
+    {
+        return;
+    }
+
+    LPCUTF8 utf8Source = sourceInfo->GetSource(_u("JsrtByteCodeCache"));
+    byte * buffer = nullptr;
+    DWORD bufferSize = 0;
+
+    BEGIN_TEMP_ALLOCATOR(tempAllocator, scriptContext, _u("ByteCodeSerializer"));
+    HRESULT hr = Js::ByteCodeSerializer::SerializeToBuffer(scriptContext,
+        tempAllocator, static_cast<DWORD>(cbUtf8Source), utf8Source,
+        functionBody, functionBody->GetHostSrcInfo(), true, &buffer, &bufferSize);
+    END_TEMP_ALLOCATOR(tempAllocator, scriptContext);
+
+    // A script that can't be serialized is simply parsed by every context
+    if (SUCCEEDED(hr) && buffer != nullptr)
+    {
+#ifdef ENABLE_DEBUG_CONFIG_OPTIONS
+        if (CONFIG_FLAG(CorruptSharedByteCode) == 1)
+        {
+            Js::ByteCodeSerializer::ChangeMajorVersion(buffer);
+        }
+#endif
+
+        byteCodeCache->Add(script, cb, loadScriptFlag, utf8Source, cbUtf8Source, buffer, bufferSize);
+    }
+}
+
 JsErrorCode RunScriptCore(JsValueRef scriptSource, const byte *script, size_t cb,
     LoadScriptFlag loadScriptFlag, JsSourceContext sourceContext,
     const wchar_t *sourceUrl, bool parseOnly, JsParseScriptAttributes parseAttributes,
-    bool isSourceModule, JsValueRef *result)
+    bool isSourceModule, JsValueRef *result,
+    const byte *parserState = nullptr, size_t parserStateSize = 0,
+    ISourceStream *sourceStream = nullptr)
 {
     Js::JavascriptFunction *scriptFunction;
     CompileScriptException se;
 
     JsErrorCode errorCode = ContextAPINoScriptWrapper([&](Js::ScriptContext * scriptContext, TTDRecorder& _actionEntryPopper) -> JsErrorCode {
-        PARAM_NOT_NULL(script);
+        if (sourceStream == nullptr)
+        {
+            PARAM_NOT_NULL(script);
+        }
         PARAM_NOT_NULL(sourceUrl);
 
         SourceContextInfo * sourceContextInfo = scriptContext->GetSourceContextInfo(sourceContext, nullptr);
@@ -2915,7 +3002,40 @@ JsErrorCode RunScriptCore(JsValueRef scriptSource, const byte *script, size_t cb
             loadScriptFlag = (LoadScriptFlag)(loadScriptFlag | LoadScriptFlag_Module);
         }
 
+        // A script whose byte code is shared is loaded from the runtime's cache if another context loaded
+        // it already. Otherwise it is fully parsed, so that its byte code can be serialized for the others.
+        JsrtByteCodeCache * byteCodeCache = nullptr;
+        const LoadScriptFlag sharedByteCodeFlag = loadScriptFlag;
+        if ((parseAttributes & JsParseScriptAttributeShareByteCode) == JsParseScriptAttributeShareByteCode &&
+            sourceStream == nullptr &&
+            CanShareByteCode(scriptContext, cb, isSourceModule))
+        {
+            byteCodeCache = JsrtContext::GetCurrent()->GetRuntime()->GetByteCodeCache();
+
+            const JsrtByteCodeCache::Entry * entry = byteCodeCache->Lookup(script, cb, sharedByteCodeFlag);
+            if (entry != nullptr)
+            {
+                // The serializer checks the version and header of the buffer as it loads it. Byte code that doesn't
+                // load, say because another version of the engine wrote it, is replaced by the byte code of a new parse.
+                // Nothing writes to the buffer once it is cached, which debug builds verify on every hit.
+                Assert(JsrtByteCodeCache::IsIntact(entry));
+                scriptFunction = LoadSharedByteCode(scriptContext, entry, &si);
+                if (scriptFunction != nullptr)
+                {
+                    JsrtContext * context = JsrtContext::GetCurrent();
+                    context->OnScriptLoad(scriptFunction, scriptFunction->GetFunctionBody()->GetUtf8SourceInfo(), nullptr);
+                    return JsNoError;
+                }
+                byteCodeCache->Remove(entry);
+            }
+
+            loadScriptFlag = (LoadScriptFlag)(loadScriptFlag | LoadScriptFlag_disableDeferredParse);
+        }
+
 #if ENABLE_TTD
+        // Streamed sources are only parsed as they arrive when time travel is off
+        Assert(sourceStream == nullptr || !scriptContext->IsTTDRecordOrReplayModeEnabled());
+
         TTD::NSLogEvents::EventLogEntry* parseEvent = nullptr;
         if(PERFORM_JSRT_TTD_RECORD_ACTION_CHECK(scriptContext))
         {
@@ -2927,7 +3047,13 @@ JsErrorCode RunScriptCore(JsValueRef scriptSource, const byte *script, size_t cb
 
         scriptFunction = scriptContext->LoadScript(script, cb,
             &si, &se, &utf8SourceInfo,
-            Js::Constants::GlobalCode, loadScriptFlag, scriptSource);
+            Js::Constants::GlobalCode, loadScriptFlag, scriptSource,
+            parserState, parserStateSize, sourceStream);
+
+        if (byteCodeCache != nullptr && scriptFunction != nullptr)
+        {
+            AddSharedByteCode(scriptContext, byteCodeCache, script, cb, sharedByteCodeFlag, scriptFunction);
+        }
 
 #if ENABLE_TTD
         if(PERFORM_JSRT_TTD_RECORD_ACTION_CHECK(scriptContext))
@@ -4126,27 +4252,15 @@ CHAKRA_API JsCreateStringUtf16(
 }
 
 
-template <class CopyFunc>
-JsErrorCode WriteStringCopy(
-    JsValueRef value,
+template <class SrcChar, class CopyFunc>
+JsErrorCode WriteCharsCopy(
+    const SrcChar* str,
+    size_t strLength,
     int start,
     int length,
     _Out_opt_ size_t* written,
     const CopyFunc& copyFunc)
 {
-    if (written)
-    {
-        *written = 0;  // init to 0 for default
-    }
-
-    const char16* str = nullptr;
-    size_t strLength = 0;
-    JsErrorCode errorCode = JsStringToPointer(value, &str, &strLength);
-    if (errorCode != JsNoError)
-    {
-        return errorCode;
-    }
-
     if (start < 0 || (size_t)start > strLength)
     {
         return JsErrorInvalidArgument;  // start out of range, no chars written
@@ -4158,7 +4272,7 @@ JsErrorCode WriteStringCopy(
         return JsNoError;  // no chars written
     }
 
-    errorCode = copyFunc(str + start, count, written);
+    JsErrorCode errorCode = copyFunc(str + start, count, written);
     if (errorCode != JsNoError)
     {
         return errorCode;
@@ -4172,6 +4286,30 @@ JsErrorCode WriteStringCopy(
     return JsNoError;
 }
 
+template <class CopyFunc>
+JsErrorCode WriteStringCopy(
+    JsValueRef value,
+    int start,
+    int length,
+    _Out_opt_ size_t* written,
+    const CopyFunc& copyFunc)
+{
+    if (written)
+    {
+        *written = 0;  // init to 0 for default
+    }
+
+    const char16* str = nullptr;
+    size_t strLength = 0;
+    JsErrorCode errorCode = JsStringToPointer(value, &str, &strLength);
+    if (errorCode != JsNoError)
+    {
+        return errorCode;
+    }
+
+    return WriteCharsCopy(str, strLength, start, length, written, copyFunc);
+}
+
 CHAKRA_API JsCopyString(
     _In_ JsValueRef value,
     _In_ int start,
@@ -4182,6 +4320,30 @@ CHAKRA_API JsCopyString(
     PARAM_NOT_NULL(value);
     VALIDATE_JSREF(value);
 
+    if (Js::JavascriptString::Is(value) && Js::JsrtExternalOneByteString::Is(value))
+    {
+        // Copy the host's bytes, without widening the string
+        Js::JsrtExternalOneByteString *oneByteString = Js::JsrtExternalOneByteString::FromVar(value);
+        if (written)
+        {
+            *written = 0;  // init to 0 for default
+        }
+
+        return WriteCharsCopy(oneByteString->GetOneByteContent(), oneByteString->GetLength(), start, length, written,
+            [buffer](const char* src, size_t count, size_t *needed)
+            {
+                if (buffer)
+                {
+                    memmove(buffer, src, sizeof(char) * count);
+                }
+                else
+                {
+                    *needed = count;
+                }
+                return JsNoError;
+            });
+    }
+
     return WriteStringCopy(value, start, length, written,
         [buffer](const char16* src, size_t count, size_t *needed)
         {
@@ -4267,18 +4429,138 @@ CHAKRA_API JsCopyStringUtf8(
     return JsNoError;
 }
 
+CHAKRA_API JsCreateExternalString(
+    _In_reads_(length) const char *content,
+    _In_ size_t length,
+    _In_opt_ JsFinalizeCallback finalizeCallback,
+    _In_opt_ void *callbackState,
+    _Out_ JsValueRef *value)
+{
+    return ContextAPINoScriptWrapper([&](Js::ScriptContext *scriptContext, TTDRecorder& _actionEntryPopper) -> JsErrorCode {
+        PARAM_NOT_NULL(content);
+        PARAM_NOT_NULL(value);
+
+        if (!Js::IsValidCharCount(length))
+        {
+            Js::JavascriptError::ThrowOutOfMemoryError(scriptContext);
+        }
+
+        Js::JsrtExternalOneByteString *oneByteString = Js::JsrtExternalOneByteString::New(content, static_cast<charcount_t>(length),
+            finalizeCallback, callbackState, scriptContext);
+
+        // The log holds Utf16 strings and the replay creates an ordinary string with the same characters, so the
+        // string is widened when recording
+        PERFORM_JSRT_TTD_RECORD_ACTION(scriptContext, RecordJsRTCreateString, oneByteString->GetSz(), length);
+
+        *value = oneByteString;
+
+        PERFORM_JSRT_TTD_RECORD_ACTION_RESULT(scriptContext, value);
+
+        return JsNoError;
+    });
+}
+
+CHAKRA_API JsCreateExternalStringUtf16(
+    _In_reads_(length + 1) const uint16_t *content,
+    _In_ size_t length,
+    _In_opt_ JsFinalizeCallback finalizeCallback,
+    _In_opt_ void *callbackState,
+    _Out_ JsValueRef *value)
+{
+    return ContextAPINoScriptWrapper([&](Js::ScriptContext *scriptContext, TTDRecorder& _actionEntryPopper) -> JsErrorCode {
+        PERFORM_JSRT_TTD_RECORD_ACTION(scriptContext, RecordJsRTCreateString, reinterpret_cast<const char16*>(content), length);
+
+        PARAM_NOT_NULL(content);
+        PARAM_NOT_NULL(value);
+
+        if (!Js::IsValidCharCount(length))
+        {
+            Js::JavascriptError::ThrowOutOfMemoryError(scriptContext);
+        }
+
+        // The engine reads the buffer as a null terminated string
+        if (content[length] != 0)
+        {
+            return JsErrorInvalidArgument;
+        }
+
+        *value = Js::JsrtExternalString::New(reinterpret_cast<const char16*>(content), static_cast<charcount_t>(length),
+            finalizeCallback, callbackState, scriptContext);
+
+        PERFORM_JSRT_TTD_RECORD_ACTION_RESULT(scriptContext, value);
+
+        return JsNoError;
+    });
+}
+
+CHAKRA_API JsGetStringBuffer(
+    _In_ JsValueRef value,
+    _Outptr_result_buffer_(*length) const void **buffer,
+    _Out_ size_t *length,
+    _Out_ JsStringEncoding *encoding)
+{
+    VALIDATE_JSREF(value);
+    PARAM_NOT_NULL(buffer);
+    *buffer = nullptr;
+    PARAM_NOT_NULL(length);
+    *length = 0;
+    PARAM_NOT_NULL(encoding);
+    *encoding = JsStringEncodingUtf16;
+
+    if (!Js::JavascriptString::Is(value))
+    {
+        return JsErrorInvalidArgument;
+    }
+
+    // Flattening a concatenation allocates, which needs a current context and a runtime that can allocate
+    return ContextAPINoScriptWrapper_NoRecord([&](Js::ScriptContext *scriptContext) -> JsErrorCode {
+        Js::JavascriptString *jsString = Js::JavascriptString::FromVar(value);
+
+        if (Js::JsrtExternalOneByteString::Is(jsString))
+        {
+            *buffer = Js::JsrtExternalOneByteString::FromVar(jsString)->GetOneByteContent();
+            *encoding = JsStringEncodingOneByte;
+        }
+        else
+        {
+            // Flattens the string if it isn't contiguous yet
+            *buffer = jsString->GetString();
+        }
+        *length = jsString->GetLength();
+        return JsNoError;
+    });
+}
+
 _ALWAYSINLINE JsErrorCode CompileRun(
     JsValueRef scriptVal,
     JsSourceContext sourceContext,
     JsValueRef sourceUrl,
     JsParseScriptAttributes parseAttributes,
     _Out_ JsValueRef *result,
-    bool parseOnly)
+    bool parseOnly,
+    JsValueRef parserStateVal = nullptr)
 {
     PARAM_NOT_NULL(scriptVal);
     VALIDATE_JSREF(scriptVal);
     PARAM_NOT_NULL(sourceUrl);
 
+    const byte* parserState = nullptr;
+    size_t parserStateSize = 0;
+    if (parserStateVal != nullptr)
+    {
+        VALIDATE_JSREF(parserStateVal);
+        if (!Js::ArrayBuffer::Is(parserStateVal))
+        {
+            return JsErrorInvalidArgument;
+        }
+        parserState = Js::ArrayBuffer::FromVar(parserStateVal)->GetBuffer();
+        parserStateSize = Js::ArrayBuffer::FromVar(parserStateVal)->GetByteLength();
+        if (!Js::ScriptContext::IsValidParserState(parserState, parserStateSize))
+        {
+            return JsErrorInvalidArgument;
+        }
+    }
+
     bool isExternalArray = Js::ExternalArrayBuffer::Is(scriptVal),
          isString = false;
     bool isUtf8   = !(parseAttributes & JsParseScriptAttributeArrayBufferIsUtf16Encoded);
@@ -4334,7 +4616,8 @@ _ALWAYSINLINE JsErrorCode CompileRun(
     }
 
     return RunScriptCore(scriptVal, script, cb, scriptFlag,
-        sourceContext, url, parseOnly, parseAttributes, false, result);
+        sourceContext, url, parseOnly, parseAttributes, false, result,
+        parserState, parserStateSize);
 }
 
 CHAKRA_API JsParse(
@@ -4359,6 +4642,144 @@ CHAKRA_API JsRun(
         result, false);
 }
 
+CHAKRA_API JsCreateScriptSourceStream(
+    _In_ size_t expectedLength,
+    _Out_ JsScriptSourceStream *stream)
+{
+    PARAM_NOT_NULL(stream);
+    *stream = nullptr;
+
+    return GlobalAPIWrapper_NoRecord([&]() -> JsErrorCode {
+        *stream = JsrtScriptSourceStream::New(expectedLength);
+        return JsNoError;
+    });
+}
+
+CHAKRA_API JsAppendScriptSourceStream(
+    _In_ JsScriptSourceStream stream,
+    _In_reads_(length) const uint8_t *chunk,
+    _In_ size_t length,
+    _In_ bool isLastChunk)
+{
+    PARAM_NOT_NULL(stream);
+    if (length != 0)
+    {
+        PARAM_NOT_NULL(chunk);
+    }
+
+    return static_cast<JsrtScriptSourceStream *>(stream)->Append(chunk, length, isLastChunk);
+}
+
+CHAKRA_API JsParseScriptSourceStream(
+    _In_ JsScriptSourceStream stream,
+    _In_ JsSourceContext sourceContext,
+    _In_ JsValueRef sourceUrl,
+    _In_ JsParseScriptAttributes parseAttributes,
+    _Out_ JsValueRef *result)
+{
+    PARAM_NOT_NULL(stream);
+    PARAM_NOT_NULL(sourceUrl);
+    VALIDATE_JSREF(sourceUrl);
+    PARAM_NOT_NULL(result);
+
+    if (parseAttributes & JsParseScriptAttributeArrayBufferIsUtf16Encoded)
+    {
+        return JsErrorInvalidArgument;
+    }
+
+    if (JsrtContext::GetCurrent() == nullptr)
+    {
+        return JsErrorNoCurrentContext;
+    }
+
+    const wchar_t *url = nullptr;
+    JsErrorCode errorCode = GlobalAPIWrapper_NoRecord([&]() -> JsErrorCode {
+        if (!Js::JavascriptString::Is(sourceUrl))
+        {
+            return JsErrorInvalidArgument;
+        }
+
+        url = Js::JavascriptString::FromVar(sourceUrl)->GetSz();
+        return JsNoError;
+    });
+
+    if (errorCode != JsNoError)
+    {
+        return errorCode;
+    }
+
+    JsrtScriptSourceStream *sourceStream = static_cast<JsrtScriptSourceStream *>(stream);
+    if (!sourceStream->BeginParse())
+    {
+        return JsErrorInvalidArgument;
+    }
+
+    // Byte code is only shared, and parses only recorded for time travel, once the whole source is known
+    bool waitForLastChunk = (parseAttributes & JsParseScriptAttributeShareByteCode) == JsParseScriptAttributeShareByteCode;
+#if ENABLE_TTD
+    waitForLastChunk = waitForLastChunk || JsrtContext::GetCurrent()->GetScriptContext()->IsTTDRecordOrReplayModeEnabled();
+#endif
+
+    if (waitForLastChunk)
+    {
+        // The host may still be appending from its I/O thread
+        size_t length;
+        bool isComplete;
+        LPCUTF8 buffer = sourceStream->WaitForSource(SIZE_MAX, &length, &isComplete);
+
+        // Hand the accumulated buffer to the parser as an external ArrayBuffer. The
+        // ArrayBuffer keeps the stream alive until the source is no longer needed.
+        JsValueRef sourceBuffer = JS_INVALID_REFERENCE;
+        sourceStream->AddRef();
+        errorCode = JsCreateExternalArrayBuffer(const_cast<utf8char_t *>(buffer),
+            static_cast<unsigned int>(length), JsrtScriptSourceStream::ReleaseSourceBuffer,
+            sourceStream, &sourceBuffer);
+        if (errorCode != JsNoError)
+        {
+            sourceStream->Release();
+        }
+        else
+        {
+            errorCode = CompileRun(sourceBuffer, sourceContext, sourceUrl, parseAttributes,
+                result, true);
+        }
+    }
+    else
+    {
+        // The parse starts on what has arrived so far and the scanner waits for the rest as it gets
+        // to it. Where the source ends up is only known once it is all in, so what keeps it alive is
+        // an empty ArrayBuffer that holds on to the stream instead.
+        JsValueRef sourceRef = JS_INVALID_REFERENCE;
+        sourceStream->AddRef();
+        errorCode = JsCreateExternalArrayBuffer(nullptr, 0, JsrtScriptSourceStream::ReleaseSourceBuffer,
+            sourceStream, &sourceRef);
+        if (errorCode != JsNoError)
+        {
+            sourceStream->Release();
+        }
+        else
+        {
+            errorCode = RunScriptCore(sourceRef, nullptr, sourceStream->GetExpectedLength(),
+                (LoadScriptFlag)(LoadScriptFlag_ExternalArrayBuffer | LoadScriptFlag_Utf8Source),
+                sourceContext, url, true, parseAttributes, false, result,
+                nullptr, 0, sourceStream);
+        }
+    }
+
+    // Nothing points into the buffers the source was in before it moved anymore
+    sourceStream->EndParse();
+    return errorCode;
+}
+
+CHAKRA_API JsDisposeScriptSourceStream(
+    _In_ JsScriptSourceStream stream)
+{
+    PARAM_NOT_NULL(stream);
+
+    static_cast<JsrtScriptSourceStream *>(stream)->Release();
+    return JsNoError;
+}
+
 CHAKRA_API JsCreatePropertyIdUtf8(
     _In_z_ const char *name,
     _In_ size_t length,
@@ -4514,4 +4935,331 @@ CHAKRA_API JsRunSerialized(
         sourceContext, // use the same user provided sourceContext as scriptLoadSourceContext
         buffer, sourceContext, url, false, result);
 }
+
+CHAKRA_API JsSerializeParserState(
+    _In_ JsValueRef scriptVal,
+    _Out_ JsValueRef *bufferVal,
+    _In_ JsParseScriptAttributes parseAttributes)
+{
+    PARAM_NOT_NULL(scriptVal);
+    VALIDATE_JSREF(scriptVal);
+    PARAM_NOT_NULL(bufferVal);
+    *bufferVal = nullptr;
+
+    bool isExternalArray = Js::ExternalArrayBuffer::Is(scriptVal);
+    bool isUtf8 = !(parseAttributes & JsParseScriptAttributeArrayBufferIsUtf16Encoded);
+    if (!isExternalArray && !Js::JavascriptString::Is(scriptVal))
+    {
+        return JsErrorInvalidArgument;
+    }
+
+    CompileScriptException se;
+    JsErrorCode errorCode = ContextAPINoScriptWrapper_NoRecord([&](Js::ScriptContext *scriptContext) -> JsErrorCode {
+        LoadScriptFlag scriptFlag = LoadScriptFlag_None;
+        const byte* script;
+        size_t cb;
+
+        if (isExternalArray)
+        {
+            script = ((Js::ExternalArrayBuffer*)(scriptVal))->GetBuffer();
+            cb = ((Js::ExternalArrayBuffer*)(scriptVal))->GetByteLength();
+            scriptFlag = (LoadScriptFlag)(isUtf8 ?
+                LoadScriptFlag_ExternalArrayBuffer | LoadScriptFlag_Utf8Source :
+                LoadScriptFlag_ExternalArrayBuffer);
+        }
+        else
+        {
+            Js::JavascriptString* jsString = Js::JavascriptString::FromVar(scriptVal);
+            script = (const byte*)jsString->GetSz();
+
+            // JavascriptString is 2 bytes (wchar_t/char16)
+            cb = jsString->GetLength() * sizeof(wchar_t);
+        }
+
+        SourceContextInfo * sourceContextInfo = scriptContext->GetSourceContextInfo(JS_SOURCE_CONTEXT_NONE, nullptr);
+        Assert(sourceContextInfo != nullptr);
+
+        const int chsize = (scriptFlag & LoadScriptFlag_Utf8Source) ? sizeof(utf8char_t) : sizeof(wchar_t);
+        SRCINFO si = {
+            /* sourceContextInfo   */ sourceContextInfo,
+            /* dlnHost             */ 0,
+            /* ulColumnHost        */ 0,
+            /* lnMinHost           */ 0,
+            /* ichMinHost          */ 0,
+            /* ichLimHost          */ static_cast<ULONG>(cb / chsize), // OK to truncate since this is used to limit sourceText in debugDocument/compilation errors.
+            /* ulCharOffset        */ 0,
+            /* mod                 */ kmodGlobal,
+            /* grfsi               */ 0
+        };
+
+        Js::Utf8SourceInfo* sourceInfo = nullptr;
+        byte* buffer = nullptr;
+        uint32 bufferSize = 0;
+
+        BEGIN_TEMP_ALLOCATOR(tempAllocator, scriptContext, _u("ParserState"));
+        HRESULT hr = scriptContext->SerializeParserState(script, cb, &si, &se, &sourceInfo,
+            Js::Constants::GlobalCode, scriptFlag, tempAllocator, &buffer, &bufferSize, scriptVal);
+        if (SUCCEEDED(hr))
+        {
+            Js::ArrayBuffer* arrayBuffer = scriptContext->GetLibrary()->CreateArrayBuffer(bufferSize);
+            js_memcpy_s(arrayBuffer->GetBuffer(), arrayBuffer->GetByteLength(), buffer, bufferSize);
+            *bufferVal = arrayBuffer;
+        }
+        END_TEMP_ALLOCATOR(tempAllocator, scriptContext);
+
+        return JsNoError;
+    });
+
+    if (errorCode != JsNoError || *bufferVal != nullptr)
+    {
+        return errorCode;
+    }
+
+    return ContextAPIWrapper_NoRecord<false>([&](Js::ScriptContext* scriptContext) -> JsErrorCode {
+        HandleScriptCompileError(scriptContext, &se);
+        return JsErrorScriptCompile;
+    });
+}
+
+CHAKRA_API JsRunScriptWithParserState(
+    _In_ JsValueRef scriptVal,
+    _In_ JsSourceContext sourceContext,
+    _In_ JsValueRef sourceUrl,
+    _In_ JsParseScriptAttributes parseAttributes,
+    _In_ JsValueRef parserState,
+    _Out_ JsValueRef *result)
+{
+    PARAM_NOT_NULL(parserState);
+
+    return CompileRun(scriptVal, sourceContext, sourceUrl, parseAttributes,
+        result, false, parserState);
+}
+
+CHAKRA_API JsGetRuntimeCollectionStatistics(_In_ JsRuntimeHandle runtimeHandle, _Out_ JsCollectionStatistics * statistics)
+{
+    return GlobalAPIWrapper_NoRecord([&]() -> JsErrorCode {
+        VALIDATE_INCOMING_RUNTIME_HANDLE(runtimeHandle);
+        PARAM_NOT_NULL(statistics);
+        memset(statistics, 0, sizeof(JsCollectionStatistics));
+
+        ThreadContext * threadContext = JsrtRuntime::FromHandle(runtimeHandle)->GetThreadContext();
+        ThreadContextScope scope(threadContext);
+
+        if (!scope.IsValid())
+        {
+            return JsErrorWrongThread;
+        }
+
+        Recycler * recycler = threadContext->GetRecycler();
+        if (recycler != nullptr)
+        {
+            JsrtRuntime::GetCollectionStatistics(recycler, statistics);
+        }
+
+        return JsNoError;
+    });
+}
+
+CHAKRA_API JsGetRuntimeHeapStatistics(
+    _In_ JsRuntimeHandle runtimeHandle,
+    _Out_writes_opt_(count) JsHeapSizeClassStatistics * statistics,
+    _In_ unsigned int count,
+    _Out_ unsigned int * actualCount)
+{
+    return GlobalAPIWrapper_NoRecord([&]() -> JsErrorCode {
+        VALIDATE_INCOMING_RUNTIME_HANDLE(runtimeHandle);
+        PARAM_NOT_NULL(actualCount);
+        *actualCount = Recycler::GetSizeClassCount();
+
+        ThreadContext * threadContext = JsrtRuntime::FromHandle(runtimeHandle)->GetThreadContext();
+        Recycler * recycler = threadContext->GetRecycler();
+
+        if (recycler && recycler->IsHeapEnumInProgress())
+        {
+            return JsErrorHeapEnumInProgress;
+        }
+        else if (threadContext->IsInThreadServiceCallback())
+        {
+            return JsErrorInThreadServiceCallback;
+        }
+
+        ThreadContextScope scope(threadContext);
+
+        if (!scope.IsValid())
+        {
+            return JsErrorWrongThread;
+        }
+
+        // The allocators' blocks are only consistent between allocations, so don't walk the heap
+        // from a callout of script (or of a collection, whose heap blocks are being swept or moved
+        // between lists)
+        if (threadContext->IsInScript() || (recycler && recycler->CollectionInProgress()))
+        {
+            return JsErrorRuntimeInUse;
+        }
+
+        if (statistics == nullptr || recycler == nullptr)
+        {
+            return JsNoError;
+        }
+
+        const unsigned int sizeClassCount = min(count, *actualCount);
+        for (unsigned int i = 0; i < sizeClassCount; i++)
+        {
+            HeapBucketStats stats;
+            memset(&stats, 0, sizeof(stats));
+            statistics[i].objectSize = recycler->AggregateSizeClassStats(i, stats);
+            statistics[i].blockCount = stats.totalBlockCount;
+            statistics[i].emptyBlockCount = stats.emptyBlockCount;
+            statistics[i].objectCount = stats.objectCount;
+            statistics[i].objectBytes = stats.objectByteCount;
+            statistics[i].blockBytes = stats.totalByteCount;
+        }
+
+        return JsNoError;
+    });
+}
+
+CHAKRA_API JsSetRuntimeCollectionEndCallback(_In_ JsRuntimeHandle runtime, _In_opt_ void *callbackState, _In_opt_ JsCollectionEndCallback collectionEndCallback)
+{
+    return GlobalAPIWrapper_NoRecord([&]() -> JsErrorCode {
+        VALIDATE_INCOMING_RUNTIME_HANDLE(runtime);
+
+        JsrtRuntime::FromHandle(runtime)->SetCollectionEndCallback(collectionEndCallback, callbackState);
+        return JsNoError;
+    });
+}
+
+CHAKRA_API JsGetRuntimeJitStatistics(_In_ JsRuntimeHandle runtimeHandle, _Out_ JsJitStatistics * statistics)
+{
+    VALIDATE_INCOMING_RUNTIME_HANDLE(runtimeHandle);
+    PARAM_NOT_NULL(statistics);
+
+    const ThreadContextJitStatistics * jitStatistics = JsrtRuntime::FromHandle(runtimeHandle)->GetThreadContext()->GetJitStatistics();
+    statistics->simpleJitFunctionCount = jitStatistics->simpleJitFunctionCount;
+    statistics->fullJitFunctionCount = jitStatistics->fullJitFunctionCount;
+    statistics->loopBodyCount = jitStatistics->loopBodyCount;
+    statistics->failedCount = jitStatistics->failedCount;
+    statistics->bailOutCount = jitStatistics->bailOutCount;
+    statistics->rejitCount = jitStatistics->rejitCount;
+    return JsNoError;
+}
+
+// The profile is only touched on the thread running script, at its stack probes
+static bool IsRunningScriptOnOtherThread(ThreadContext * threadContext)
+{
+    return threadContext->IsInScript() && threadContext->GetCurrentThreadId() != ::GetCurrentThreadId();
+}
+
+CHAKRA_API JsStartSamplingProfiler(_In_ JsRuntimeHandle runtime, _In_ unsigned int intervalMicroseconds)
+{
+    return GlobalAPIWrapper_NoRecord([&]() -> JsErrorCode {
+        VALIDATE_INCOMING_RUNTIME_HANDLE(runtime);
+        if (intervalMicroseconds == 0)
+        {
+            return JsErrorInvalidArgument;
+        }
+
+        ThreadContext * threadContext = JsrtRuntime::FromHandle(runtime)->GetThreadContext();
+        if (IsRunningScriptOnOtherThread(threadContext))
+        {
+            return JsErrorRuntimeInUse;
+        }
+
+        if (!threadContext->EnsureSamplingProfiler()->Start(intervalMicroseconds))
+        {
+            return JsErrorAlreadyProfilingContext;
+        }
+        return JsNoError;
+    });
+}
+
+CHAKRA_API JsStopSamplingProfiler(_In_ JsRuntimeHandle runtime)
+{
+    return GlobalAPIWrapper_NoRecord([&]() -> JsErrorCode {
+        VALIDATE_INCOMING_RUNTIME_HANDLE(runtime);
+
+        ThreadContext * threadContext = JsrtRuntime::FromHandle(runtime)->GetThreadContext();
+        if (IsRunningScriptOnOtherThread(threadContext))
+        {
+            return JsErrorRuntimeInUse;
+        }
+
+        Js::SamplingProfiler * profiler = threadContext->GetSamplingProfiler();
+        if (profiler != nullptr)
+        {
+            profiler->Stop();
+        }
+        return JsNoError;
+    });
+}
+
+CHAKRA_API JsCopySamplingProfile(
+    _In_ JsRuntimeHandle runtime,
+    _Out_writes_opt_(bufferSize) char * buffer,
+    _In_ size_t bufferSize,
+    _Out_opt_ size_t * written)
+{
+    return GlobalAPIWrapper_NoRecord([&]() -> JsErrorCode {
+        VALIDATE_INCOMING_RUNTIME_HANDLE(runtime);
+
+        ThreadContext * threadContext = JsrtRuntime::FromHandle(runtime)->GetThreadContext();
+        if (IsRunningScriptOnOtherThread(threadContext))
+        {
+            return JsErrorRuntimeInUse;
+        }
+
+        // Without a profiler, the profile is empty
+        Js::SamplingProfiler * profiler = threadContext->EnsureSamplingProfiler();
+        size_t length = profiler->WriteProfile(buffer, buffer != nullptr ? bufferSize : 0);
+        if (written != nullptr)
+        {
+            *written = buffer != nullptr ? min(bufferSize, length) : length;
+        }
+        return JsNoError;
+    });
+}
+
+CHAKRA_API JsTakeHeapSnapshot(
+    _In_ JsRuntimeHandle runtime,
+    _In_ JsHeapSnapshotAttributes attributes,
+    _In_ JsHeapSnapshotWriteCallback writeCallback,
+    _In_opt_ void * callbackState)
+{
+    return GlobalAPIWrapper_NoRecord([&]() -> JsErrorCode {
+        VALIDATE_INCOMING_RUNTIME_HANDLE(runtime);
+        PARAM_NOT_NULL(writeCallback);
+        if ((attributes & ~JsHeapSnapshotAttributeRetainedSizes) != 0)
+        {
+            return JsErrorInvalidArgument;
+        }
+
+        ThreadContext * threadContext = JsrtRuntime::FromHandle(runtime)->GetThreadContext();
+        if (threadContext->GetRecycler() && threadContext->GetRecycler()->IsHeapEnumInProgress())
+        {
+            return JsErrorHeapEnumInProgress;
+        }
+        else if (threadContext->IsInThreadServiceCallback())
+        {
+            return JsErrorInThreadServiceCallback;
+        }
+
+        // The stack of the runtime's thread is one of the roots, so the snapshot must be taken on it
+        ThreadContextScope scope(threadContext);
+        if (!scope.IsValid())
+        {
+            return JsErrorWrongThread;
+        }
+
+        Recycler * recycler = threadContext->EnsureRecycler();
+        if (recycler->IsInObjectBeforeCollectCallback())
+        {
+            return JsErrorInObjectBeforeCollectCallback;
+        }
+
+        JsrtHeapSnapshot snapshot(threadContext, (attributes & JsHeapSnapshotAttributeRetainedSizes) != 0);
+        snapshot.Write(writeCallback, callbackState);
+        return JsNoError;
+    });
+}
 #endif // NTBUILD
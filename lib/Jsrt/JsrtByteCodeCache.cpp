@@ -0,0 +1,170 @@
+//-------------------------------------------------------------------------------------------------------
+// Copyright (C) Microsoft. All rights reserved.
+// Licensed under the MIT license. See LICENSE.txt file in the project root for full license information.
+//-------------------------------------------------------------------------------------------------------
+#include "JsrtPch.h"
+#include "JsrtByteCodeCache.h"
+
+JsrtByteCodeCache::JsrtByteCodeCache() :
+    entries(&HeapAllocator::Instance),
+    removedEntries(nullptr)
+{
+}
+
+JsrtByteCodeCache::~JsrtByteCodeCache()
+{
+    entries.Map([](int hash, Entry * entry)
+    {
+        DeleteEntries(entry);
+    });
+    DeleteEntries(removedEntries);
+}
+
+int JsrtByteCodeCache::GetHashCode(const byte * script, size_t cb)
+{
+    return JsUtil::CharacterBuffer<utf8char_t>::StaticGetHashCode(script, (charcount_t)cb);
+}
+
+size_t JsrtByteCodeCache::GetEntryDataSize(const Entry * entry)
+{
+    return (entry->utf8Source == entry->script ? entry->cb : entry->cb + entry->cbUtf8Source) + 1;
+}
+
+void JsrtByteCodeCache::DeleteEntry(Entry * entry)
+{
+    CoTaskMemFree(entry->buffer);
+    HeapDeletePlus(GetEntryDataSize(entry), entry);
+}
+
+void JsrtByteCodeCache::DeleteEntries(Entry * entry)
+{
+    while (entry != nullptr)
+    {
+        Entry * next = entry->next;
+        DeleteEntry(entry);
+        entry = next;
+    }
+}
+
+#if DBG
+bool JsrtByteCodeCache::IsIntact(const Entry * entry)
+{
+    return GetHashCode(entry->buffer, entry->bufferSize) == entry->bufferHash;
+}
+#endif
+
+const JsrtByteCodeCache::Entry * JsrtByteCodeCache::Lookup(const byte * script, size_t cb, LoadScriptFlag loadScriptFlag) const
+{
+    Entry * entry;
+    if (!entries.TryGetValue(GetHashCode(script, cb), &entry))
+    {
+        return nullptr;
+    }
+
+    for (; entry != nullptr; entry = entry->next)
+    {
+        if (entry->loadScriptFlag == loadScriptFlag && entry->cb == cb && memcmp(entry->script, script, cb) == 0)
+        {
+            return entry;
+        }
+    }
+    return nullptr;
+}
+
+bool JsrtByteCodeCache::Add(const byte * script, size_t cb, LoadScriptFlag loadScriptFlag, LPCUTF8 utf8Source, size_t cbUtf8Source, byte * buffer, DWORD bufferSize)
+{
+    Assert(Lookup(script, cb, loadScriptFlag) == nullptr);
+
+    // The source the byte code was generated from is needed to deserialize it. It is the script itself if
+    // the script was already utf8. Either way it is null terminated, like the sources the scanner reads.
+    const bool isScriptUtf8Source = cb == cbUtf8Source && memcmp(script, utf8Source, cb) == 0;
+    const size_t dataSize = (isScriptUtf8Source ? cb : cb + cbUtf8Source) + 1;
+
+    Entry * entry = HeapNewNoThrowPlus(dataSize, Entry);
+    if (entry == nullptr)
+    {
+        CoTaskMemFree(buffer);
+        return false;
+    }
+
+    byte * data = reinterpret_cast<byte *>(entry + 1);
+    js_memcpy_s(data, dataSize, script, cb);
+    if (!isScriptUtf8Source)
+    {
+        js_memcpy_s(data + cb, dataSize - cb, utf8Source, cbUtf8Source);
+    }
+    data[dataSize - 1] = 0;
+
+    const int hash = GetHashCode(script, cb);
+    entry->loadScriptFlag = loadScriptFlag;
+    entry->script = data;
+    entry->cb = cb;
+    entry->utf8Source = isScriptUtf8Source ? data : data + cb;
+    entry->cbUtf8Source = cbUtf8Source;
+    entry->buffer = buffer;
+    entry->bufferSize = bufferSize;
+#if DBG
+    entry->bufferHash = GetHashCode(buffer, bufferSize);
+#endif
+
+    Entry * next = nullptr;
+    entries.TryGetValue(hash, &next);
+    entry->next = next;
+
+    try
+    {
+        entries.Item(hash, entry);
+    }
+    catch (Js::OutOfMemoryException)
+    {
+        DeleteEntry(entry);
+        return false;
+    }
+    return true;
+}
+
+void JsrtByteCodeCache::Remove(const Entry * entry)
+{
+    const int hash = GetHashCode(entry->script, entry->cb);
+    Entry * first = nullptr;
+    if (!entries.TryGetValue(hash, &first))
+    {
+        Assert(false);
+        return;
+    }
+
+    Entry * removed = nullptr;
+    if (first == entry)
+    {
+        removed = first;
+        if (first->next != nullptr)
+        {
+            // Replacing the value of an existing key doesn't allocate
+            entries.Item(hash, first->next);
+        }
+        else
+        {
+            entries.Remove(hash);
+        }
+    }
+    else
+    {
+        for (Entry * previous = first; previous->next != nullptr; previous = previous->next)
+        {
+            if (previous->next == entry)
+            {
+                removed = previous->next;
+                previous->next = removed->next;
+                break;
+            }
+        }
+    }
+
+    Assert(removed != nullptr);
+    if (removed != nullptr)
+    {
+        // The byte code blocks of the functions deserialized from the entry still point into its buffer
+        removed->next = removedEntries;
+        removedEntries = removed;
+    }
+}
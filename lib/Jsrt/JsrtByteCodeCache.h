@@ -0,0 +1,61 @@
+//-------------------------------------------------------------------------------------------------------
+// Copyright (C) Microsoft. All rights reserved.
+// Licensed under the MIT license. See LICENSE.txt file in the project root for full license information.
+//-------------------------------------------------------------------------------------------------------
+#pragma once
+
+// Serialized byte code of the scripts loaded with JsParseScriptAttributeShareByteCode, shared by all
+// the contexts of a runtime.
+//
+// The first context that loads a script generates its byte code as usual and adds it to the cache. Other
+// contexts that load the same script deserialize it from the cache instead of parsing it. The byte code
+// blocks of the deserialized functions point into the cached buffer and are never written to, so only
+// the per-context state (auxiliary data, literals, inline caches, profile data) is allocated per context.
+//
+// The entries are kept for the lifetime of the runtime, since the functions of any context may still
+// reference them. An entry whose byte code can't be loaded anymore is only taken out of the lookup; the
+// script is then parsed again and its new byte code cached instead.
+class JsrtByteCodeCache
+{
+public:
+    struct Entry
+    {
+        Entry * next;
+        LoadScriptFlag loadScriptFlag;
+        const byte * script;
+        size_t cb;
+        LPCUTF8 utf8Source;
+        size_t cbUtf8Source;
+        byte * buffer;
+        DWORD bufferSize;
+#if DBG
+        int bufferHash;
+#endif
+    };
+
+    JsrtByteCodeCache();
+    ~JsrtByteCodeCache();
+
+    const Entry * Lookup(const byte * script, size_t cb, LoadScriptFlag loadScriptFlag) const;
+
+#if DBG
+    // Whether the byte code of the entry is still what was added. Hashes the whole buffer, so only asserted.
+    static bool IsIntact(const Entry * entry);
+#endif
+
+    // Takes ownership of the CoTaskMemAlloc'ed buffer, even if the entry can't be added for lack of memory
+    bool Add(const byte * script, size_t cb, LoadScriptFlag loadScriptFlag, LPCUTF8 utf8Source, size_t cbUtf8Source, byte * buffer, DWORD bufferSize);
+
+    // Takes the entry out of the lookup; functions deserialized from it keep working
+    void Remove(const Entry * entry);
+
+private:
+    static int GetHashCode(const byte * script, size_t cb);
+    static size_t GetEntryDataSize(const Entry * entry);
+    static void DeleteEntry(Entry * entry);
+    static void DeleteEntries(Entry * entry);
+
+    typedef JsUtil::BaseDictionary<int, Entry *, HeapAllocator> EntryMap;
+    EntryMap entries;
+    Entry * removedEntries;
+};
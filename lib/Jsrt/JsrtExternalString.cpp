@@ -0,0 +1,123 @@
+//-------------------------------------------------------------------------------------------------------
+// Copyright (C) Microsoft. All rights reserved.
+// Licensed under the MIT license. See LICENSE.txt file in the project root for full license information.
+//-------------------------------------------------------------------------------------------------------
+#include "JsrtPch.h"
+#include "JsrtExternalString.h"
+
+namespace Js
+{
+    JsrtExternalString::JsrtExternalString(StaticType *type, const char16 *content, charcount_t charLength, JsFinalizeCallback finalizeCallback, void *callbackState)
+        : JavascriptString(type, charLength, content), finalizeCallback(finalizeCallback), callbackState(callbackState)
+    {
+        Assert(content[charLength] == _u('\0'));
+    }
+
+    JsrtExternalString* JsrtExternalString::New(const char16 *content, charcount_t charLength, JsFinalizeCallback finalizeCallback, void *callbackState, ScriptContext *scriptContext)
+    {
+        Recycler* recycler = scriptContext->GetRecycler();
+        return RecyclerNewFinalized(recycler, JsrtExternalString, scriptContext->GetLibrary()->GetStringTypeStatic(), content, charLength, finalizeCallback, callbackState);
+    }
+
+    void const * JsrtExternalString::GetOriginalStringReference()
+    {
+        // The buffer isn't in the recycler, keeping it alive is keeping this string alive
+        return this;
+    }
+
+    size_t JsrtExternalString::GetAllocatedByteCount() const
+    {
+        return 0;
+    }
+
+    RecyclableObject * JsrtExternalString::CloneToScriptContext(ScriptContext* requestContext)
+    {
+        return JavascriptString::NewCopyBuffer(this->GetSz(), this->GetLength(), requestContext);
+    }
+
+    void JsrtExternalString::Finalize(bool isShutdown)
+    {
+        if (finalizeCallback != nullptr)
+        {
+            finalizeCallback(callbackState);
+        }
+    }
+
+    void JsrtExternalString::Dispose(bool isShutdown)
+    {
+    }
+
+    JsrtExternalOneByteString::JsrtExternalOneByteString(StaticType *type, const char *content, charcount_t charLength, JsFinalizeCallback finalizeCallback, void *callbackState)
+        : JavascriptString(type), content(content), finalizeCallback(finalizeCallback), callbackState(callbackState)
+    {
+        this->SetLength(charLength);
+    }
+
+    JsrtExternalOneByteString* JsrtExternalOneByteString::New(const char *content, charcount_t charLength, JsFinalizeCallback finalizeCallback, void *callbackState, ScriptContext *scriptContext)
+    {
+        Recycler* recycler = scriptContext->GetRecycler();
+        return RecyclerNewFinalized(recycler, JsrtExternalOneByteString, scriptContext->GetLibrary()->GetStringTypeStatic(), content, charLength, finalizeCallback, callbackState);
+    }
+
+    bool JsrtExternalOneByteString::Is(Var aValue)
+    {
+        Assert(JavascriptString::Is(aValue));
+        return VirtualTableInfo<JsrtExternalOneByteString>::HasVirtualTable(aValue);
+    }
+
+    JsrtExternalOneByteString* JsrtExternalOneByteString::FromVar(Var aValue)
+    {
+        Assert(JsrtExternalOneByteString::Is(aValue));
+        return static_cast<JsrtExternalOneByteString *>(aValue);
+    }
+
+    const char16* JsrtExternalOneByteString::GetSz()
+    {
+        if (!this->IsFinalized())
+        {
+            AssertCanHandleOutOfMemory();
+            const charcount_t charLength = this->GetLength();
+            char16* buffer = RecyclerNewArrayLeaf(this->GetScriptContext()->GetRecycler(), char16, SafeSzSize());
+
+            CopyContent(buffer);
+            buffer[charLength] = _u('\0');
+
+            // Unlike a flattened concat string, this keeps its type so that the host is still told when it is collected
+            this->SetBuffer(buffer);
+        }
+        return JavascriptString::GetSz();
+    }
+
+    void JsrtExternalOneByteString::CopyVirtual(
+        _Out_writes_(m_charLength) char16 *const buffer,
+        StringCopyInfoStack &nestedStringTreeCopyInfos,
+        const byte recursionDepth)
+    {
+        Assert(buffer);
+        Assert(!this->IsFinalized());   // CopyVirtual should only be called for unfinalized buffers
+        CopyContent(buffer);
+    }
+
+    void JsrtExternalOneByteString::CopyContent(_Out_writes_(m_charLength) char16 *const buffer) const
+    {
+        // Cast to "unsigned" so that the bytes are widened as Latin-1
+        const unsigned char* src = reinterpret_cast<const unsigned char*>(content);
+        const charcount_t charLength = this->GetLength();
+        for (charcount_t i = 0; i < charLength; i++)
+        {
+            buffer[i] = static_cast<char16>(src[i]);
+        }
+    }
+
+    void JsrtExternalOneByteString::Finalize(bool isShutdown)
+    {
+        if (finalizeCallback != nullptr)
+        {
+            finalizeCallback(callbackState);
+        }
+    }
+
+    void JsrtExternalOneByteString::Dispose(bool isShutdown)
+    {
+    }
+}
@@ -0,0 +1,66 @@
+//-------------------------------------------------------------------------------------------------------
+// Copyright (C) Microsoft. All rights reserved.
+// Licensed under the MIT license. See LICENSE.txt file in the project root for full license information.
+//-------------------------------------------------------------------------------------------------------
+#pragma once
+
+namespace Js {
+    // String whose null terminated UTF-16 characters are owned by the host, which is told when the string is
+    // collected. It is used as is, like a LiteralString; substrings keep it, rather than its buffer, alive.
+    class JsrtExternalString sealed : public JavascriptString
+    {
+    protected:
+        DEFINE_VTABLE_CTOR(JsrtExternalString, JavascriptString);
+        DECLARE_CONCRETE_STRING_CLASS;
+
+        JsrtExternalString(StaticType *type, const char16 *content, charcount_t charLength, JsFinalizeCallback finalizeCallback, void *callbackState);
+
+    public:
+        static JsrtExternalString* New(const char16 *content, charcount_t charLength, JsFinalizeCallback finalizeCallback, void *callbackState, ScriptContext *scriptContext);
+
+        virtual void const * GetOriginalStringReference() override;
+        virtual size_t GetAllocatedByteCount() const override;
+        virtual RecyclableObject * CloneToScriptContext(ScriptContext* requestContext) override;
+
+        void Finalize(bool isShutdown) override;
+        void Dispose(bool isShutdown) override;
+
+    private:
+        JsFinalizeCallback finalizeCallback;
+        void *callbackState;
+    };
+    AUTO_REGISTER_RECYCLER_OBJECT_DUMPER(JsrtExternalString, &Js::RecyclableObject::DumpObjectFunction);
+
+    // String whose one byte (Latin-1) characters are owned by the host, which is told when the string is collected.
+    // The engine works on UTF-16, so the characters are only widened into the recycler the first time something
+    // needs the string's buffer; copies out of the string and into other strings read the host's bytes.
+    class JsrtExternalOneByteString sealed : public JavascriptString
+    {
+    protected:
+        DEFINE_VTABLE_CTOR(JsrtExternalOneByteString, JavascriptString);
+        DECLARE_CONCRETE_STRING_CLASS;
+
+        JsrtExternalOneByteString(StaticType *type, const char *content, charcount_t charLength, JsFinalizeCallback finalizeCallback, void *callbackState);
+
+    public:
+        static JsrtExternalOneByteString* New(const char *content, charcount_t charLength, JsFinalizeCallback finalizeCallback, void *callbackState, ScriptContext *scriptContext);
+        static bool Is(Var aValue);
+        static JsrtExternalOneByteString* FromVar(Var aValue);
+
+        const char* GetOneByteContent() const { return content; }
+
+        virtual const char16* GetSz() override;
+        virtual void CopyVirtual(_Out_writes_(m_charLength) char16 *const buffer, StringCopyInfoStack &nestedStringTreeCopyInfos, const byte recursionDepth) override;
+
+        void Finalize(bool isShutdown) override;
+        void Dispose(bool isShutdown) override;
+
+    private:
+        void CopyContent(_Out_writes_(m_charLength) char16 *const buffer) const;
+
+        const char *content;
+        JsFinalizeCallback finalizeCallback;
+        void *callbackState;
+    };
+    AUTO_REGISTER_RECYCLER_OBJECT_DUMPER(JsrtExternalOneByteString, &Js::RecyclableObject::DumpObjectFunction);
+}
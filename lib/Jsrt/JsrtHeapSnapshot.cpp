@@ -0,0 +1,413 @@
+//-------------------------------------------------------------------------------------------------------
+// Copyright (C) Microsoft. All rights reserved.
+// Licensed under the MIT license. See LICENSE.txt file in the project root for full license information.
+//-------------------------------------------------------------------------------------------------------
+#include "JsrtPch.h"
+#include "JsrtHeapSnapshot.h"
+
+// Writes the snapshot in UTF-8 chunks to the host's callback
+class JsrtHeapSnapshot::Writer
+{
+public:
+    Writer(JsHeapSnapshotWriteCallback writeCallback, void * callbackState) :
+        writeCallback(writeCallback), callbackState(callbackState), length(0)
+    {
+    }
+
+    void Flush()
+    {
+        if (length != 0)
+        {
+            writeCallback(buffer, length, callbackState);
+            length = 0;
+        }
+    }
+
+    void Write(char ch)
+    {
+        if (length == BufferSize)
+        {
+            Flush();
+        }
+        buffer[length++] = ch;
+    }
+
+    void Write(const char * str)
+    {
+        for (; *str != '\0'; str++)
+        {
+            Write(*str);
+        }
+    }
+
+    void WriteNumber(uint64 value)
+    {
+        char digits[20];
+        uint digitCount = 0;
+        do
+        {
+            digits[digitCount++] = (char)('0' + value % 10);
+            value /= 10;
+        } while (value != 0);
+
+        while (digitCount != 0)
+        {
+            Write(digits[--digitCount]);
+        }
+    }
+
+    // Writes a JSON string literal in UTF-8
+    void WriteString(const char16 * str, charcount_t length)
+    {
+        static const char hexDigits[] = "0123456789abcdef";
+
+        Write('"');
+        for (charcount_t i = 0; i < length; i++)
+        {
+            codepoint_t ch = str[i];
+            if (ch == _u('"') || ch == _u('\\'))
+            {
+                Write('\\');
+                Write((char)ch);
+                continue;
+            }
+
+            if (NumberUtilities::IsSurrogateUpperPart(ch) && i + 1 < length && NumberUtilities::IsSurrogateLowerPart(str[i + 1]))
+            {
+                ch = NumberUtilities::SurrogatePairAsCodePoint(ch, str[i + 1]);
+                i++;
+            }
+            else if (ch < 0x20 || NumberUtilities::IsSurrogateUpperPart(ch) || NumberUtilities::IsSurrogateLowerPart(ch))
+            {
+                // Control characters and unpaired surrogates can't be written as is
+                Write("\\u");
+                Write(hexDigits[(ch >> 12) & 0xf]);
+                Write(hexDigits[(ch >> 8) & 0xf]);
+                Write(hexDigits[(ch >> 4) & 0xf]);
+                Write(hexDigits[ch & 0xf]);
+                continue;
+            }
+
+            if (ch < 0x80)
+            {
+                Write((char)ch);
+            }
+            else if (ch < 0x800)
+            {
+                Write((char)(0xc0 | (ch >> 6)));
+                Write((char)(0x80 | (ch & 0x3f)));
+            }
+            else if (ch < 0x10000)
+            {
+                Write((char)(0xe0 | (ch >> 12)));
+                Write((char)(0x80 | ((ch >> 6) & 0x3f)));
+                Write((char)(0x80 | (ch & 0x3f)));
+            }
+            else
+            {
+                Write((char)(0xf0 | (ch >> 18)));
+                Write((char)(0x80 | ((ch >> 12) & 0x3f)));
+                Write((char)(0x80 | ((ch >> 6) & 0x3f)));
+                Write((char)(0x80 | (ch & 0x3f)));
+            }
+        }
+        Write('"');
+    }
+
+private:
+    static const size_t BufferSize = 8 * 1024;
+
+    JsHeapSnapshotWriteCallback writeCallback;
+    void * callbackState;
+    size_t length;
+    char buffer[BufferSize];
+};
+
+template <size_t N>
+static JsUtil::CharacterBuffer<char16> LiteralName(const char16 (&name)[N])
+{
+    return JsUtil::CharacterBuffer<char16>(name, N - 1);
+}
+
+JsrtHeapSnapshot::JsrtHeapSnapshot(ThreadContext * threadContext, bool computeRetainedSizes) :
+    recycler(threadContext->GetRecycler()),
+    snapshot(threadContext->GetRecycler()),
+    libraries(&HeapAllocator::Instance),
+    names(&HeapAllocator::Instance),
+    nameIndices(&HeapAllocator::Instance),
+    hasRetainedSizes(computeRetainedSizes)
+{
+    for (Js::ScriptContext * scriptContext = threadContext->GetScriptContextList(); scriptContext != nullptr; scriptContext = scriptContext->next)
+    {
+        if (!scriptContext->IsClosed())
+        {
+            libraries.Add(scriptContext->GetLibrary());
+        }
+    }
+
+    snapshot.Build(computeRetainedSizes);
+}
+
+Js::RecyclableObject *
+JsrtHeapSnapshot::TryGetJavascriptObject(const RecyclerHeapSnapshot::Node& node) const
+{
+    if (node.size < sizeof(Js::RecyclableObject))
+    {
+        return nullptr;
+    }
+
+    // The type of a JavaScript object is a recycler object of the runtime, which belongs to one of its libraries
+    Js::Type * type = *(Js::Type **)((char *)node.address + Js::RecyclableObject::GetOffsetOfType());
+    RecyclerHeapObjectInfo heapObject;
+    if (!recycler->FindHeapObject(type, FindHeapObjectFlags_NoFlags, heapObject) || heapObject.GetSize() < sizeof(Js::Type))
+    {
+        return nullptr;
+    }
+
+    const Js::TypeId typeId = type->GetTypeId();
+    if ((uint)typeId >= Js::TypeIds_Limit || !libraries.Contains(type->GetLibrary()))
+    {
+        return nullptr;
+    }
+    return (Js::RecyclableObject *)node.address;
+}
+
+JsrtHeapSnapshot::NodeType
+JsrtHeapSnapshot::GetNodeName(uint nodeIndex, Name * name) const
+{
+    if (nodeIndex == RecyclerHeapSnapshot::RootNodeIndex)
+    {
+        *name = LiteralName(_u(""));
+        return NodeType_Synthetic;
+    }
+
+    if (nodeIndex < RecyclerHeapSnapshot::FirstObjectNodeIndex)
+    {
+        switch (nodeIndex - RecyclerHeapSnapshot::FirstRootKindNodeIndex)
+        {
+        case RecyclerHeapSnapshot::RootKind_Pinned:
+            *name = LiteralName(_u("(Pinned objects)"));
+            break;
+        case RecyclerHeapSnapshot::RootKind_GuestArena:
+            *name = LiteralName(_u("(Guest arenas)"));
+            break;
+        default:
+            Assert(nodeIndex - RecyclerHeapSnapshot::FirstRootKindNodeIndex == RecyclerHeapSnapshot::RootKind_Stack);
+            *name = LiteralName(_u("(Stack roots)"));
+            break;
+        }
+        return NodeType_Synthetic;
+    }
+
+    const RecyclerHeapSnapshot::Node& node = snapshot.GetNode(nodeIndex);
+    Js::RecyclableObject * object = TryGetJavascriptObject(node);
+    if (object == nullptr)
+    {
+        *name = node.isLeaf ?
+            LiteralName(_u("(internal data)")) :
+            LiteralName(_u("(internal)"));
+        return NodeType_Hidden;
+    }
+
+    const Js::TypeId typeId = object->GetTypeId();
+    switch (typeId)
+    {
+    case Js::TypeIds_String:
+    {
+        Js::JavascriptString * string = static_cast<Js::JavascriptString *>(object);
+        if (!string->IsFinalized())
+        {
+            // Flattening it would allocate
+            *name = LiteralName(_u("(concatenated string)"));
+            return NodeType_ConcatenatedString;
+        }
+        *name = Name(string->UnsafeGetBuffer(), min(string->GetLength(), MaxStringNameLength));
+        return NodeType_String;
+    }
+
+    case Js::TypeIds_Function:
+    {
+        Js::FunctionProxy * functionProxy = static_cast<Js::JavascriptFunction *>(object)->GetFunctionInfo()->GetFunctionProxy();
+        const char16 * displayName = functionProxy != nullptr ? functionProxy->GetDisplayName() : nullptr;
+        if (displayName == nullptr)
+        {
+            *name = LiteralName(_u("(native function)"));
+        }
+        else
+        {
+            *name = Name(displayName, functionProxy->GetDisplayNameLength());
+        }
+        return NodeType_Closure;
+    }
+
+    case Js::TypeIds_Number:
+        *name = LiteralName(_u("heap number"));
+        return NodeType_Number;
+
+    case Js::TypeIds_Symbol:
+        *name = LiteralName(_u("symbol"));
+        return NodeType_Symbol;
+
+    case Js::TypeIds_RegEx:
+        *name = LiteralName(_u("RegExp"));
+        return NodeType_RegExp;
+    }
+
+    const char16 * typeName = GetTypeName(typeId);
+    *name = Name(typeName, (charcount_t)wcslen(typeName));
+    return typeId >= Js::TypeIds_Object || typeId == Js::TypeIds_Proxy ? NodeType_Object : NodeType_Hidden;
+}
+
+const char16 *
+JsrtHeapSnapshot::GetTypeName(Js::TypeId typeId)
+{
+    switch (typeId)
+    {
+    case Js::TypeIds_Undefined: return _u("undefined");
+    case Js::TypeIds_Null: return _u("null");
+    case Js::TypeIds_Boolean: return _u("boolean");
+    case Js::TypeIds_Int64Number: case Js::TypeIds_UInt64Number: return _u("heap number");
+    case Js::TypeIds_Proxy: return _u("Proxy");
+    case Js::TypeIds_Array: case Js::TypeIds_NativeIntArray: case Js::TypeIds_CopyOnAccessNativeIntArray:
+    case Js::TypeIds_NativeFloatArray: case Js::TypeIds_ES5Array: return _u("Array");
+    case Js::TypeIds_Date: case Js::TypeIds_WinRTDate: return _u("Date");
+    case Js::TypeIds_Error: return _u("Error");
+    case Js::TypeIds_BooleanObject: return _u("Boolean");
+    case Js::TypeIds_NumberObject: return _u("Number");
+    case Js::TypeIds_StringObject: return _u("String");
+    case Js::TypeIds_SymbolObject: return _u("Symbol");
+    case Js::TypeIds_Arguments: return _u("Arguments");
+    case Js::TypeIds_ArrayBuffer: return _u("ArrayBuffer");
+    case Js::TypeIds_SharedArrayBuffer: return _u("SharedArrayBuffer");
+    case Js::TypeIds_Int8Array: return _u("Int8Array");
+    case Js::TypeIds_Uint8Array: return _u("Uint8Array");
+    case Js::TypeIds_Uint8ClampedArray: return _u("Uint8ClampedArray");
+    case Js::TypeIds_Int16Array: return _u("Int16Array");
+    case Js::TypeIds_Uint16Array: return _u("Uint16Array");
+    case Js::TypeIds_Int32Array: return _u("Int32Array");
+    case Js::TypeIds_Uint32Array: return _u("Uint32Array");
+    case Js::TypeIds_Float32Array: return _u("Float32Array");
+    case Js::TypeIds_Float64Array: return _u("Float64Array");
+    case Js::TypeIds_DataView: return _u("DataView");
+    case Js::TypeIds_Map: return _u("Map");
+    case Js::TypeIds_Set: return _u("Set");
+    case Js::TypeIds_WeakMap: return _u("WeakMap");
+    case Js::TypeIds_WeakSet: return _u("WeakSet");
+    case Js::TypeIds_ArrayIterator: return _u("Array Iterator");
+    case Js::TypeIds_MapIterator: return _u("Map Iterator");
+    case Js::TypeIds_SetIterator: return _u("Set Iterator");
+    case Js::TypeIds_StringIterator: return _u("String Iterator");
+    case Js::TypeIds_Generator: return _u("Generator");
+    case Js::TypeIds_Promise: return _u("Promise");
+    case Js::TypeIds_WebAssemblyModule: return _u("WebAssembly.Module");
+    case Js::TypeIds_WebAssemblyInstance: return _u("WebAssembly.Instance");
+    case Js::TypeIds_WebAssemblyMemory: return _u("WebAssembly.Memory");
+    case Js::TypeIds_WebAssemblyTable: return _u("WebAssembly.Table");
+    case Js::TypeIds_GlobalObject: return _u("global");
+    case Js::TypeIds_HostObject: return _u("(host object)");
+    case Js::TypeIds_ActivationObject: return _u("(scope)");
+    case Js::TypeIds_ModuleNamespace: return _u("Module");
+    }
+    return typeId >= Js::TypeIds_Object ? _u("Object") : _u("(internal)");
+}
+
+uint
+JsrtHeapSnapshot::GetNameIndex(const Name& name)
+{
+    uint nameIndex;
+    if (!nameIndices.TryGetValue(name, &nameIndex))
+    {
+        nameIndex = (uint)names.Add(name);
+        nameIndices.Add(name, nameIndex);
+    }
+    return nameIndex;
+}
+
+void
+JsrtHeapSnapshot::Write(JsHeapSnapshotWriteCallback writeCallback, void * callbackState)
+{
+    const uint nodeFieldCount = hasRetainedSizes ? 7 : 6;
+    const uint nodeCount = snapshot.GetNodeCount();
+    const uint edgeCount = snapshot.GetEdgeCount();
+
+    Writer writer(writeCallback, callbackState);
+    writer.Write("{\"snapshot\":{\"meta\":{\"node_fields\":[\"type\",\"name\",\"id\",\"self_size\",\"edge_count\",\"trace_node_id\"");
+    if (hasRetainedSizes)
+    {
+        writer.Write(",\"retained_size\"");
+    }
+    writer.Write("],\"node_types\":[[\"hidden\",\"array\",\"string\",\"object\",\"code\",\"closure\",\"regexp\",\"number\",\"native\","
+        "\"synthetic\",\"concatenated string\",\"sliced string\",\"symbol\"],\"string\",\"number\",\"number\",\"number\",\"number\"");
+    if (hasRetainedSizes)
+    {
+        writer.Write(",\"number\"");
+    }
+    writer.Write("],\"edge_fields\":[\"type\",\"name_or_index\",\"to_node\"],"
+        "\"edge_types\":[[\"context\",\"element\",\"property\",\"internal\",\"hidden\",\"shortcut\",\"weak\"],\"string_or_number\",\"node\"],"
+        "\"trace_function_info_fields\":[\"function_id\",\"name\",\"script_name\",\"script_id\",\"line\",\"column\"],"
+        "\"trace_node_fields\":[\"id\",\"function_info_index\",\"count\",\"size\",\"children\"],"
+        "\"sample_fields\":[\"timestamp_us\",\"last_assigned_id\"],"
+        "\"location_fields\":[\"object_index\",\"script_id\",\"line\",\"column\"]},"
+        "\"node_count\":");
+    writer.WriteNumber(nodeCount);
+    writer.Write(",\"edge_count\":");
+    writer.WriteNumber(edgeCount);
+    writer.Write(",\"trace_function_count\":0},\n\"nodes\":[");
+
+    for (uint nodeIndex = 0; nodeIndex < nodeCount; nodeIndex++)
+    {
+        const RecyclerHeapSnapshot::Node& node = snapshot.GetNode(nodeIndex);
+        Name name;
+        NodeType nodeType = GetNodeName(nodeIndex, &name);
+
+        if (nodeIndex != 0)
+        {
+            writer.Write(",\n");
+        }
+        writer.WriteNumber(nodeType);
+        writer.Write(',');
+        writer.WriteNumber(GetNameIndex(name));
+        writer.Write(',');
+        // Odd ids, like the ids of heap objects in the snapshots of V8
+        writer.WriteNumber((uint64)nodeIndex * 2 + 1);
+        writer.Write(',');
+        writer.WriteNumber(node.size);
+        writer.Write(',');
+        writer.WriteNumber(node.edgeCount);
+        writer.Write(",0");
+        if (hasRetainedSizes)
+        {
+            writer.Write(',');
+            writer.WriteNumber(node.retainedSize);
+        }
+    }
+
+    writer.Write("],\n\"edges\":[");
+    for (uint edgeIndex = 0; edgeIndex < edgeCount; edgeIndex++)
+    {
+        const RecyclerHeapSnapshot::Edge& edge = snapshot.GetEdge(edgeIndex);
+        if (edgeIndex != 0)
+        {
+            writer.Write(",\n");
+        }
+        writer.WriteNumber(EdgeType_Element);
+        writer.Write(',');
+        writer.WriteNumber(edge.index);
+        writer.Write(',');
+        // Edges point to the offset of the node in the nodes array
+        writer.WriteNumber((uint64)edge.toNode * nodeFieldCount);
+    }
+
+    writer.Write("],\n\"trace_function_infos\":[],\"trace_tree\":[],\"samples\":[],\"locations\":[],\n\"strings\":[");
+    for (int i = 0; i < names.Count(); i++)
+    {
+        if (i != 0)
+        {
+            writer.Write(",\n");
+        }
+        const Name& name = names.Item(i);
+        writer.WriteString(name.GetBuffer(), name.GetLength());
+    }
+    writer.Write("]}");
+    writer.Flush();
+}
@@ -0,0 +1,75 @@
+//-------------------------------------------------------------------------------------------------------
+// Copyright (C) Microsoft. All rights reserved.
+// Licensed under the MIT license. See LICENSE.txt file in the project root for full license information.
+//-------------------------------------------------------------------------------------------------------
+#pragma once
+
+#include "Memory/RecyclerHeapSnapshot.h"
+
+// Heap snapshot of a runtime in the JSON .heapsnapshot format of the Chrome DevTools.
+//
+// The graph is the RecyclerHeapSnapshot of the runtime's recycler, which only knows the size of the objects. The
+// JavaScript objects are recognized by their type: a recycler object whose type is one of the runtime's libraries is
+// named after its type id, its function or its string. The other objects are the runtime's own, and are hidden nodes.
+// Nothing that could allocate or run script is called while naming, since the heap is paused for the snapshot.
+//
+// The recycler scans objects conservatively, so the edges are elements indexed by the pointer sized offset of the
+// reference in the object, and a few of them may come from stale data.
+class JsrtHeapSnapshot
+{
+public:
+    JsrtHeapSnapshot(ThreadContext * threadContext, bool computeRetainedSizes);
+
+    void Write(JsHeapSnapshotWriteCallback writeCallback, void * callbackState);
+
+private:
+    // The node_types of the format, in order
+    enum NodeType
+    {
+        NodeType_Hidden,
+        NodeType_Array,
+        NodeType_String,
+        NodeType_Object,
+        NodeType_Code,
+        NodeType_Closure,
+        NodeType_RegExp,
+        NodeType_Number,
+        NodeType_Native,
+        NodeType_Synthetic,
+        NodeType_ConcatenatedString,
+        NodeType_SlicedString,
+        NodeType_Symbol
+    };
+
+    // The edge_types of the format, in order
+    enum EdgeType
+    {
+        EdgeType_Context,
+        EdgeType_Element,
+        EdgeType_Property,
+        EdgeType_Internal,
+        EdgeType_Hidden,
+        EdgeType_Shortcut,
+        EdgeType_Weak
+    };
+
+    // Longest string value kept as the name of a string
+    static const charcount_t MaxStringNameLength = 1024;
+
+    class Writer;
+    typedef JsUtil::CharacterBuffer<char16> Name;
+    typedef JsUtil::BaseDictionary<Name, uint, HeapAllocator> NameIndexMap;
+
+    Js::RecyclableObject * TryGetJavascriptObject(const RecyclerHeapSnapshot::Node& node) const;
+    NodeType GetNodeName(uint nodeIndex, Name * name) const;
+    uint GetNameIndex(const Name& name);
+
+    static const char16 * GetTypeName(Js::TypeId typeId);
+
+    Recycler * recycler;
+    RecyclerHeapSnapshot snapshot;
+    JsUtil::List<Js::JavascriptLibrary *, HeapAllocator> libraries;
+    JsUtil::List<Name, HeapAllocator> names;
+    NameIndexMap nameIndices;
+    bool hasRetainedSizes;
+};
@@ -15,6 +15,8 @@ JsrtRuntime::JsrtRuntime(ThreadContext * threadContext, bool useIdle, bool dispa
     this->collectCallback = NULL;
     this->beforeCollectCallback = NULL;
     this->callbackContext = NULL;
+    this->collectionEndCallback = NULL;
+    this->collectionEndCallbackState = NULL;
     this->allocationPolicyManager = threadContext->GetAllocationPolicyManager();
     this->useIdle = useIdle;
     this->dispatchExceptions = dispatchExceptions;
@@ -76,32 +78,72 @@ void JsrtRuntime::SetBeforeCollectCallback(JsBeforeCollectCallback beforeCollect
 {
     if (beforeCollectCallback != NULL)
     {
-        if (this->collectCallback == NULL)
-        {
-            this->collectCallback = this->threadContext->AddRecyclerCollectCallBack(RecyclerCollectCallbackStatic, this);
-        }
-
         this->beforeCollectCallback = beforeCollectCallback;
         this->callbackContext = callbackContext;
     }
     else
     {
-        if (this->collectCallback != NULL)
-        {
-            this->threadContext->RemoveRecyclerCollectCallBack(this->collectCallback);
-            this->collectCallback = NULL;
-        }
-
         this->beforeCollectCallback = NULL;
         this->callbackContext = NULL;
     }
+
+    UpdateRecyclerCollectCallback();
+}
+
+void JsrtRuntime::SetCollectionEndCallback(JsCollectionEndCallback collectionEndCallback, void * callbackState)
+{
+    if (collectionEndCallback != NULL)
+    {
+        this->collectionEndCallback = collectionEndCallback;
+        this->collectionEndCallbackState = callbackState;
+    }
+    else
+    {
+        this->collectionEndCallback = NULL;
+        this->collectionEndCallbackState = NULL;
+    }
+
+    UpdateRecyclerCollectCallback();
+}
+
+void JsrtRuntime::UpdateRecyclerCollectCallback()
+{
+    // Both callbacks share a single registration with the thread context
+    if (this->beforeCollectCallback != NULL || this->collectionEndCallback != NULL)
+    {
+        if (this->collectCallback == NULL)
+        {
+            this->collectCallback = this->threadContext->AddRecyclerCollectCallBack(RecyclerCollectCallbackStatic, this);
+        }
+    }
+    else if (this->collectCallback != NULL)
+    {
+        this->threadContext->RemoveRecyclerCollectCallBack(this->collectCallback);
+        this->collectCallback = NULL;
+    }
+}
+
+void JsrtRuntime::GetCollectionStatistics(Recycler * recycler, JsCollectionStatistics * statistics)
+{
+    const RecyclerCollectionStatistics& collectionStatistics = recycler->GetCollectionStatistics();
+    statistics->collectionCount = collectionStatistics.collectionCount;
+    statistics->isPartial = collectionStatistics.isPartial;
+    statistics->isConcurrent = collectionStatistics.isConcurrent;
+    statistics->markPauseMicroseconds = collectionStatistics.markPauseMicroseconds;
+    statistics->sweepPauseMicroseconds = collectionStatistics.sweepPauseMicroseconds;
+    statistics->pauseMicroseconds = collectionStatistics.pauseMicroseconds;
+    statistics->totalPauseMicroseconds = collectionStatistics.totalPauseMicroseconds;
+    statistics->maxPauseMicroseconds = collectionStatistics.maxPauseMicroseconds;
+    statistics->allocatedBytes = collectionStatistics.allocatedBytes;
+    statistics->usedBytesBefore = collectionStatistics.usedBytesBefore;
+    statistics->usedBytesAfter = collectionStatistics.usedBytesAfter;
 }
 
 void JsrtRuntime::RecyclerCollectCallbackStatic(void * context, RecyclerCollectCallBackFlags flags)
 {
-    if (flags & Collect_Begin)
+    JsrtRuntime * _this = reinterpret_cast<JsrtRuntime *>(context);
+    if ((flags & Collect_Begin) && _this->beforeCollectCallback != NULL)
     {
-        JsrtRuntime * _this = reinterpret_cast<JsrtRuntime *>(context);
         try
         {
             JsrtCallbackState scope(reinterpret_cast<ThreadContext*>(_this->GetThreadContext()));
@@ -112,6 +154,22 @@ void JsrtRuntime::RecyclerCollectCallbackStatic(void * context, RecyclerCollectC
             AssertMsg(false, "Unexpected non-engine exception.");
         }
     }
+
+    if ((flags & Collect_End) && _this->collectionEndCallback != NULL)
+    {
+        try
+        {
+            JsCollectionStatistics statistics;
+            GetCollectionStatistics(_this->GetThreadContext()->GetRecycler(), &statistics);
+
+            JsrtCallbackState scope(reinterpret_cast<ThreadContext*>(_this->GetThreadContext()));
+            _this->collectionEndCallback(&statistics, _this->collectionEndCallbackState);
+        }
+        catch (...)
+        {
+            AssertMsg(false, "Unexpected non-engine exception.");
+        }
+    }
 }
 
 unsigned int JsrtRuntime::Idle()
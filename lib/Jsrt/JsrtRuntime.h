@@ -7,6 +7,7 @@
 #include "ChakraCore.h"
 #include "JsrtThreadService.h"
 #include "JsrtDebugManager.h"
+#include "JsrtByteCodeCache.h"
 
 class JsrtContext;
 
@@ -36,6 +37,7 @@ public:
 
     void CloseContexts();
     void SetBeforeCollectCallback(JsBeforeCollectCallback beforeCollectCallback, void * callbackContext);
+    void SetCollectionEndCallback(JsCollectionEndCallback collectionEndCallback, void * callbackState);
 
 #ifdef ENABLE_DEBUG_CONFIG_OPTIONS
     void SetSerializeByteCodeForLibrary(bool set) { serializeByteCodeForLibrary = set; }
@@ -46,7 +48,12 @@ public:
     void DeleteJsrtDebugManager();
     JsrtDebugManager * GetJsrtDebugManager();
 
+    static void GetCollectionStatistics(Recycler * recycler, JsCollectionStatistics * statistics);
+
+    JsrtByteCodeCache * GetByteCodeCache() { return &byteCodeCache; }
+
 private:
+    void UpdateRecyclerCollectCallback();
     static void __cdecl RecyclerCollectCallbackStatic(void * context, RecyclerCollectCallBackFlags flags);
 
 private:
@@ -57,10 +64,13 @@ private:
     JsBeforeCollectCallback beforeCollectCallback;
     JsrtThreadService threadService;
     void * callbackContext;
+    JsCollectionEndCallback collectionEndCallback;
+    void * collectionEndCallbackState;
     bool useIdle;
     bool dispatchExceptions;
 #ifdef ENABLE_DEBUG_CONFIG_OPTIONS
     bool serializeByteCodeForLibrary;
 #endif
     JsrtDebugManager * jsrtDebugManager;
+    JsrtByteCodeCache byteCodeCache;
 };
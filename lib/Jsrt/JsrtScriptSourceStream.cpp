@@ -0,0 +1,203 @@
+//-------------------------------------------------------------------------------------------------------
+// Copyright (C) Microsoft. All rights reserved.
+// Licensed under the MIT license. See LICENSE.txt file in the project root for full license information.
+//-------------------------------------------------------------------------------------------------------
+#include "JsrtPch.h"
+#include "JsrtScriptSourceStream.h"
+
+JsrtScriptSourceStream::JsrtScriptSourceStream(byte * buffer, size_t capacity, size_t expectedLength) :
+    chunkArrived(true),
+    buffer(buffer),
+    length(0),
+    capacity(capacity),
+    expectedLength(expectedLength),
+    retiredBuffers(nullptr),
+    refCount(1),
+    isComplete(false),
+    isParsing(false),
+    isParsed(false)
+{
+}
+
+JsrtScriptSourceStream::~JsrtScriptSourceStream()
+{
+    FreeRetiredBuffers();
+    HeapDeleteArray(capacity, buffer);
+}
+
+JsrtScriptSourceStream * JsrtScriptSourceStream::New(size_t expectedLength)
+{
+    // Always have a buffer, even for an empty script
+    size_t capacity = max(expectedLength, (size_t)1);
+    byte * buffer = HeapNewArray(byte, capacity);
+
+    JsrtScriptSourceStream * stream = nullptr;
+    try
+    {
+        stream = HeapNew(JsrtScriptSourceStream, buffer, capacity, expectedLength);
+    }
+    catch (...)
+    {
+        HeapDeleteArray(capacity, buffer);
+        throw;
+    }
+    return stream;
+}
+
+bool JsrtScriptSourceStream::EnsureCapacity(size_t requiredCapacity)
+{
+    if (requiredCapacity <= capacity)
+    {
+        return true;
+    }
+
+    // The source ends up as the source of a script
+    if (requiredCapacity > UINT32_MAX)
+    {
+        return false;
+    }
+
+    size_t newCapacity = min(max(capacity * 2, requiredCapacity), (size_t)UINT32_MAX);
+    byte * newBuffer = HeapNewNoThrowArray(byte, newCapacity);
+    if (newBuffer == nullptr)
+    {
+        return false;
+    }
+
+    RetiredBuffer * retiredBuffer = nullptr;
+    if (isParsing)
+    {
+        // The scanner may still be reading the old buffer, which is freed once the parse is over
+        retiredBuffer = HeapNewNoThrowStruct(RetiredBuffer);
+        if (retiredBuffer == nullptr)
+        {
+            HeapDeleteArray(newCapacity, newBuffer);
+            return false;
+        }
+    }
+
+    js_memcpy_s(newBuffer, newCapacity, buffer, length);
+    if (retiredBuffer != nullptr)
+    {
+        retiredBuffer->next = retiredBuffers;
+        retiredBuffer->buffer = buffer;
+        retiredBuffer->capacity = capacity;
+        retiredBuffers = retiredBuffer;
+    }
+    else
+    {
+        HeapDeleteArray(capacity, buffer);
+    }
+    buffer = newBuffer;
+    capacity = newCapacity;
+    return true;
+}
+
+void JsrtScriptSourceStream::FreeRetiredBuffers()
+{
+    while (retiredBuffers != nullptr)
+    {
+        RetiredBuffer * retiredBuffer = retiredBuffers;
+        retiredBuffers = retiredBuffer->next;
+        HeapDeleteArray(retiredBuffer->capacity, retiredBuffer->buffer);
+        HeapDelete(retiredBuffer);
+    }
+}
+
+JsErrorCode JsrtScriptSourceStream::Append(_In_reads_(chunkLength) const byte * chunk, size_t chunkLength, bool isLastChunk)
+{
+    {
+        AutoCriticalSection autoCs(&cs);
+
+        if (isComplete)
+        {
+            return JsErrorInvalidArgument;
+        }
+
+        if (chunkLength != 0)
+        {
+            if (!EnsureCapacity(length + chunkLength))
+            {
+                return JsErrorOutOfMemory;
+            }
+
+            // Past the length the scanner was given, so it doesn't read these bytes as they are written
+            js_memcpy_s(buffer + length, capacity - length, chunk, chunkLength);
+            length += chunkLength;
+        }
+
+        if (isLastChunk)
+        {
+            isComplete = true;
+        }
+    }
+
+    chunkArrived.Set();
+    return JsNoError;
+}
+
+LPCUTF8 JsrtScriptSourceStream::WaitForSource(size_t minLength, _Out_ size_t *availableLength, _Out_ bool *isLastChunkIn)
+{
+    for (;;)
+    {
+        {
+            AutoCriticalSection autoCs(&cs);
+
+            Assert(isParsing);
+            if (isComplete || length >= minLength)
+            {
+                *availableLength = length;
+                *isLastChunkIn = isComplete;
+                return buffer;
+            }
+        }
+
+        chunkArrived.Wait();
+    }
+}
+
+size_t JsrtScriptSourceStream::GetExpectedLength()
+{
+    AutoCriticalSection autoCs(&cs);
+    return max(expectedLength, length);
+}
+
+bool JsrtScriptSourceStream::BeginParse()
+{
+    AutoCriticalSection autoCs(&cs);
+
+    if (isParsed)
+    {
+        return false;
+    }
+    isParsed = true;
+    isParsing = true;
+    return true;
+}
+
+void JsrtScriptSourceStream::EndParse()
+{
+    AutoCriticalSection autoCs(&cs);
+
+    Assert(isParsing);
+    isParsing = false;
+    FreeRetiredBuffers();
+}
+
+void JsrtScriptSourceStream::AddRef()
+{
+    InterlockedIncrement(&refCount);
+}
+
+void JsrtScriptSourceStream::Release()
+{
+    if (InterlockedDecrement(&refCount) == 0)
+    {
+        HeapDelete(this);
+    }
+}
+
+void CHAKRA_CALLBACK JsrtScriptSourceStream::ReleaseSourceBuffer(void * state)
+{
+    static_cast<JsrtScriptSourceStream *>(state)->Release();
+}
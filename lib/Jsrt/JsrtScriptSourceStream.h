@@ -0,0 +1,59 @@
+//-------------------------------------------------------------------------------------------------------
+// Copyright (C) Microsoft. All rights reserved.
+// Licensed under the MIT license. See LICENSE.txt file in the project root for full license information.
+//-------------------------------------------------------------------------------------------------------
+#pragma once
+
+// Utf8 script source handed over by the host in chunks, from any thread, as it is read.
+// The chunks are accumulated into a single buffer, which the parser scans as they arrive
+// and which then becomes the source of the script, so the source is not copied again.
+//
+// Once the parse has started, the buffer the scanner is reading is never freed or written
+// over; when it has to grow, the old buffer is kept until the parse is over.
+//
+// The stream is referenced by the host until JsDisposeScriptSourceStream and by the
+// ArrayBuffer that keeps the source of the parsed script alive until it is finalized.
+class JsrtScriptSourceStream sealed : public ISourceStream
+{
+public:
+    JsrtScriptSourceStream(byte * buffer, size_t capacity, size_t expectedLength);
+    ~JsrtScriptSourceStream();
+
+    static JsrtScriptSourceStream * New(size_t expectedLength);
+
+    JsErrorCode Append(_In_reads_(chunkLength) const byte * chunk, size_t chunkLength, bool isLastChunk);
+    bool BeginParse();
+    void EndParse();
+
+    // ISourceStream
+    virtual LPCUTF8 WaitForSource(size_t minLength, _Out_ size_t *availableLength, _Out_ bool *isLastChunkIn) override;
+    virtual size_t GetExpectedLength() override;
+
+    void AddRef();
+    void Release();
+
+    static void CHAKRA_CALLBACK ReleaseSourceBuffer(void * state);
+
+private:
+    struct RetiredBuffer
+    {
+        RetiredBuffer * next;
+        byte * buffer;
+        size_t capacity;
+    };
+
+    bool EnsureCapacity(size_t requiredCapacity);
+    void FreeRetiredBuffers();
+
+    CriticalSection cs;
+    Event chunkArrived;
+    byte * buffer;
+    size_t length;
+    size_t capacity;
+    size_t expectedLength;
+    RetiredBuffer * retiredBuffers;
+    volatile LONG refCount;
+    bool isComplete;
+    bool isParsing;
+    bool isParsed;
+};
@@ -39,6 +39,21 @@ ULONG CaseSensitiveComputeHashCch(char const * prgch, int32 cch)
 {
     ULONG luHash = 0;
 
+    // Same hash as the loop below, four characters at a time. The contribution of the
+    // four characters does not depend on the running hash, which shortens the
+    // multiply chain for long identifiers.
+    while (cch >= 4)
+    {
+        Assert(utf8::IsStartByte(prgch[0]) && !utf8::IsLeadByte(prgch[0]));
+        Assert(utf8::IsStartByte(prgch[1]) && !utf8::IsLeadByte(prgch[1]));
+        Assert(utf8::IsStartByte(prgch[2]) && !utf8::IsLeadByte(prgch[2]));
+        Assert(utf8::IsStartByte(prgch[3]) && !utf8::IsLeadByte(prgch[3]));
+        luHash = (17 * 17 * 17 * 17) * luHash
+            + ((17 * 17 * 17) * (ULONG)prgch[0] + (17 * 17) * (ULONG)prgch[1] + 17 * (ULONG)prgch[2] + (ULONG)prgch[3]);
+        prgch += 4;
+        cch -= 4;
+    }
+
     while (cch-- > 0)
     {
         Assert(utf8::IsStartByte(*prgch) && !utf8::IsLeadByte(*prgch));
@@ -5,6 +5,7 @@
 #include "ParserPch.h"
 #include "FormalsUtil.h"
 #include "../Runtime/Language/SourceDynamicProfileManager.h"
+#include "ByteCodeCacheReleaseFileVersion.h"
 
 #if DBG_DUMP
 void PrintPnodeWIndent(ParseNode *pnode,int indentAmt);
@@ -36,6 +37,9 @@ struct DeferredFunctionStub
     uint nestedCount;
     DeferredFunctionStub *deferredStubs;
     charcount_t ichMin;
+
+    // Stubs of functions that were fully parsed when the stubs were recorded have no restore point.
+    bool HasRestorePoint() const { return restorePoint.m_ichMinTok != (charcount_t)-1; }
 };
 
 struct StmtNest
@@ -83,7 +87,9 @@ Parser::Parser(Js::ScriptContext* scriptContext, BOOL strictMode, PageAllocator
     m_deferringAST = FALSE;
     m_stoppedDeferredParse = FALSE;
     m_hasParallelJob = false;
+    m_parallelParseTopLevelFuncs = false;
     m_doingFastScan = false;
+    m_sourceStream = nullptr;
     m_scriptContext = scriptContext;
     m_pCurrentAstSize = nullptr;
     m_arrayDepth = 0;
@@ -289,6 +295,7 @@ HRESULT Parser::ValidateSyntax(LPCUTF8 pszSrc, size_t encodedCharCount, bool isG
         pnodeFnc->sxFnc.pnodeName    = nullptr;
         pnodeFnc->sxFnc.pnodeRest    = nullptr;
         pnodeFnc->sxFnc.deferredStub = nullptr;
+        pnodeFnc->sxFnc.pRestorePoint = nullptr;
         pnodeFnc->sxFnc.SetIsGenerator(isGenerator);
         pnodeFnc->sxFnc.SetIsAsync(isAsync);
         m_ppnodeVar = &pnodeFnc->sxFnc.pnodeVars;
@@ -4557,6 +4564,7 @@ ParseNodePtr Parser::ParseFncDecl(ushort flags, LPCOLESTR pNameHint, const bool
     pnodeFnc->sxFnc.pnodeVars           = nullptr;
     pnodeFnc->sxFnc.funcInfo            = nullptr;
     pnodeFnc->sxFnc.deferredStub        = nullptr;
+    pnodeFnc->sxFnc.pRestorePoint       = nullptr;
     pnodeFnc->sxFnc.nestedCount         = 0;
     pnodeFnc->sxFnc.cbMin = m_pscan->IecpMinTok();
     pnodeFnc->sxFnc.functionId = (*m_nextFunctionId)++;
@@ -4938,7 +4946,7 @@ bool Parser::ParseFncDeclHelper(ParseNodePtr pnodeFnc, LPCOLESTR pNameHint, usho
             !isLikelyIIFE &&
             !this->IsBackgroundParser() &&
             !this->m_doingFastScan &&
-            !(pnodeFncSave && m_currDeferredStub) &&
+            !(GetDeferredStubParent(pnodeFncSave) && m_currDeferredStub) &&
             !(this->m_parseType == ParseType_Deferred && this->m_functionBody && this->m_functionBody->GetScopeInfo() && !isTopLevelDeferredFunc))
         {
             doParallel = DoParallelParse(pnodeFnc);
@@ -4951,7 +4959,7 @@ bool Parser::ParseFncDeclHelper(ParseNodePtr pnodeFnc, LPCOLESTR pNameHint, usho
                 {
                     Error(ERRsyntax);
                 }
-                doParallel = bgp->ParseBackgroundItem(this, pnodeFnc, isTopLevelDeferredFunc);
+                doParallel = bgp->ParseBackgroundItem(this, pnodeFnc, isTopLevelDeferredFunc && !m_parallelParseTopLevelFuncs);
                 if (doParallel)
                 {
                     parallelJobStarted = true;
@@ -5206,12 +5214,13 @@ bool Parser::ParseFncDeclHelper(ParseNodePtr pnodeFnc, LPCOLESTR pNameHint, usho
             if (buildAST)
             {
                 DeferredFunctionStub *saveCurrentStub = m_currDeferredStub;
+                ParseNodePtr pnodeStubParent = GetDeferredStubParent(pnodeFncSave);
                 if (isEnclosedInParamScope)
                 {
                     // if the enclosed scope is the param scope we would not have created the deferred stub.
                     m_currDeferredStub = nullptr;
                 }
-                else if (pnodeFncSave && m_currDeferredStub)
+                else if (pnodeStubParent && m_currDeferredStub)
                 {
                     // the Deferred stub will not match for the function which are defined on lambda formals.
                     // Since this is not determined upfront that the current function is a part of outer function or part of lambda formal until we have seen the Arrow token.
@@ -5219,14 +5228,14 @@ bool Parser::ParseFncDeclHelper(ParseNodePtr pnodeFnc, LPCOLESTR pNameHint, usho
                     // the function start with the stub. Because they should match. We need to have previous sibling concept as the lambda formals can have more than one
                     // functions and we want to avoid getting wrong stub.
 
-                    if (pnodeFncSave->sxFnc.nestedCount == 1)
+                    if (pnodeStubParent->sxFnc.nestedCount == 1)
                     {
                         m_prevSiblingDeferredStub = nullptr;
                     }
 
                     if (m_prevSiblingDeferredStub == nullptr)
                     {
-                        m_prevSiblingDeferredStub = (m_currDeferredStub + (pnodeFncSave->sxFnc.nestedCount - 1));
+                        m_prevSiblingDeferredStub = (m_currDeferredStub + (pnodeStubParent->sxFnc.nestedCount - 1));
                     }
 
                     if (m_prevSiblingDeferredStub->ichMin == pnodeFnc->ichMin)
@@ -5454,16 +5463,29 @@ void Parser::ParseTopLevelDeferredFunc(ParseNodePtr pnodeFnc, ParseNodePtr pnode
 
     m_ppnodeVar = &pnodeFnc->sxFnc.pnodeVars;
 
-    if (pnodeFncParent != nullptr
-        && m_currDeferredStub != nullptr
-        // We don't create stubs for function bodies in parameter scope.
-        && pnodeFnc->sxFnc.pnodeScopes->sxBlock.blockType != PnodeBlockType::Parameter)
+    size_t lengthBeforeBody = this->GetSourceLength();
+
+    // Bodies are only skipped on the initial parse of a script run with a serialized parser state, which is the only
+    // way an upfront parse has stubs. A deferred reparse parses the bodies of its nested deferred functions.
+    DeferredFunctionStub *stub = nullptr;
+    ParseNodePtr pnodeStubParent = GetDeferredStubParent(pnodeFncParent);
+    if (m_parseType == ParseType_Upfront && pnodeStubParent != nullptr && m_currDeferredStub != nullptr)
+    {
+        stub = m_currDeferredStub + (pnodeStubParent->sxFnc.nestedCount - 1);
+
+        // We don't create stubs for function bodies in parameter scope, and functions that weren't deferred
+        // when the stubs were recorded have nothing to skip to. Such functions are parsed as usual.
+        if (stub->ichMin != pnodeFnc->ichMin || !stub->HasRestorePoint())
+        {
+            stub = nullptr;
+        }
+    }
+
+    if (stub != nullptr)
     {
         // We've already parsed this function body for syntax errors on the initial parse of the script.
         // We have information that allows us to skip it, so do so.
 
-        DeferredFunctionStub *stub = m_currDeferredStub + (pnodeFncParent->sxFnc.nestedCount - 1);
-        Assert(pnodeFnc->ichMin == stub->ichMin);
         if (stub->fncFlags & kFunctionCallsEval)
         {
             this->MarkEvalCaller();
@@ -5493,6 +5515,17 @@ void Parser::ParseTopLevelDeferredFunc(ParseNodePtr pnodeFnc, ParseNodePtr pnode
     else
     {
         ParseStmtList<false>(nullptr, nullptr, SM_DeferredParse, true /* isSourceElementList */);
+
+        if (m_grfscr & fscrCreateParserState)
+        {
+            // Record the end of the function so that a later parse of the same script with the serialized
+            // parser state can skip over the body, the same way nested deferred functions are skipped.
+            RestorePoint *restorePoint = Anew(&m_nodeAllocator, RestorePoint);
+            m_pscan->Capture(restorePoint,
+                             *m_nextFunctionId - pnodeFnc->sxFnc.functionId - 1,
+                             lengthBeforeBody - this->GetSourceLength());
+            pnodeFnc->sxFnc.pRestorePoint = restorePoint;
+        }
     }
 
     pnodeFnc->ichLim = m_pscan->IchLimTok();
@@ -5515,7 +5548,14 @@ void Parser::ParseTopLevelDeferredFunc(ParseNodePtr pnodeFnc, ParseNodePtr pnode
 bool Parser::DoParallelParse(ParseNodePtr pnodeFnc) const
 {
 #if ENABLE_BACKGROUND_PARSING
-    if (!PHASE_ON_RAW(Js::ParallelParsePhase, m_sourceContextInfo->sourceContextId, pnodeFnc->sxFnc.functionId))
+    // Background parses work on the source in place, which for a streamed source may still move
+    if (m_sourceStream != nullptr)
+    {
+        return false;
+    }
+
+    if (!PHASE_ON_RAW(Js::ParallelParsePhase, m_sourceContextInfo->sourceContextId, pnodeFnc->sxFnc.functionId) &&
+        !(m_parallelParseTopLevelFuncs && !pnodeFnc->sxFnc.IsNested()))
     {
         return false;
     }
@@ -5527,6 +5567,17 @@ bool Parser::DoParallelParse(ParseNodePtr pnodeFnc) const
 #endif
 }
 
+ParseNodePtr Parser::GetDeferredStubParent(ParseNodePtr pnodeFncParent) const
+{
+    // When a script is parsed with a serialized parser state, the stubs of the functions at global scope
+    // hang off the program itself.
+    if (pnodeFncParent == nullptr && m_parseType == ParseType_Upfront)
+    {
+        return m_currentNodeProg;
+    }
+    return pnodeFncParent;
+}
+
 bool Parser::ScanAheadToFunctionEnd(uint count)
 {
     bool found = false;
@@ -5840,6 +5891,7 @@ ParseNodePtr Parser::CreateDummyFuncNode(bool fDeclaration)
     pnodeFnc->sxFnc.pnodeVars           = nullptr;
     pnodeFnc->sxFnc.funcInfo            = nullptr;
     pnodeFnc->sxFnc.deferredStub        = nullptr;
+    pnodeFnc->sxFnc.pRestorePoint       = nullptr;
     pnodeFnc->sxFnc.nestedCount         = 0;
     pnodeFnc->sxFnc.SetNested(m_currentNodeFunc != nullptr); // If there is a current function, then we're a nested function.
     pnodeFnc->sxFnc.SetStrictMode(IsStrictMode()); // Inherit current strict mode -- may be overridden by the function itself if it contains a strict mode directive.
@@ -6432,6 +6484,7 @@ ParseNodePtr Parser::GenerateEmptyConstructor(bool extends)
     pnodeFnc->sxFnc.pnodeNext           = nullptr;
     pnodeFnc->sxFnc.pnodeRest           = nullptr;
     pnodeFnc->sxFnc.deferredStub        = nullptr;
+    pnodeFnc->sxFnc.pRestorePoint       = nullptr;
     pnodeFnc->sxFnc.funcInfo            = nullptr;
 
     // In order to (re-)defer the default constructor, we need to, for instance, track
@@ -10814,6 +10867,21 @@ ParseNodePtr Parser::Parse(LPCUTF8 pszSrc, size_t offset, size_t length, charcou
     m_originalLength = length;
     m_nextFunctionId = nextFunctionId;
 
+    if (m_sourceStream != nullptr && m_sourceStream->GetExpectedLength() > length)
+    {
+        // Only the start of a streamed source is in; go by the length the host expects it to have.
+        m_length = m_sourceStream->GetExpectedLength();
+    }
+
+    // Large scripts are split at their top-level functions, which are then parsed eagerly on the
+    // background threads while this thread fast-scans past them.
+    m_parallelParseTopLevelFuncs =
+        m_parseType == ParseType_Upfront &&
+        m_sourceStream == nullptr &&
+        !(grfscr & (fscrEvalCode | fscrCreateParserState)) &&
+        CONFIG_FLAG(ParallelParseThreshold) != 0 &&
+        length >= (size_t)CONFIG_FLAG(ParallelParseThreshold);
+
     if(m_parseType != ParseType_Deferred)
     {
         JS_ETW(EventWriteJSCRIPT_PARSE_METHOD_START(m_sourceContextInfo->dwHostSourceContext, GetScriptContext(), *m_nextFunctionId, 0, m_parseType, Js::Constants::GlobalFunction));
@@ -10821,6 +10889,7 @@ ParseNodePtr Parser::Parse(LPCUTF8 pszSrc, size_t offset, size_t length, charcou
     }
 
     // Give the scanner the source and get the first token
+    m_pscan->SetSourceStream(m_sourceStream);
     m_pscan->SetText(pszSrc, offset, length, charOffset, grfscr, lineNumber);
     m_pscan->Scan();
 
@@ -11129,6 +11198,23 @@ HRESULT Parser::ParseUtf8Source(__out ParseNodePtr* parseTree, LPCUTF8 pSrc, siz
     return ParseSourceInternal( parseTree, pSrc, 0, length, 0, true, grfsrc, pse, nextFunctionId, 0, sourceContextInfo);
 }
 
+HRESULT Parser::ParseUtf8Source(__out ParseNodePtr* parseTree, ISourceStream* sourceStream, ULONG grfsrc, CompileScriptException *pse,
+    Js::LocalFunctionId * nextFunctionId, SourceContextInfo * sourceContextInfo)
+{
+    m_functionBody = nullptr;
+    m_parseType = ParseType_Upfront;
+
+    // Wait for enough of the source to recognize a byte order mark
+    size_t length;
+    bool isComplete;
+    LPCUTF8 pSrc = sourceStream->WaitForSource(3, &length, &isComplete);
+
+    m_sourceStream = isComplete ? nullptr : sourceStream;
+    HRESULT hr = ParseSourceInternal(parseTree, pSrc, 0, length, 0, true, grfsrc, pse, nextFunctionId, 0, sourceContextInfo);
+    m_sourceStream = nullptr;
+    return hr;
+}
+
 HRESULT Parser::ParseCesu8Source(__out ParseNodePtr* parseTree, LPCUTF8 pSrc, size_t length, ULONG grfsrc, CompileScriptException *pse,
     Js::LocalFunctionId * nextFunctionId, SourceContextInfo * sourceContextInfo)
 {
@@ -13400,3 +13486,339 @@ DeferredFunctionStub * BuildDeferredStubTree(ParseNode *pnodeFnc, Recycler *recy
 
     return deferredStubs;
 }
+
+// Serialized parser state: a header followed by the stubs of the program's nested functions in pre-order.
+static const int parserStateMagicConstant = *(int*)"ChPs";
+static const uint32 parserStateVersionConstant = 1;
+
+// Parse flags that change the function extents and have to match between recording and using a parser state
+static const ULONG parserStateParseFlags = fscrIsModuleCode | fscrEvalCode;
+
+struct SerializedParserStateHeader
+{
+    int magic;
+    uint32 version;
+    GUID engineVersion;
+    uint32 parseFlags;
+    uint32 sourceLength;
+    uint32 sourceHash;
+    uint32 nestedCount;
+    uint32 childCount;
+    uint32 stubCount;
+    uint32 stubsHash;
+};
+
+struct SerializedDeferredFunctionStub
+{
+    uint32 ichMin;
+    uint32 fncFlags;
+    uint32 nestedCount;
+    uint32 childCount;          // number of the stubs that follow which are nested in this function
+    uint32 ichMinTok;           // (uint32)-1 if the function has no restore point
+    uint32 ichMinLine;
+    uint32 cMinTokMultiUnits;
+    uint32 cMinLineMultiUnits;
+    uint32 line;
+    uint32 functionIdIncrement;
+    uint32 lengthDecr;
+    uint32 hadEol;
+};
+
+static uint32 ComputeParserStateHash(const byte *buffer, size_t length)
+{
+    // FNV-1a
+    uint32 hash = 2166136261;
+    for (size_t i = 0; i < length; i++)
+    {
+        hash = (hash ^ buffer[i]) * 16777619;
+    }
+    return hash;
+}
+
+// Visits the functions nested in a scope list in the order of their index in the nested function array,
+// the same way VisitNestedScopes does during byte code generation.
+template <typename Fn>
+static void MapNestedFunctions(ParseNode *pnodeScope, Fn fn)
+{
+    while (pnodeScope != nullptr)
+    {
+        switch (pnodeScope->nop)
+        {
+        case knopFncDecl:
+            fn(pnodeScope);
+            pnodeScope = pnodeScope->sxFnc.pnodeNext;
+            break;
+
+        case knopBlock:
+            MapNestedFunctions(pnodeScope->sxBlock.pnodeScopes, fn);
+            pnodeScope = pnodeScope->sxBlock.pnodeNext;
+            break;
+
+        case knopCatch:
+            MapNestedFunctions(pnodeScope->sxCatch.pnodeScopes, fn);
+            pnodeScope = pnodeScope->sxCatch.pnodeNext;
+            break;
+
+        case knopWith:
+            MapNestedFunctions(pnodeScope->sxWith.pnodeScopes, fn);
+            pnodeScope = pnodeScope->sxWith.pnodeNext;
+            break;
+
+        default:
+            AssertMsg(false, "Unexpected node in scope list");
+            return;
+        }
+    }
+}
+
+static uint32 CountSerializedStubs(ParseNode *pnodeFnc)
+{
+    uint32 count = 0;
+    MapNestedFunctions(pnodeFnc->sxFnc.pnodeScopes, [&](ParseNode *pnodeChild)
+    {
+        count += 1 + CountSerializedStubs(pnodeChild);
+    });
+    return count;
+}
+
+static void WriteSerializedStubs(ParseNode *pnodeFnc, byte **ppBuffer)
+{
+    MapNestedFunctions(pnodeFnc->sxFnc.pnodeScopes, [&](ParseNode *pnodeChild)
+    {
+        SerializedDeferredFunctionStub stub;
+        stub.ichMin = pnodeChild->ichMin;
+        stub.fncFlags = pnodeChild->sxFnc.fncFlags;
+        stub.nestedCount = pnodeChild->sxFnc.nestedCount;
+        stub.childCount = 0;
+        MapNestedFunctions(pnodeChild->sxFnc.pnodeScopes, [&](ParseNode *) { stub.childCount++; });
+
+        // Functions that were fully parsed have no restore point, but their nested functions may have one.
+        RestorePoint *restorePoint = pnodeChild->sxFnc.IsGeneratedDefault() ? nullptr : pnodeChild->sxFnc.pRestorePoint;
+        if (restorePoint != nullptr)
+        {
+            stub.ichMinTok = restorePoint->m_ichMinTok;
+            stub.ichMinLine = restorePoint->m_ichMinLine;
+            stub.cMinTokMultiUnits = static_cast<uint32>(restorePoint->m_cMinTokMultiUnits);
+            stub.cMinLineMultiUnits = static_cast<uint32>(restorePoint->m_cMinLineMultiUnits);
+            stub.line = restorePoint->m_line;
+            stub.functionIdIncrement = restorePoint->functionIdIncrement;
+            stub.lengthDecr = static_cast<uint32>(restorePoint->lengthDecr);
+            stub.hadEol = restorePoint->m_fHadEol ? 1 : 0;
+        }
+        else
+        {
+            stub.ichMinTok = (uint32)-1;
+            stub.ichMinLine = 0;
+            stub.cMinTokMultiUnits = 0;
+            stub.cMinLineMultiUnits = 0;
+            stub.line = 0;
+            stub.functionIdIncrement = 0;
+            stub.lengthDecr = 0;
+            stub.hadEol = 0;
+        }
+
+        js_memcpy_s(*ppBuffer, sizeof(stub), &stub, sizeof(stub));
+        *ppBuffer += sizeof(stub);
+
+        WriteSerializedStubs(pnodeChild, ppBuffer);
+    });
+}
+
+HRESULT SerializeDeferredStubTree(ParseNode *pnodeProg, LPCUTF8 pszSrc, size_t cbSrc, ULONG grfscr, ArenaAllocator *alloc, byte **buffer, uint32 *bufferSize)
+{
+    Assert(pnodeProg->nop == knopProg || pnodeProg->nop == knopModule);
+
+    // The restore points are stored as 32 bit offsets
+    if (cbSrc > UINT32_MAX)
+    {
+        return E_INVALIDARG;
+    }
+
+    uint32 stubCount = CountSerializedStubs(pnodeProg);
+    size_t size = AllocSizeMath::Add(sizeof(SerializedParserStateHeader), AllocSizeMath::Mul(stubCount, sizeof(SerializedDeferredFunctionStub)));
+    if (size > UINT32_MAX)
+    {
+        return E_OUTOFMEMORY;
+    }
+
+    byte *stateBuffer = AnewArray(alloc, byte, size);
+    byte *stubsBuffer = stateBuffer + sizeof(SerializedParserStateHeader);
+    byte *current = stubsBuffer;
+    WriteSerializedStubs(pnodeProg, &current);
+    Assert(current == stateBuffer + size);
+
+    SerializedParserStateHeader header;
+    header.magic = parserStateMagicConstant;
+    header.version = parserStateVersionConstant;
+    header.engineVersion = byteCodeCacheReleaseFileVersion;
+    header.parseFlags = grfscr & parserStateParseFlags;
+    header.sourceLength = static_cast<uint32>(cbSrc);
+    header.sourceHash = ComputeParserStateHash(pszSrc, cbSrc);
+    header.nestedCount = pnodeProg->sxFnc.nestedCount;
+    header.childCount = 0;
+    MapNestedFunctions(pnodeProg->sxFnc.pnodeScopes, [&](ParseNode *) { header.childCount++; });
+    header.stubCount = stubCount;
+    header.stubsHash = ComputeParserStateHash(stubsBuffer, size - sizeof(SerializedParserStateHeader));
+    js_memcpy_s(stateBuffer, size, &header, sizeof(header));
+
+    *buffer = stateBuffer;
+    *bufferSize = static_cast<uint32>(size);
+    return S_OK;
+}
+
+static DeferredFunctionStub * ReadSerializedStubs(Js::ScriptContext *scriptContext, uint nestedCount, uint32 childCount,
+    const byte **ppBuffer, uint32 *pRemainingStubCount)
+{
+    PROBE_STACK(scriptContext, Js::Constants::MinStackDefault);
+
+    if (nestedCount == 0 || childCount > nestedCount || childCount > *pRemainingStubCount)
+    {
+        return nullptr;
+    }
+
+    // Stubs not covered by the serialized state keep their default restore point and are never skipped.
+    DeferredFunctionStub *deferredStubs = RecyclerNewArray(scriptContext->GetRecycler(), DeferredFunctionStub, nestedCount);
+    for (uint32 i = 0; i < childCount; i++)
+    {
+        SerializedDeferredFunctionStub stub;
+        js_memcpy_s(&stub, sizeof(stub), *ppBuffer, sizeof(stub));
+        *ppBuffer += sizeof(stub);
+        --*pRemainingStubCount;
+
+        deferredStubs[i].fncFlags = stub.fncFlags;
+        deferredStubs[i].nestedCount = stub.nestedCount;
+        deferredStubs[i].ichMin = stub.ichMin;
+        if (stub.ichMinTok != (uint32)-1)
+        {
+            RestorePoint &restorePoint = deferredStubs[i].restorePoint;
+            restorePoint.m_ichMinTok = stub.ichMinTok;
+            restorePoint.m_ichMinLine = stub.ichMinLine;
+            restorePoint.m_cMinTokMultiUnits = stub.cMinTokMultiUnits;
+            restorePoint.m_cMinLineMultiUnits = stub.cMinLineMultiUnits;
+            restorePoint.m_line = stub.line;
+            restorePoint.functionIdIncrement = stub.functionIdIncrement;
+            restorePoint.lengthDecr = stub.lengthDecr;
+            restorePoint.m_fHadEol = stub.hadEol ? TRUE : FALSE;
+#ifdef DEBUG
+            // The restore point is always taken on the closing '}' of the function
+            restorePoint.m_cMultiUnits = stub.cMinTokMultiUnits;
+#endif
+        }
+        deferredStubs[i].deferredStubs = ReadSerializedStubs(scriptContext, stub.nestedCount, stub.childCount, ppBuffer, pRemainingStubCount);
+    }
+
+    return deferredStubs;
+}
+
+static bool IsSerializedParserStateForThisEngine(const SerializedParserStateHeader &header)
+{
+    return header.magic == parserStateMagicConstant
+        && header.version == parserStateVersionConstant
+        && memcmp(&header.engineVersion, &byteCodeCacheReleaseFileVersion, sizeof(GUID)) == 0;
+}
+
+static bool IsValidSerializedStub(const SerializedDeferredFunctionStub &stub, uint32 sourceLength)
+{
+    // Offsets and counts are bounded by the length of the source the state was recorded for, which also bounds
+    // the size of the stub array allocated for the function's nested functions.
+    if (stub.ichMin >= sourceLength
+        || stub.nestedCount > sourceLength
+        || stub.childCount > stub.nestedCount)
+    {
+        return false;
+    }
+
+    if (stub.ichMinTok == (uint32)-1)
+    {
+        return true;
+    }
+
+    // The restore point is on the closing '}' of the function, so both the character offset and the unit offset
+    // it seeks to are within the source, after the start of the function and after the start of their line.
+    return stub.ichMinTok >= stub.ichMin
+        && stub.cMinTokMultiUnits < sourceLength
+        && stub.ichMinTok < sourceLength - stub.cMinTokMultiUnits
+        && stub.ichMinLine <= stub.ichMinTok
+        && stub.cMinLineMultiUnits <= stub.cMinTokMultiUnits
+        && stub.line <= sourceLength
+        && stub.functionIdIncrement <= sourceLength
+        && stub.lengthDecr <= sourceLength
+        && stub.hadEol <= 1;
+}
+
+bool IsValidSerializedDeferredStubTree(const byte *buffer, size_t bufferSize)
+{
+    SerializedParserStateHeader header;
+    if (bufferSize < sizeof(header))
+    {
+        return false;
+    }
+    js_memcpy_s(&header, sizeof(header), buffer, sizeof(header));
+
+    if (!IsSerializedParserStateForThisEngine(header))
+    {
+        // A state recorded by another version isn't checked, it is just ignored
+        return true;
+    }
+
+    if ((bufferSize - sizeof(header)) / sizeof(SerializedDeferredFunctionStub) != header.stubCount
+        || (bufferSize - sizeof(header)) % sizeof(SerializedDeferredFunctionStub) != 0
+        || header.nestedCount > header.sourceLength
+        || header.childCount > header.nestedCount)
+    {
+        return false;
+    }
+
+    // The stubs are the functions of the program in pre-order, each followed by the stubs of its childCount
+    // nested functions. Check that they form exactly that tree, without recursing on the untrusted depth.
+    const byte *stubsBuffer = buffer + sizeof(header);
+    uint64 pendingCount = header.childCount;
+    for (uint32 i = 0; i < header.stubCount; i++)
+    {
+        if (pendingCount == 0)
+        {
+            return false;
+        }
+
+        SerializedDeferredFunctionStub stub;
+        js_memcpy_s(&stub, sizeof(stub), stubsBuffer + i * sizeof(stub), sizeof(stub));
+        if (!IsValidSerializedStub(stub, header.sourceLength))
+        {
+            return false;
+        }
+        pendingCount = pendingCount - 1 + stub.childCount;
+    }
+
+    return pendingCount == 0;
+}
+
+DeferredFunctionStub * DeserializeDeferredStubTree(Js::ScriptContext *scriptContext, const byte *buffer, size_t bufferSize, LPCUTF8 pszSrc, size_t cbSrc, ULONG grfscr)
+{
+    // A parser state that doesn't match the source or the engine is ignored, the script then is just parsed as usual.
+    // One that isn't well formed is rejected by the API before the script is parsed.
+    if (!IsValidSerializedDeferredStubTree(buffer, bufferSize))
+    {
+        AssertMsg(false, "Parser state should have been validated");
+        return nullptr;
+    }
+
+    SerializedParserStateHeader header;
+    js_memcpy_s(&header, sizeof(header), buffer, sizeof(header));
+
+    if (!IsSerializedParserStateForThisEngine(header)
+        || header.parseFlags != (grfscr & parserStateParseFlags)
+        || header.sourceLength != cbSrc)
+    {
+        return nullptr;
+    }
+
+    const byte *stubsBuffer = buffer + sizeof(header);
+    if (header.stubsHash != ComputeParserStateHash(stubsBuffer, header.stubCount * sizeof(SerializedDeferredFunctionStub))
+        || header.sourceHash != ComputeParserStateHash(pszSrc, cbSrc))
+    {
+        return nullptr;
+    }
+
+    uint32 remainingStubCount = header.stubCount;
+    return ReadSerializedStubs(scriptContext, header.nestedCount, header.childCount, &stubsBuffer, &remainingStubCount);
+}
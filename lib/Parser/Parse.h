@@ -74,6 +74,13 @@ struct DeferredFunctionStub;
 
 DeferredFunctionStub * BuildDeferredStubTree(ParseNode *pnodeFnc, Recycler *recycler);
 
+// The parser state of a script is the stub tree of its program, recorded by a parse with fscrCreateParserState.
+// It is only valid for the exact source text it was recorded from.
+HRESULT SerializeDeferredStubTree(ParseNode *pnodeProg, LPCUTF8 pszSrc, size_t cbSrc, ULONG grfscr, ArenaAllocator *alloc, byte **buffer, uint32 *bufferSize);
+// Checks that a serialized parser state is well formed. States recorded by another engine version pass, and are ignored.
+bool IsValidSerializedDeferredStubTree(const byte *buffer, size_t bufferSize);
+DeferredFunctionStub * DeserializeDeferredStubTree(Js::ScriptContext *scriptContext, const byte *buffer, size_t bufferSize, LPCUTF8 pszSrc, size_t cbSrc, ULONG grfscr);
+
 struct StmtNest;
 struct BlockInfoStack;
 struct ParseContext
@@ -129,6 +136,7 @@ public:
     void ClearScriptContext() { m_scriptContext = nullptr; }
 
     bool IsBackgroundParser() const { return m_isInBackground; }
+    void SetDeferredStubs(DeferredFunctionStub *deferredStubs) { m_currDeferredStub = deferredStubs; }
     bool IsDoingFastScan() const { return m_doingFastScan; }
 
     static IdentPtr PidFromNode(ParseNodePtr pnode);
@@ -138,6 +146,7 @@ public:
     ArenaAllocator *GetAllocator() { return &m_nodeAllocator;}
 
     size_t GetSourceLength() { return m_length; }
+    void RestoreSourceLength(size_t length) { m_length = length; }
     size_t GetOriginalSourceLength() { return m_originalLength; }
     static ULONG GetDeferralThreshold(bool isProfileLoaded);
     BOOL DeferredParse(Js::LocalFunctionId functionId);
@@ -163,6 +172,11 @@ public:
     HRESULT ParseUtf8Source(__out ParseNodePtr* parseTree, LPCUTF8 pSrc, size_t length, ULONG grfsrc, CompileScriptException *pse,
         Js::LocalFunctionId * nextFunctionId, SourceContextInfo * sourceContextInfo);
 
+    // Same as above, for a source that the host is still handing over. It is scanned as it arrives, and all of it has
+    // arrived when the parse succeeds.
+    HRESULT ParseUtf8Source(__out ParseNodePtr* parseTree, ISourceStream* sourceStream, ULONG grfsrc, CompileScriptException *pse,
+        Js::LocalFunctionId * nextFunctionId, SourceContextInfo * sourceContextInfo);
+
     // Used by deferred parsing to parse a deferred function.
     HRESULT ParseSourceWithOffset(__out ParseNodePtr* parseTree, LPCUTF8 pSrc, size_t offset, size_t cbLength, charcount_t cchOffset,
         bool isCesu8, ULONG grfscr, CompileScriptException *pse, Js::LocalFunctionId * nextFunctionId, ULONG lineNumber,
@@ -193,7 +207,9 @@ private:
     void *              m_errorCallbackData;
     BOOL                m_uncertainStructure;
     bool                m_hasParallelJob;
+    bool                m_parallelParseTopLevelFuncs;
     bool                m_doingFastScan;
+    ISourceStream *     m_sourceStream;       // source that was still arriving when the parse started
     int                 m_nextBlockId;
 
     // RegexPattern objects created for literal regexes are recycler-allocated and need to be kept alive until the function body
@@ -713,6 +729,7 @@ private:
     bool ScanAheadToFunctionEnd(uint count);
 
     bool DoParallelParse(ParseNodePtr pnodeFnc) const;
+    ParseNodePtr GetDeferredStubParent(ParseNodePtr pnodeFncParent) const;
 
     // TODO: We should really call this StartScope and separate out the notion of scopes and blocks;
     // blocks refer to actual curly braced syntax, whereas scopes contain symbols.  All blocks have
@@ -38,7 +38,7 @@ enum
     fscrAllowFunctionProxy = 1 << 17,  // Allow creation of function proxies instead of function bodies
     fscrIsLibraryCode = 1 << 18,  // Current code is engine library code written in Javascript
     fscrNoDeferParse = 1 << 19,  // Do not defer parsing
-    // Unused = 1 << 20,
+    fscrCreateParserState = 1 << 20,  // Record the extents of deferred functions so that the parser state can be serialized
 #ifdef IR_VIEWER
     fscrIrDumpEnable = 1 << 21,  // Allow parseIR to generate an IR dump
 #endif /* IRVIEWER */
@@ -50,6 +50,17 @@ struct ModuleImportOrExportEntry
 typedef SList<ModuleImportOrExportEntry, ArenaAllocator> ModuleImportOrExportEntryList;
 typedef SList<IdentPtr, ArenaAllocator> IdentPtrList;
 
+// Utf8 source that the host is still handing over while it is being scanned.
+interface ISourceStream
+{
+    // Blocks until at least minLength bytes of the source are available, or all of it is. The returned buffer holds
+    // the first *length bytes; it and the buffers returned before it stay valid until the parse is over.
+    virtual LPCUTF8 WaitForSource(size_t minLength, _Out_ size_t *length, _Out_ bool *isComplete) = 0;
+
+    // Length the whole source is expected to have, going by what the host said and what it handed over so far.
+    virtual size_t GetExpectedLength() = 0;
+};
+
 //
 // Below was moved from scrutil.h to share with chakradiag.
 //
@@ -156,6 +156,8 @@ Scanner<EncodingPolicy>::Scanner(Parser* parser, HashTbl *phtbl, Token *ptoken,
 
     m_iecpLimTokPrevious = (size_t)-1;
 
+    m_sourceStream = nullptr;
+
     this->charClassifier = scriptContext->GetCharClassifier();
 
     this->es6UnicodeMode = scriptContext->GetConfig()->IsES6UnicodeExtensionsEnabled();
@@ -215,6 +217,126 @@ void Scanner<EncodingPolicy>::PrepareForBackgroundParse(Js::ScriptContext *scrip
     scriptContext->GetThreadContext()->GetStandardChars((char16*)0);
 }
 
+/*****************************************************************************
+*
+*  Scans a token out of a source that is still arriving. The scan goes as far as
+*  the source read so far; a token that runs into its end, or that could go on past
+*  it, is scanned again once more of the source is in. Each retry waits for at least
+*  as many new units as it scanned, so that a long token or comment that arrives in
+*  small chunks is not rescanned more than a few times over.
+*/
+template <typename EncodingPolicy>
+template <typename Fn>
+tokens Scanner<EncodingPolicy>::ScanFromStream(Fn scan)
+{
+    if (m_sourceStream == nullptr)
+    {
+        return scan();
+    }
+
+    StreamRetryPoint retryPoint;
+    CaptureForStreamRetry(&retryPoint);
+
+    for (;;)
+    {
+        try
+        {
+            tokens tk = scan();
+            if (m_sourceStream == nullptr ||
+                (tk != tkEOF && tk != tkScanError && m_currentCharacter + StreamLookahead < m_pchLast))
+            {
+                return tk;
+            }
+        }
+        catch (ParseExceptionObject&)
+        {
+            if (m_sourceStream == nullptr)
+            {
+                throw;
+            }
+        }
+
+        size_t length = m_pchLast - m_pchBase;
+        size_t newLength = length - retryPoint.m_iecpMinTok;
+        if (newLength < StreamLookahead)
+        {
+            newLength = StreamLookahead;
+        }
+        RestoreForStreamRetry(retryPoint);
+        ReadMoreSource(length + newLength);
+    }
+}
+
+template <typename EncodingPolicy>
+void Scanner<EncodingPolicy>::CaptureForStreamRetry(_Out_ StreamRetryPoint *retryPoint)
+{
+    retryPoint->m_iecpMinLine = m_pchMinLine - m_pchBase;
+    retryPoint->m_iecpMinTok = m_pchMinTok - m_pchBase;
+    retryPoint->m_iecpCurrent = m_currentCharacter - m_pchBase;
+    retryPoint->m_iecpPrevLine = m_pchPrevLine - m_pchBase;
+    retryPoint->m_cMinTokMultiUnits = m_cMinTokMultiUnits;
+    retryPoint->m_cMinLineMultiUnits = m_cMinLineMultiUnits;
+    retryPoint->m_cMultiUnits = this->m_cMultiUnits;
+    retryPoint->m_decodeOptions = this->GetDecodeOptions();
+    retryPoint->m_line = m_line;
+    retryPoint->m_fHadEol = m_fHadEol;
+    retryPoint->m_fStringTemplateDepth = m_fStringTemplateDepth;
+    retryPoint->m_scanState = m_scanState;
+    retryPoint->m_tkPrevious = m_tkPrevious;
+    retryPoint->m_iecpLimTokPrevious = m_iecpLimTokPrevious;
+    retryPoint->m_token = *m_ptoken;
+    retryPoint->m_hr = m_perr->m_hr;
+    retryPoint->m_parserLength = m_parser->GetSourceLength();
+}
+
+template <typename EncodingPolicy>
+void Scanner<EncodingPolicy>::RestoreForStreamRetry(const StreamRetryPoint &retryPoint)
+{
+    m_pchMinLine = m_pchBase + retryPoint.m_iecpMinLine;
+    m_pchMinTok = m_pchBase + retryPoint.m_iecpMinTok;
+    m_currentCharacter = m_pchBase + retryPoint.m_iecpCurrent;
+    m_pchPrevLine = m_pchBase + retryPoint.m_iecpPrevLine;
+    m_cMinTokMultiUnits = retryPoint.m_cMinTokMultiUnits;
+    m_cMinLineMultiUnits = retryPoint.m_cMinLineMultiUnits;
+    this->RestoreMultiUnits(retryPoint.m_cMultiUnits);
+    this->RestoreDecodeOptions(retryPoint.m_decodeOptions);
+    m_line = retryPoint.m_line;
+    m_fHadEol = retryPoint.m_fHadEol;
+    m_fStringTemplateDepth = retryPoint.m_fStringTemplateDepth;
+    m_scanState = retryPoint.m_scanState;
+    m_tkPrevious = retryPoint.m_tkPrevious;
+    m_iecpLimTokPrevious = retryPoint.m_iecpLimTokPrevious;
+    *m_ptoken = retryPoint.m_token;
+    m_perr->m_hr = retryPoint.m_hr;
+
+    // Comments skipped by the scan that is thrown away are not to be counted twice
+    m_parser->RestoreSourceLength(retryPoint.m_parserLength);
+}
+
+template <typename EncodingPolicy>
+void Scanner<EncodingPolicy>::ReadMoreSource(size_t minLength)
+{
+    Assert(m_sourceStream != nullptr);
+
+    size_t length;
+    bool isComplete;
+    EncodedCharPtr pchBase = reinterpret_cast<EncodedCharPtr>(m_sourceStream->WaitForSource(minLength, &length, &isComplete));
+
+    // The source may have moved to a bigger buffer
+    m_pchMinLine = pchBase + (m_pchMinLine - m_pchBase);
+    m_pchMinTok = pchBase + (m_pchMinTok - m_pchBase);
+    m_currentCharacter = pchBase + (m_currentCharacter - m_pchBase);
+    m_pchPrevLine = pchBase + (m_pchPrevLine - m_pchBase);
+    m_pchStartLine = pchBase + (m_pchStartLine - m_pchBase);
+    m_pchBase = pchBase;
+    m_pchLast = pchBase + length;
+
+    if (isComplete)
+    {
+        m_sourceStream = nullptr;
+    }
+}
+
 //-----------------------------------------------------------------------------
 // Number of code points from 'first' up to, but not including the next
 // newline character, embedded NUL, or 'last', depending on which comes first.
@@ -449,11 +571,122 @@ tokens Scanner<EncodingPolicy>::ScanIdentifier(bool identifyKwds, EncodedCharPtr
     return ScanIdentifierContinue(identifyKwds, fHasEscape, fHasMultiChar, pchMin, p, pp);
 }
 
+template <typename EncodingPolicy>
+template <size_t stopCount>
+typename Scanner<EncodingPolicy>::EncodedCharPtr Scanner<EncodingPolicy>::SkipPlainUnits(EncodedCharPtr p, EncodedCharPtr last, const char (&stopChars)[stopCount])
+{
+    // Skip, 16 units at a time, over ASCII units that the caller does not need to look at individually.
+    // NUL and multi unit characters always stop the run. Only whole blocks before last are
+    // looked at, the remaining units are left to the caller's per character loop.
+#if defined(_M_IX86) || defined(_M_X64)
+    if (sizeof(EncodedChar) == 1)
+    {
+        __m128i stops[stopCount];
+        for (size_t i = 0; i < stopCount; i++)
+        {
+            stops[i] = _mm_set1_epi8(stopChars[i]);
+        }
+        const __m128i zero = _mm_setzero_si128();
+
+        while (last - p >= 16)
+        {
+            __m128i units = _mm_loadu_si128(reinterpret_cast<const __m128i *>(p));
+            __m128i matches = _mm_cmpeq_epi8(units, zero);
+            for (size_t i = 0; i < stopCount; i++)
+            {
+                matches = _mm_or_si128(matches, _mm_cmpeq_epi8(units, stops[i]));
+            }
+
+            // The sign bit of the units themselves flags the multi unit characters
+            DWORD mask = (DWORD)(_mm_movemask_epi8(matches) | _mm_movemask_epi8(units));
+            if (mask != 0)
+            {
+                DWORD index;
+                _BitScanForward(&index, mask);
+                return p + index;
+            }
+            p += 16;
+        }
+    }
+#endif
+    return p;
+}
+
+template <typename EncodingPolicy>
+typename Scanner<EncodingPolicy>::EncodedCharPtr Scanner<EncodingPolicy>::SkipBlanks(EncodedCharPtr p, EncodedCharPtr last)
+{
+    // Skip a run of spaces and tabs, typically indentation, 16 units at a time.
+#if defined(_M_IX86) || defined(_M_X64)
+    if (sizeof(EncodedChar) == 1)
+    {
+        const __m128i spaces = _mm_set1_epi8(' ');
+        const __m128i tabs = _mm_set1_epi8('\t');
+
+        while (last - p >= 16)
+        {
+            __m128i units = _mm_loadu_si128(reinterpret_cast<const __m128i *>(p));
+            __m128i blanks = _mm_or_si128(_mm_cmpeq_epi8(units, spaces), _mm_cmpeq_epi8(units, tabs));
+            DWORD mask = (DWORD)(~_mm_movemask_epi8(blanks) & 0xFFFF);
+            if (mask != 0)
+            {
+                DWORD index;
+                _BitScanForward(&index, mask);
+                return p + index;
+            }
+            p += 16;
+        }
+    }
+#endif
+    return p;
+}
+
+template <typename EncodingPolicy>
+typename Scanner<EncodingPolicy>::EncodedCharPtr Scanner<EncodingPolicy>::SkipIdentifierUnits(EncodedCharPtr p, EncodedCharPtr last)
+{
+    // Skip a run of ASCII identifier characters [$0-9A-Z_a-z], 16 units at a time. Multi unit
+    // characters compare as negative and so stop the run, as does the '\\' of an escape.
+#if defined(_M_IX86) || defined(_M_X64)
+    if (sizeof(EncodedChar) == 1)
+    {
+        const __m128i caseBit = _mm_set1_epi8(0x20);
+        const __m128i beforeLowerA = _mm_set1_epi8('a' - 1);
+        const __m128i afterLowerZ = _mm_set1_epi8('z' + 1);
+        const __m128i beforeDigit0 = _mm_set1_epi8('0' - 1);
+        const __m128i afterDigit9 = _mm_set1_epi8('9' + 1);
+        const __m128i underscores = _mm_set1_epi8('_');
+        const __m128i dollars = _mm_set1_epi8('$');
+
+        while (last - p >= 16)
+        {
+            __m128i units = _mm_loadu_si128(reinterpret_cast<const __m128i *>(p));
+
+            // Folding the case bit maps 'A'-'Z' onto 'a'-'z' and nothing else from ASCII into that range
+            __m128i folded = _mm_or_si128(units, caseBit);
+            __m128i letters = _mm_and_si128(_mm_cmpgt_epi8(folded, beforeLowerA), _mm_cmplt_epi8(folded, afterLowerZ));
+            __m128i digits = _mm_and_si128(_mm_cmpgt_epi8(units, beforeDigit0), _mm_cmplt_epi8(units, afterDigit9));
+            __m128i others = _mm_or_si128(_mm_cmpeq_epi8(units, underscores), _mm_cmpeq_epi8(units, dollars));
+            __m128i idChars = _mm_or_si128(_mm_or_si128(letters, digits), others);
+
+            DWORD mask = (DWORD)(~_mm_movemask_epi8(idChars) & 0xFFFF);
+            if (mask != 0)
+            {
+                DWORD index;
+                _BitScanForward(&index, mask);
+                return p + index;
+            }
+            p += 16;
+        }
+    }
+#endif
+    return p;
+}
+
 template <typename EncodingPolicy>
 BOOL Scanner<EncodingPolicy>::FastIdentifierContinue(EncodedCharPtr&p, EncodedCharPtr last)
 {
     if (EncodingPolicy::MultiUnitEncoding)
     {
+        p = SkipIdentifierUnits(p, last);
         while (p < last)
         {
             EncodedChar currentChar = *p;
@@ -857,19 +1090,16 @@ tokens Scanner<EncodingPolicy>::RescanRegExp()
     }
 #endif //DEBUG
 
-    m_currentCharacter = m_pchMinTok;
-    if (*m_currentCharacter != '/')
-        Error(ERRnoSlash);
-    m_currentCharacter++;
-
-    tokens tk = tkNone;
-
+    return ScanFromStream([&]() -> tokens
     {
-        ArenaAllocator alloc(_u("RescanRegExp"), m_parser->GetAllocator()->GetPageAllocator(), m_parser->GetAllocator()->outOfMemoryFunc);
-        tk = ScanRegExpConstant(&alloc);
-    }
+        m_currentCharacter = m_pchMinTok;
+        if (*m_currentCharacter != '/')
+            Error(ERRnoSlash);
+        m_currentCharacter++;
 
-    return tk;
+        ArenaAllocator alloc(_u("RescanRegExp"), m_parser->GetAllocator()->GetPageAllocator(), m_parser->GetAllocator()->outOfMemoryFunc);
+        return ScanRegExpConstant(&alloc);
+    });
 }
 
 template <typename EncodingPolicy>
@@ -890,21 +1120,16 @@ tokens Scanner<EncodingPolicy>::RescanRegExpNoAST()
     }
 #endif //DEBUG
 
-    m_currentCharacter = m_pchMinTok;
-    if (*m_currentCharacter != '/')
-        Error(ERRnoSlash);
-    m_currentCharacter++;
-
-    tokens tk = tkNone;
-
+    return ScanFromStream([&]() -> tokens
     {
-        ArenaAllocator alloc(_u("RescanRegExp"), m_parser->GetAllocator()->GetPageAllocator(), m_parser->GetAllocator()->outOfMemoryFunc);
-        {
-            tk = ScanRegExpConstantNoAST(&alloc);
-        }
-    }
+        m_currentCharacter = m_pchMinTok;
+        if (*m_currentCharacter != '/')
+            Error(ERRnoSlash);
+        m_currentCharacter++;
 
-    return tk;
+        ArenaAllocator alloc(_u("RescanRegExp"), m_parser->GetAllocator()->GetPageAllocator(), m_parser->GetAllocator()->outOfMemoryFunc);
+        return ScanRegExpConstantNoAST(&alloc);
+    });
 }
 
 template <typename EncodingPolicy>
@@ -1171,8 +1396,21 @@ tokens Scanner<EncodingPolicy>::ScanStringConstant(OLECHAR delim, EncodedCharPtr
         m_tempChBufSecondary.Init();
     }
 
+    // Characters which end a run of plain ASCII characters that can be copied to the buffers as is.
+    // In a string template '$' may start a substitution.
+    Assert(delim < 0x80);
+    const char stopChars[] = { (char)delim, stringTemplateMode ? '$' : (char)delim, '\\', '\r', '\n' };
+
     for (;;)
     {
+        EncodedCharPtr pchRun = p;
+        p = SkipPlainUnits(p, last, stopChars);
+        if (p != pchRun)
+        {
+            m_tempChBuf.AppendRun(pchRun, (uint32)(p - pchRun));
+            m_tempChBufSecondary.template AppendRun<createRawString>(pchRun, (uint32)(p - pchRun));
+        }
+
         switch ((rawch = ch = this->ReadFirst(p, last)))
         {
         case kchRET:
@@ -1598,9 +1836,12 @@ tokens Scanner<EncodingPolicy>::SkipComment(EncodedCharPtr *pp, /* out */ bool*
     *containTypeDef = false;
     EncodedCharPtr last = m_pchLast;
     OLECHAR ch;
+    const char stopChars[] = { '*', '\r', '\n' };
 
     for (;;)
     {
+        p = SkipPlainUnits(p, last, stopChars);
+
         switch((ch = this->ReadFirst(p, last)))
         {
         case '*':
@@ -1739,6 +1980,16 @@ tokens Scanner<EncodingPolicy>::ScanAhead()
 
 template<typename EncodingPolicy>
 tokens Scanner<EncodingPolicy>::ScanCore(bool identifyKwds)
+{
+    if (m_sourceStream == nullptr)
+    {
+        return ScanAvailableSource(identifyKwds);
+    }
+    return ScanFromStream([&]() { return this->ScanAvailableSource(identifyKwds); });
+}
+
+template<typename EncodingPolicy>
+tokens Scanner<EncodingPolicy>::ScanAvailableSource(bool identifyKwds)
 {
     codepoint_t ch;
     OLECHAR firstChar;
@@ -1748,6 +1999,7 @@ tokens Scanner<EncodingPolicy>::ScanCore(bool identifyKwds)
     EncodedCharPtr p = m_currentCharacter;
     EncodedCharPtr last = m_pchLast;
     bool seenDelimitedCommentEnd = false;
+    const char lineCommentStopChars[] = { '\r', '\n' };
     
     // store the last token
     m_tkPrevious = m_ptoken->tk;
@@ -1886,6 +2138,7 @@ LEof:
         case 0x000C:
         case 0x0020:
             Assert(chType == _C_WSP);
+            p = SkipBlanks(p, last);
             continue;
 
         case '.':
@@ -2157,6 +2410,8 @@ LSkipLineComment:
                 pchT = NULL;
                 for (;;)
                 {
+                    p = SkipPlainUnits(p, last, lineCommentStopChars);
+
                     switch ((ch = this->ReadFirst(p, last)))
                     {
                     case kchLS:         // 0x2028, classifies as new line
@@ -171,6 +171,8 @@ protected:
     }
 
     static void RestoreMultiUnits(size_t multiUnits) { }
+    static utf8::DecodeOptions GetDecodeOptions() { return utf8::doDefault; }
+    static void RestoreDecodeOptions(utf8::DecodeOptions decodeOptions) { }
     static size_t CharacterOffsetToUnitOffset(EncodedCharPtr start, EncodedCharPtr current, EncodedCharPtr last, charcount_t offset) { return offset; }
 
     static void ConvertToUnicode(__out_ecount_full(cch) LPOLESTR pch, charcount_t cch, EncodedCharPtr pu)
@@ -252,6 +254,8 @@ protected:
         return result;
     }
     void RestoreMultiUnits(size_t multiUnits) { m_cMultiUnits = multiUnits; }
+    utf8::DecodeOptions GetDecodeOptions() const { return m_decodeOptions; }
+    void RestoreDecodeOptions(utf8::DecodeOptions decodeOptions) { m_decodeOptions = decodeOptions; }
 
     size_t CharacterOffsetToUnitOffset(EncodedCharPtr start, EncodedCharPtr current, EncodedCharPtr last, charcount_t offset)
     {
@@ -376,6 +380,7 @@ public:
     tokens ScanNoKeywords();
     tokens ScanForcingPid();
     void SetText(EncodedCharPtr psz, size_t offset, size_t length, charcount_t characterOffset, ULONG grfscr, ULONG lineNumber = 0);
+    void SetSourceStream(ISourceStream *sourceStream) { m_sourceStream = sourceStream; }
     void PrepareForBackgroundParse(Js::ScriptContext *scriptContext);
 
     enum ScanState
@@ -624,6 +629,32 @@ public:
             }
         }
 
+        // Append a run of single unit characters with one capacity check.
+        template<bool performAppend> void AppendRun(EncodedCharPtr prgch, uint32 cch)
+        {
+            if (performAppend)
+            {
+                while (m_cchMax - m_ichCur < cch)
+                {
+                    Grow();
+                }
+
+                Assert(m_ichCur + cch <= m_cchMax);
+                __analysis_assume(m_ichCur + cch <= m_cchMax);
+
+                for (uint32 i = 0; i < cch; i++)
+                {
+                    m_prgch[m_ichCur + i] = static_cast<OLECHAR>(prgch[i]);
+                }
+                m_ichCur += cch;
+            }
+        }
+
+        void AppendRun(EncodedCharPtr prgch, uint32 cch)
+        {
+            return AppendRun<true>(prgch, cch);
+        }
+
         void Grow()
         {
             Assert(m_pscanner != nullptr);
@@ -710,6 +741,34 @@ private:
     tokens m_tkPrevious;
     size_t m_iecpLimTokPrevious;
 
+    // Source that is still arriving, until all of it has been read into the buffer
+    ISourceStream *m_sourceStream;
+
+    // What a scan changes, kept as offsets so that it can be restored over the next buffer of a streamed source
+    struct StreamRetryPoint
+    {
+        size_t m_iecpMinLine;
+        size_t m_iecpMinTok;
+        size_t m_iecpCurrent;
+        size_t m_iecpPrevLine;
+        size_t m_cMinTokMultiUnits;
+        size_t m_cMinLineMultiUnits;
+        size_t m_cMultiUnits;
+        utf8::DecodeOptions m_decodeOptions;
+        charcount_t m_line;
+        BOOL m_fHadEol;
+        uint16 m_fStringTemplateDepth;
+        ScanState m_scanState;
+        tokens m_tkPrevious;
+        size_t m_iecpLimTokPrevious;
+        Token m_token;
+        HRESULT m_hr;
+        size_t m_parserLength;
+    };
+
+    // A token that ends this close to the end of the available source may be the start of a longer one
+    static const size_t StreamLookahead = 16;
+
     Scanner(Parser* parser, HashTbl *phtbl, Token *ptoken, ErrHandler *perr, Js::ScriptContext *scriptContext);
     ~Scanner(void);
 
@@ -717,8 +776,14 @@ private:
     void SeekAndScan(const RestorePoint& restorePoint);
 
     tokens ScanCore(bool identifyKwds);
+    tokens ScanAvailableSource(bool identifyKwds);
     tokens ScanAhead();
 
+    template <typename Fn> tokens ScanFromStream(Fn scan);
+    void CaptureForStreamRetry(_Out_ StreamRetryPoint *retryPoint);
+    void RestoreForStreamRetry(const StreamRetryPoint &retryPoint);
+    void ReadMoreSource(size_t minLength);
+
     tokens ScanError(EncodedCharPtr pchCur, tokens errorToken)
     {
         m_currentCharacter = pchCur;
@@ -755,6 +820,9 @@ private:
     charcount_t LineLength(EncodedCharPtr first, EncodedCharPtr last);
 
     tokens ScanIdentifier(bool identifyKwds, EncodedCharPtr *pp);
+    template <size_t stopCount> static EncodedCharPtr SkipPlainUnits(EncodedCharPtr p, EncodedCharPtr last, const char (&stopChars)[stopCount]);
+    static EncodedCharPtr SkipBlanks(EncodedCharPtr p, EncodedCharPtr last);
+    static EncodedCharPtr SkipIdentifierUnits(EncodedCharPtr p, EncodedCharPtr last);
     BOOL FastIdentifierContinue(EncodedCharPtr&p, EncodedCharPtr last);
     tokens ScanIdentifierContinue(bool identifyKwds, bool fHasEscape, bool fHasMultiChar, EncodedCharPtr pchMin, EncodedCharPtr p, EncodedCharPtr *pp);
     tokens SkipComment(EncodedCharPtr *pp, /* out */ bool* containTypeDef);
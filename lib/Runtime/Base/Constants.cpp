@@ -30,8 +30,10 @@ const uint64 Constants::MantissaMask = 0x000FFFFFFFFFFFFF;
 
 #ifdef _M_AMD64
 const size_t Constants::StackLimitForScriptInterrupt = 0x7fffffffffffffff;
+const size_t Constants::StackLimitForSampleInterrupt = 0xffffffffffff0000;
 #else
 const size_t Constants::StackLimitForScriptInterrupt = 0x7fffffff;
+const size_t Constants::StackLimitForSampleInterrupt = 0xffff0000;
 #endif
 
 #pragma warning(push)
@@ -119,6 +119,11 @@ namespace Js
 
         static const size_t StackLimitForScriptInterrupt;
 
+        // Set by the sampling profiler to get a sample at the next stack probe. Negative, so that the stack probes of
+        // jitted code, which add the frame size and compare signed, never fail because of it; they can't resume after
+        // calling out. Only the stack probes of the runtime take the sample.
+        static const size_t StackLimitForSampleInterrupt;
+
 
         // Arguments object created on the fly is 1 slot before the frame
         static const int ArgumentLocationOnFrame = 1;
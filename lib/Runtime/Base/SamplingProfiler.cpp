@@ -0,0 +1,486 @@
+//-------------------------------------------------------------------------------------------------------
+// Copyright (C) Microsoft. All rights reserved.
+// Licensed under the MIT license. See LICENSE.txt file in the project root for full license information.
+//-------------------------------------------------------------------------------------------------------
+#include "RuntimeBasePch.h"
+#include "Language/JavascriptStackWalker.h"
+
+namespace Js
+{
+    // Counts the length of the profile, writing the part that fits in the buffer
+    class ProfileWriter
+    {
+    public:
+        ProfileWriter(char * buffer, size_t bufferSize) : buffer(buffer), bufferSize(bufferSize), length(0)
+        {
+        }
+
+        size_t GetLength() const { return length; }
+
+        void Write(char ch)
+        {
+            if (length < bufferSize)
+            {
+                buffer[length] = ch;
+            }
+            length++;
+        }
+
+        void Write(const char * str)
+        {
+            for (; *str != '\0'; str++)
+            {
+                Write(*str);
+            }
+        }
+
+        void Write(const char * str, size_t cch)
+        {
+            for (size_t i = 0; i < cch; i++)
+            {
+                Write(str[i]);
+            }
+        }
+
+        void WriteNumber(int64 value)
+        {
+            char digits[20];
+            uint digitCount = 0;
+            uint64 magnitude = value < 0 ? 0 - (uint64)value : (uint64)value;
+            do
+            {
+                digits[digitCount++] = (char)('0' + magnitude % 10);
+                magnitude /= 10;
+            } while (magnitude != 0);
+
+            if (value < 0)
+            {
+                Write('-');
+            }
+            while (digitCount != 0)
+            {
+                Write(digits[--digitCount]);
+            }
+        }
+
+        // Writes a JSON string literal in UTF-8
+        void WriteString(const char16 * str)
+        {
+            static const char hexDigits[] = "0123456789abcdef";
+
+            Write('"');
+            for (; *str != _u('\0'); str++)
+            {
+                codepoint_t ch = *str;
+                if (ch == _u('"') || ch == _u('\\'))
+                {
+                    Write('\\');
+                    Write((char)ch);
+                    continue;
+                }
+
+                if (NumberUtilities::IsSurrogateUpperPart(ch) && NumberUtilities::IsSurrogateLowerPart(str[1]))
+                {
+                    ch = NumberUtilities::SurrogatePairAsCodePoint(ch, str[1]);
+                    str++;
+                }
+                else if (ch < 0x20 || NumberUtilities::IsSurrogateUpperPart(ch) || NumberUtilities::IsSurrogateLowerPart(ch))
+                {
+                    // Control characters and unpaired surrogates can't be written as is
+                    Write("\\u");
+                    Write(hexDigits[(ch >> 12) & 0xf]);
+                    Write(hexDigits[(ch >> 8) & 0xf]);
+                    Write(hexDigits[(ch >> 4) & 0xf]);
+                    Write(hexDigits[ch & 0xf]);
+                    continue;
+                }
+
+                if (ch < 0x80)
+                {
+                    Write((char)ch);
+                }
+                else if (ch < 0x800)
+                {
+                    Write((char)(0xc0 | (ch >> 6)));
+                    Write((char)(0x80 | (ch & 0x3f)));
+                }
+                else if (ch < 0x10000)
+                {
+                    Write((char)(0xe0 | (ch >> 12)));
+                    Write((char)(0x80 | ((ch >> 6) & 0x3f)));
+                    Write((char)(0x80 | (ch & 0x3f)));
+                }
+                else
+                {
+                    Write((char)(0xf0 | (ch >> 18)));
+                    Write((char)(0x80 | ((ch >> 12) & 0x3f)));
+                    Write((char)(0x80 | ((ch >> 6) & 0x3f)));
+                    Write((char)(0x80 | (ch & 0x3f)));
+                }
+            }
+            Write('"');
+        }
+
+        void WriteCallFrame(const char16 * functionName, uint scriptId, const char16 * url, int64 lineNumber, int64 columnNumber)
+        {
+            Write("{\"functionName\":");
+            WriteString(functionName);
+            Write(",\"scriptId\":\"");
+            WriteNumber(scriptId);
+            Write("\",\"url\":");
+            WriteString(url);
+            Write(",\"lineNumber\":");
+            WriteNumber(lineNumber);
+            Write(",\"columnNumber\":");
+            WriteNumber(columnNumber);
+            Write('}');
+        }
+
+    private:
+        char * buffer;
+        size_t bufferSize;
+        size_t length;
+    };
+
+    SamplingProfiler * volatile SamplingProfiler::timerOwner = nullptr;
+
+    SamplingProfiler::SamplingProfiler(ThreadContext * threadContext) :
+        threadContext(threadContext),
+        isRunning(false),
+        pendingTickCount(0),
+        programTickCount(0),
+        pendingTickTime(0),
+        functions(&HeapAllocator::Instance),
+        functionIndices(&HeapAllocator::Instance),
+        nodes(&HeapAllocator::Instance),
+        childNodes(&HeapAllocator::Instance),
+        samples(&HeapAllocator::Instance),
+        startTime(0),
+        endTime(0)
+    {
+        this->Reset();
+    }
+
+    SamplingProfiler::~SamplingProfiler()
+    {
+        this->Stop();
+
+        for (int i = 0; i < this->functions.Count(); i++)
+        {
+            const Function & function = this->functions.Item(i);
+            HeapDeleteArray(function.callFrameLength, function.callFrame);
+        }
+    }
+
+    void SamplingProfiler::Reset()
+    {
+        Assert(!this->isRunning);
+
+        for (int i = 0; i < this->functions.Count(); i++)
+        {
+            const Function & function = this->functions.Item(i);
+            HeapDeleteArray(function.callFrameLength, function.callFrame);
+        }
+        this->functions.Clear();
+        this->functionIndices.Clear();
+        this->childNodes.Clear();
+        this->samples.Clear();
+
+        this->nodes.Clear();
+        Node root = { NoFunctionIndex, NoNodeIndex, NoNodeIndex, 0 };
+        this->nodes.Add(root);
+
+        this->pendingTickCount = 0;
+        this->programTickCount = 0;
+        this->pendingTickTime = 0;
+    }
+
+    bool SamplingProfiler::Start(uint intervalMicroseconds)
+    {
+        Assert(intervalMicroseconds != 0);
+
+        this->Stop();
+        if (InterlockedCompareExchangePointer((PVOID volatile *)&timerOwner, this, nullptr) != nullptr)
+        {
+            return false;
+        }
+
+        this->Reset();
+        this->startTime = Tick::Now().ToMicroseconds();
+        this->endTime = this->startTime;
+        this->isRunning = true;
+
+        if (!PlatformAgnostic::SamplingTimer::Start(intervalMicroseconds, OnTimerTick, this))
+        {
+            this->isRunning = false;
+            InterlockedExchangePointer((PVOID volatile *)&timerOwner, nullptr);
+            return false;
+        }
+        return true;
+    }
+
+    void SamplingProfiler::Stop()
+    {
+        if (!this->isRunning)
+        {
+            return;
+        }
+
+        PlatformAgnostic::SamplingTimer::Stop();
+        this->isRunning = false;
+        this->endTime = Tick::Now().ToMicroseconds();
+        InterlockedExchangePointer((PVOID volatile *)&timerOwner, nullptr);
+    }
+
+    void SamplingProfiler::OnTimerTick(void * state)
+    {
+        // May run in a signal handler that interrupted the script thread anywhere
+        SamplingProfiler * profiler = static_cast<SamplingProfiler *>(state);
+        ThreadContext * threadContext = profiler->threadContext;
+        if (threadContext->GetScriptEntryExit() != nullptr)
+        {
+            // The sample is taken at the next stack probe; remember when it was asked for
+            if (profiler->pendingTickCount == 0)
+            {
+                profiler->pendingTickTime = (LONGLONG)Tick::Now().ToMicroseconds();
+            }
+            InterlockedIncrement(&profiler->pendingTickCount);
+            threadContext->RequestSample();
+        }
+        else
+        {
+            InterlockedIncrement(&profiler->programTickCount);
+        }
+    }
+
+    void SamplingProfiler::TakeSample(PVOID returnAddress)
+    {
+        const uint tickCount = (uint)InterlockedExchange(&this->pendingTickCount, 0);
+        if (!this->isRunning || tickCount == 0)
+        {
+            return;
+        }
+        const uint64 tickTime = (uint64)this->pendingTickTime;
+
+        uint frameCount = 0;
+        {
+            JavascriptStackWalker walker(this->threadContext->GetScriptEntryExit()->scriptContext, true, returnAddress);
+            JavascriptFunction * function;
+            while (frameCount < MaxSampleDepth && walker.GetCaller(&function))
+            {
+                // Library builtins have no function body; their time goes to their caller
+                FunctionBody * functionBody = function->GetFunctionBody();
+                if (functionBody != nullptr)
+                {
+                    this->stackFrames[frameCount++] = functionBody;
+                }
+            }
+        }
+
+        try
+        {
+            uint nodeIndex = RootNodeIndex;
+            for (uint i = frameCount; i > 0; i--)
+            {
+                uint functionIndex;
+                if (!this->TryGetFunctionIndex(this->stackFrames[i - 1], &functionIndex))
+                {
+                    return;
+                }
+                nodeIndex = this->GetChildNode(nodeIndex, functionIndex);
+            }
+
+            this->nodes.Item(nodeIndex).hitCount += tickCount;
+            if ((uint)this->samples.Count() < MaxSampleCount)
+            {
+                // A tick of the timer may have come in on another thread since the count was read
+                const uint64 sampleTime = Tick::Now().ToMicroseconds();
+                Sample sample = { nodeIndex, tickTime, sampleTime > tickTime ? sampleTime - tickTime : 0 };
+                this->samples.Add(sample);
+            }
+        }
+        catch (OutOfMemoryException)
+        {
+            // Drop the sample
+        }
+    }
+
+    bool SamplingProfiler::TryGetFunctionIndex(FunctionBody * functionBody, uint * functionIndex)
+    {
+        uint index;
+        if (this->functionIndices.TryGetValue(functionBody, &index))
+        {
+            const Function & function = this->functions.Item(index);
+            if (function.scriptContext == functionBody->GetScriptContext() && function.functionNumber == functionBody->GetFunctionNumber())
+            {
+                *functionIndex = index;
+                return true;
+            }
+        }
+
+        // First sample of the function: record what the profile needs of it now, the function may be gone by then
+        const char16 * url = functionBody->GetSourceName();
+        ProfileWriter lengthWriter(nullptr, 0);
+        lengthWriter.WriteCallFrame(
+            functionBody->GetExternalDisplayName(),
+            functionBody->GetUtf8SourceInfo()->GetSourceInfoId(),
+            url != nullptr ? url : _u(""),
+            functionBody->GetLineNumber(),
+            functionBody->GetColumnNumber());
+
+        Function function;
+        function.scriptContext = functionBody->GetScriptContext();
+        function.functionNumber = functionBody->GetFunctionNumber();
+        function.callFrameLength = lengthWriter.GetLength();
+        function.callFrame = HeapNewNoThrowArray(char, function.callFrameLength);
+        if (function.callFrame == nullptr)
+        {
+            return false;
+        }
+
+        ProfileWriter writer(function.callFrame, function.callFrameLength);
+        writer.WriteCallFrame(
+            functionBody->GetExternalDisplayName(),
+            functionBody->GetUtf8SourceInfo()->GetSourceInfoId(),
+            url != nullptr ? url : _u(""),
+            functionBody->GetLineNumber(),
+            functionBody->GetColumnNumber());
+
+        try
+        {
+            index = this->functions.Add(function);
+        }
+        catch (OutOfMemoryException)
+        {
+            HeapDeleteArray(function.callFrameLength, function.callFrame);
+            throw;
+        }
+        this->functionIndices.Item(functionBody, index);
+
+        *functionIndex = index;
+        return true;
+    }
+
+    uint SamplingProfiler::GetChildNode(uint parentIndex, uint functionIndex)
+    {
+        const uint64 key = ((uint64)parentIndex << 32) | functionIndex;
+        uint nodeIndex;
+        if (this->childNodes.TryGetValue(key, &nodeIndex))
+        {
+            return nodeIndex;
+        }
+
+        Node node = { functionIndex, NoNodeIndex, this->nodes.Item(parentIndex).firstChild, 0 };
+        nodeIndex = this->nodes.Add(node);
+        this->nodes.Item(parentIndex).firstChild = nodeIndex;
+
+        // If this fails, the next sample adds another node for the same function
+        this->childNodes.Item(key, nodeIndex);
+        return nodeIndex;
+    }
+
+    size_t SamplingProfiler::WriteProfile(__out_ecount_opt(bufferSize) char * buffer, size_t bufferSize) const
+    {
+        ProfileWriter writer(buffer, bufferSize);
+
+        // Node ids are 1 based; the ticks outside of script get a node after all the others
+        const uint programNodeId = this->programTickCount != 0 ? this->nodes.Count() + 1 : 0;
+
+        writer.Write("{\"nodes\":[");
+        for (int i = 0; i < this->nodes.Count(); i++)
+        {
+            const Node & node = this->nodes.Item(i);
+            if (i != 0)
+            {
+                writer.Write(',');
+            }
+
+            writer.Write("{\"id\":");
+            writer.WriteNumber(i + 1);
+            writer.Write(",\"callFrame\":");
+            if (i == RootNodeIndex)
+            {
+                writer.WriteCallFrame(_u("(root)"), 0, _u(""), -1, -1);
+            }
+            else
+            {
+                const Function & function = this->functions.Item(node.functionIndex);
+                writer.Write(function.callFrame, function.callFrameLength);
+            }
+            writer.Write(",\"hitCount\":");
+            writer.WriteNumber(node.hitCount);
+
+            writer.Write(",\"children\":[");
+            bool isFirstChild = true;
+            if (i == RootNodeIndex && programNodeId != 0)
+            {
+                writer.WriteNumber(programNodeId);
+                isFirstChild = false;
+            }
+            for (uint child = node.firstChild; child != NoNodeIndex; child = this->nodes.Item(child).nextSibling)
+            {
+                if (!isFirstChild)
+                {
+                    writer.Write(',');
+                }
+                writer.WriteNumber(child + 1);
+                isFirstChild = false;
+            }
+            writer.Write("]}");
+        }
+
+        if (programNodeId != 0)
+        {
+            writer.Write(",{\"id\":");
+            writer.WriteNumber(programNodeId);
+            writer.Write(",\"callFrame\":");
+            writer.WriteCallFrame(_u("(program)"), 0, _u(""), -1, -1);
+            writer.Write(",\"hitCount\":");
+            writer.WriteNumber(this->programTickCount);
+            writer.Write(",\"children\":[]}");
+        }
+
+        const uint64 profileEndTime = this->isRunning ? Tick::Now().ToMicroseconds() : this->endTime;
+        writer.Write("],\"startTime\":");
+        writer.WriteNumber(this->startTime);
+        writer.Write(",\"endTime\":");
+        writer.WriteNumber(profileEndTime);
+
+        writer.Write(",\"samples\":[");
+        for (int i = 0; i < this->samples.Count(); i++)
+        {
+            if (i != 0)
+            {
+                writer.Write(',');
+            }
+            writer.WriteNumber(this->samples.Item(i).nodeIndex + 1);
+        }
+
+        writer.Write("],\"timeDeltas\":[");
+        uint64 previousTimestamp = this->startTime;
+        for (int i = 0; i < this->samples.Count(); i++)
+        {
+            const uint64 timestamp = max(this->samples.Item(i).timestamp, previousTimestamp);
+            if (i != 0)
+            {
+                writer.Write(',');
+            }
+            writer.WriteNumber((int64)(timestamp - previousTimestamp));
+            previousTimestamp = timestamp;
+        }
+
+        // Not part of the format: how long after its tick each sample was taken, which is the bias of the profile
+        writer.Write("],\"sampleDelays\":[");
+        for (int i = 0; i < this->samples.Count(); i++)
+        {
+            if (i != 0)
+            {
+                writer.Write(',');
+            }
+            writer.WriteNumber((int64)this->samples.Item(i).delay);
+        }
+        writer.Write("]}");
+
+        return writer.GetLength();
+    }
+};
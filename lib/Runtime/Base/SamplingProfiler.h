@@ -0,0 +1,112 @@
+//-------------------------------------------------------------------------------------------------------
+// Copyright (C) Microsoft. All rights reserved.
+// Licensed under the MIT license. See LICENSE.txt file in the project root for full license information.
+//-------------------------------------------------------------------------------------------------------
+#pragma once
+
+namespace Js
+{
+    // Statistical CPU profiler of the script run by a thread context.
+    //
+    // The process wide PlatformAgnostic::SamplingTimer ticks at a fixed interval. When the thread is in script at a
+    // tick, the timer requests a sample by swapping the thread's stack limit for StackLimitForSampleInterrupt, the same
+    // way the host interrupts script, and counts the tick; otherwise the tick is counted as "(program)" time. The next
+    // stack probe of the runtime on the thread (at the entry of interpreted functions and library builtins, or at the
+    // loop tops of interpreted code when interrupt probes are on) walks the stack with a JavascriptStackWalker, which
+    // sees the interpreter, SimpleJit and FullJit frames and the inlinee frames of jitted code, and records it in a call
+    // tree weighted by the ticks counted since the last sample. Jitted code doesn't take samples itself: its stack probes
+    // jump to a helper that can't return into it, so the sample stack limit is made so that they never fail on it. Its
+    // time is accounted when it next calls into the runtime, with its frames still on the stack, which biases the profile
+    // towards the frames of the calls out of hot jitted loops. Each sample records how long after its tick it was taken,
+    // so the bias of a profile can be told from the profile.
+    //
+    // Only the tick counters and the stack limit are shared with the timer, and only through interlocked operations;
+    // everything else is touched on the script thread. The functions seen by the samples are recorded by value, so the
+    // profile doesn't keep them or their script contexts alive and can be written after they are gone.
+    class SamplingProfiler
+    {
+    public:
+        SamplingProfiler(ThreadContext * threadContext);
+        ~SamplingProfiler();
+
+        // Discards the previous profile and starts sampling. Fails if another profiler owns the sampling timer.
+        bool Start(uint intervalMicroseconds);
+        void Stop();
+        bool IsRunning() const { return isRunning; }
+
+        void TakeSample(PVOID returnAddress);
+
+        // Writes the profile in the .cpuprofile JSON format of the Chrome DevTools, in UTF-8. Returns the length of the
+        // whole profile; at most bufferSize bytes of it are written to the buffer, which can be null.
+        size_t WriteProfile(__out_ecount_opt(bufferSize) char * buffer, size_t bufferSize) const;
+
+    private:
+        // Deepest stack recorded by a sample; the outermost frames of deeper stacks are dropped
+        static const uint MaxSampleDepth = 256;
+
+        // Samples kept for the timeline of the profile; the call tree keeps counting the ticks of later samples
+        static const uint MaxSampleCount = 1024 * 1024;
+
+        static const uint RootNodeIndex = 0;
+        static const uint NoNodeIndex = (uint)-1;
+        static const uint NoFunctionIndex = (uint)-1;
+
+        struct Function
+        {
+            // Tell apart a function allocated where a function seen before was collected. Never dereferenced.
+            ScriptContext * scriptContext;
+            uint functionNumber;
+
+            // The JSON callFrame object of the function, in UTF-8
+            char * callFrame;
+            size_t callFrameLength;
+        };
+
+        struct Node
+        {
+            uint functionIndex;
+            uint firstChild;
+            uint nextSibling;
+            uint hitCount;
+        };
+
+        struct Sample
+        {
+            uint nodeIndex;
+
+            // When the tick that asked for the sample came in, and how long before the sample was taken
+            uint64 timestamp;
+            uint64 delay;
+        };
+
+        static void OnTimerTick(void * state);
+
+        void Reset();
+        bool TryGetFunctionIndex(FunctionBody * functionBody, uint * functionIndex);
+        uint GetChildNode(uint parentIndex, uint functionIndex);
+
+        typedef JsUtil::BaseDictionary<FunctionBody *, uint, HeapAllocator> FunctionIndexMap;
+        typedef JsUtil::BaseDictionary<uint64, uint, HeapAllocator> ChildNodeMap;
+
+        ThreadContext * threadContext;
+        bool isRunning;
+
+        // Updated by the sampling timer
+        volatile LONG pendingTickCount;
+        volatile LONG programTickCount;
+        volatile LONGLONG pendingTickTime;
+
+        JsUtil::List<Function, HeapAllocator> functions;
+        FunctionIndexMap functionIndices;
+        JsUtil::List<Node, HeapAllocator> nodes;
+        ChildNodeMap childNodes;
+        JsUtil::List<Sample, HeapAllocator> samples;
+        uint64 startTime;
+        uint64 endTime;
+
+        FunctionBody * stackFrames[MaxSampleDepth];
+
+        // The profiler that owns the sampling timer
+        static SamplingProfiler * volatile timerOwner;
+    };
+};
@@ -861,6 +861,15 @@ namespace Js
         }
     }
 
+    void ScriptContext::GetOrAddPropertyRecord(JavascriptString * propertyNameString, PropertyRecord const ** propertyRecord)
+    {
+        threadContext->GetOrAddPropertyId(propertyNameString, propertyRecord);
+        if (propertyNameString->GetLength() == 2)
+        {
+            CachePropertyString2(*propertyRecord);
+        }
+    }
+
     BOOL ScriptContext::IsNumericPropertyId(PropertyId propertyId, uint32* value)
     {
         BOOL isNumericPropertyId = threadContext->IsNumericPropertyId(propertyId, value);
@@ -1229,7 +1238,8 @@ namespace Js
 #endif
 
 #if ENABLE_BACKGROUND_PARSING
-        if (PHASE_ON1(Js::ParallelParsePhase))
+        if (PHASE_ON1(Js::ParallelParsePhase) ||
+            (CONFIG_FLAG(ParallelParseThreshold) != 0 && this->threadContext->GetJobProcessor()->ProcessesInBackground()))
         {
             this->backgroundParser = BackgroundParser::New(this);
         }
@@ -1721,7 +1731,10 @@ namespace Js
         const char16 *rootDisplayName,
         LoadScriptFlag loadScriptFlag,
         uint* sourceIndex,
-        Js::Var scriptSource)
+        Js::Var scriptSource,
+        const byte* parserState,
+        size_t parserStateSize,
+        ISourceStream* sourceStream)
     {
         if (pSrcInfo == nullptr)
         {
@@ -1734,7 +1747,15 @@ namespace Js
 
         bool isLibraryCode = ((loadScriptFlag & LoadScriptFlag_LibraryCode) == LoadScriptFlag_LibraryCode);
 
-        if ((loadScriptFlag & LoadScriptFlag_Utf8Source) != LoadScriptFlag_Utf8Source)
+        if (sourceStream != nullptr)
+        {
+            // The host is still handing the source over, so the source info is only created once it is all in.
+            // Until then, the length the host expects goes for the heuristics.
+            Assert((loadScriptFlag & LoadScriptFlag_Utf8Source) == LoadScriptFlag_Utf8Source);
+            Assert(parserState == nullptr);
+            length = sourceStream->GetExpectedLength();
+        }
+        else if ((loadScriptFlag & LoadScriptFlag_Utf8Source) != LoadScriptFlag_Utf8Source)
         {
             // Convert to UTF8 and then load that
             length = cb / sizeof(char16);
@@ -1836,8 +1857,35 @@ namespace Js
             grfscr |= fscrIsLibraryCode;
         }
 
+        if ((loadScriptFlag & LoadScriptFlag_CreateParserState) == LoadScriptFlag_CreateParserState)
+        {
+            grfscr |= fscrCreateParserState;
+        }
+
+        if (parserState != nullptr)
+        {
+            // The parser state lets the parser skip the bodies of deferred functions. One that was recorded
+            // for another source is ignored.
+            LPCUTF8 source = (*ppSourceInfo)->GetSource(_u("ScriptContext::ParseScript"));
+            parser->SetDeferredStubs(DeserializeDeferredStubTree(this, parserState, parserStateSize,
+                source, (*ppSourceInfo)->GetCbLength(_u("ScriptContext::ParseScript")), grfscr));
+        }
+
         ParseNodePtr parseTree;
-        if((loadScriptFlag & LoadScriptFlag_Utf8Source) == LoadScriptFlag_Utf8Source)
+        if (sourceStream != nullptr)
+        {
+            hr = parser->ParseUtf8Source(&parseTree, sourceStream, grfscr, pse,
+                &sourceContextInfo->nextLocalFunctionId, sourceContextInfo);
+
+            // A failed parse may not have needed all of the source, but the source info covers all of it
+            bool isComplete;
+            script = sourceStream->WaitForSource(SIZE_MAX, &cb, &isComplete);
+            Assert(isComplete);
+            *ppSourceInfo = Utf8SourceInfo::NewWithNoCopy(this,
+                script, (int)cb, cb, pSrcInfo, isLibraryCode,
+                scriptSource);
+        }
+        else if((loadScriptFlag & LoadScriptFlag_Utf8Source) == LoadScriptFlag_Utf8Source)
         {
             hr = parser->ParseUtf8Source(&parseTree, script, cb, grfscr, pse,
                 &sourceContextInfo->nextLocalFunctionId, sourceContextInfo);
@@ -1872,7 +1920,8 @@ namespace Js
 
     JavascriptFunction* ScriptContext::LoadScript(const byte* script, size_t cb,
         SRCINFO const * pSrcInfo, CompileScriptException * pse, Utf8SourceInfo** ppSourceInfo,
-        const char16 *rootDisplayName, LoadScriptFlag loadScriptFlag, Js::Var scriptSource)
+        const char16 *rootDisplayName, LoadScriptFlag loadScriptFlag, Js::Var scriptSource,
+        const byte* parserState, size_t parserStateSize, ISourceStream* sourceStream)
     {
         Assert(!this->threadContext->IsScriptActive());
         Assert(pse != nullptr);
@@ -1886,7 +1935,7 @@ namespace Js
 
             ParseNodePtr parseTree = ParseScript(&parser, script, cb, pSrcInfo,
                 pse, ppSourceInfo, rootDisplayName, loadScriptFlag,
-                &sourceIndex, scriptSource);
+                &sourceIndex, scriptSource, parserState, parserStateSize, sourceStream);
 
             if (parseTree != nullptr)
             {
@@ -1900,8 +1949,14 @@ namespace Js
                 pse->Clear();
 
                 loadScriptFlag = (LoadScriptFlag)(loadScriptFlag | LoadScriptFlag_disableAsmJs);
+                if (sourceStream != nullptr)
+                {
+                    // All of the source is in the source info now, parse it from there
+                    script = (*ppSourceInfo)->GetSource(_u("ScriptContext::LoadScript"));
+                    cb = (*ppSourceInfo)->GetCbLength(_u("ScriptContext::LoadScript"));
+                }
                 return LoadScript(script, cb, pSrcInfo, pse, ppSourceInfo,
-                    rootDisplayName, loadScriptFlag, scriptSource);
+                    rootDisplayName, loadScriptFlag, scriptSource, parserState, parserStateSize);
             }
 
 #ifdef ENABLE_SCRIPT_PROFILING
@@ -1926,6 +1981,56 @@ namespace Js
         }
     }
 
+    HRESULT ScriptContext::SerializeParserState(const byte* script, size_t cb,
+        SRCINFO const * pSrcInfo, CompileScriptException * pse, Utf8SourceInfo** ppSourceInfo,
+        const char16 *rootDisplayName, LoadScriptFlag loadScriptFlag,
+        ArenaAllocator* alloc, byte** buffer, uint32* bufferSize, Js::Var scriptSource)
+    {
+        Assert(!this->threadContext->IsScriptActive());
+        Assert(pse != nullptr);
+        try
+        {
+            AUTO_NESTED_HANDLED_EXCEPTION_TYPE((ExceptionType)(ExceptionType_OutOfMemory | ExceptionType_StackOverflow));
+            Parser parser(this);
+            uint sourceIndex;
+
+            // Only the parse is needed; the functions' extents are recorded on the parse tree.
+            loadScriptFlag = (LoadScriptFlag)(loadScriptFlag | LoadScriptFlag_CreateParserState);
+            ParseNodePtr parseTree = ParseScript(&parser, script, cb, pSrcInfo,
+                pse, ppSourceInfo, rootDisplayName, loadScriptFlag,
+                &sourceIndex, scriptSource);
+            if (parseTree == nullptr)
+            {
+                return E_FAIL;
+            }
+
+            HRESULT hr = SerializeDeferredStubTree(parseTree,
+                (*ppSourceInfo)->GetSource(_u("ScriptContext::SerializeParserState")),
+                (*ppSourceInfo)->GetCbLength(_u("ScriptContext::SerializeParserState")),
+                (*ppSourceInfo)->GetParseFlags(), alloc, buffer, bufferSize);
+            if (FAILED(hr))
+            {
+                pse->ProcessError(nullptr, hr, nullptr);
+            }
+            return hr;
+        }
+        catch (Js::OutOfMemoryException)
+        {
+            pse->ProcessError(nullptr, E_OUTOFMEMORY, nullptr);
+            return E_OUTOFMEMORY;
+        }
+        catch (Js::StackOverflowException)
+        {
+            pse->ProcessError(nullptr, VBSERR_OutOfStack, nullptr);
+            return VBSERR_OutOfStack;
+        }
+    }
+
+    bool ScriptContext::IsValidParserState(const byte* parserState, size_t parserStateSize)
+    {
+        return IsValidSerializedDeferredStubTree(parserState, parserStateSize);
+    }
+
     JavascriptFunction* ScriptContext::GenerateRootFunction(ParseNodePtr parseTree, uint sourceIndex, Parser* parser, uint32 grfscr, CompileScriptException * pse, const char16 *rootDisplayName)
     {
         HRESULT hr;
@@ -82,7 +82,8 @@ enum LoadScriptFlag
     LoadScriptFlag_isFunction = 0x20,                   // input script is in a function scope, not global code.
     LoadScriptFlag_Utf8Source = 0x40,                   // input buffer is utf8 encoded.
     LoadScriptFlag_LibraryCode = 0x80,                  // for debugger, indicating 'not my code'
-    LoadScriptFlag_ExternalArrayBuffer = 0x100          // for ExternalArrayBuffer
+    LoadScriptFlag_ExternalArrayBuffer = 0x100,         // for ExternalArrayBuffer
+    LoadScriptFlag_CreateParserState = 0x200            // record the function extents needed to serialize the parser state
 };
 
 class HostScriptContext
@@ -1184,6 +1185,7 @@ private:
         }
         PropertyId GetOrAddPropertyIdTracked(__in_ecount(propertyNameLength) LPCWSTR pszPropertyName, __in int propertyNameLength);
         void GetOrAddPropertyRecord(__in_ecount(propertyNameLength) LPCWSTR pszPropertyName, __in int propertyNameLength, PropertyRecord const** propertyRecord);
+        void GetOrAddPropertyRecord(JavascriptString * propertyNameString, PropertyRecord const** propertyRecord);
         BOOL IsNumericPropertyId(PropertyId propertyId, uint32* value);
 
         void RegisterWeakReferenceDictionary(JsUtil::IWeakReferenceDictionary* weakReferenceDictionary);
@@ -1200,13 +1202,25 @@ private:
             size_t cb, SRCINFO const * pSrcInfo,
             CompileScriptException * pse, Utf8SourceInfo** ppSourceInfo,
             const char16 *rootDisplayName, LoadScriptFlag loadScriptFlag,
-            uint* sourceIndex, Js::Var scriptSource = nullptr);
+            uint* sourceIndex, Js::Var scriptSource = nullptr,
+            const byte* parserState = nullptr, size_t parserStateSize = 0,
+            ISourceStream* sourceStream = nullptr);
 
         JavascriptFunction* LoadScript(const byte* script, size_t cb,
             SRCINFO const * pSrcInfo,
             CompileScriptException * pse, Utf8SourceInfo** ppSourceInfo,
             const char16 *rootDisplayName, LoadScriptFlag loadScriptFlag,
+            Js::Var scriptSource = nullptr,
+            const byte* parserState = nullptr, size_t parserStateSize = 0,
+            ISourceStream* sourceStream = nullptr);
+
+        HRESULT SerializeParserState(const byte* script, size_t cb,
+            SRCINFO const * pSrcInfo,
+            CompileScriptException * pse, Utf8SourceInfo** ppSourceInfo,
+            const char16 *rootDisplayName, LoadScriptFlag loadScriptFlag,
+            ArenaAllocator* alloc, byte** buffer, uint32* bufferSize,
             Js::Var scriptSource = nullptr);
+        static bool IsValidParserState(const byte* parserState, size_t parserStateSize);
 
         ArenaAllocator* GeneralAllocator() { return &generalAllocator; }
 
@@ -7,6 +7,7 @@
 #include "BackendApi.h"
 #include "ThreadServiceWrapper.h"
 #include "Types/TypePropertyCache.h"
+#include "Types/MegamorphicPropertyCache.h"
 #include "Debug/DebuggingFlags.h"
 #include "Debug/DiagProbe.h"
 #include "Debug/DebugManager.h"
@@ -178,6 +179,8 @@ ThreadContext::ThreadContext(AllocationPolicyManager * allocationPolicyManager,
     codePageAllocators(allocationPolicyManager, ALLOC_XDATA, GetPreReservedVirtualAllocator(), GetCurrentProcess()),
 #endif
     dynamicObjectEnumeratorCacheMap(&HeapAllocator::Instance, 16),
+    megamorphicPropertyCache(nullptr),
+    samplingProfiler(nullptr),
     //threadContextFlags(ThreadContextFlagNoFlag),
 #ifdef NTBUILD
     telemetryBlock(&localTelemetryBlock),
@@ -213,6 +216,8 @@ ThreadContext::ThreadContext(AllocationPolicyManager * allocationPolicyManager,
 #endif
     isScriptActive = false;
 
+    ClearPropertyRecordStringCache();
+
 #ifdef ENABLE_CUSTOM_ENTROPY
     entropy.Initialize();
 #endif
@@ -249,6 +254,8 @@ ThreadContext::ThreadContext(AllocationPolicyManager * allocationPolicyManager,
     this->threadId = ::GetCurrentThreadId();
 #endif
 
+    memset(&jitStatistics, 0, sizeof(jitStatistics));
+
 #ifdef NTBUILD
     memset(&localTelemetryBlock, 0, sizeof(localTelemetryBlock));
 #endif
@@ -379,6 +386,10 @@ void ThreadContext::GlobalInitialize()
     {
         builtInPropertyRecords[i]->SetHash(JsUtil::CharacterBuffer<WCHAR>::StaticGetHashCode(builtInPropertyRecords[i]->GetBuffer(), builtInPropertyRecords[i]->GetLength()));
     }
+
+#if ENABLE_NATIVE_CODEGEN && ENABLE_FAST_ARRAYBUFFER && !defined(_WIN32)
+    PAL_SetAccessViolationResumeHandler(Js::JavascriptFunction::ResumeForOutOfBoundsArrayRefsHandler);
+#endif
 }
 
 ThreadContext::~ThreadContext()
@@ -417,6 +428,18 @@ ThreadContext::~ThreadContext()
         interruptPoller = nullptr;
     }
 
+    if (megamorphicPropertyCache)
+    {
+        HeapDelete(megamorphicPropertyCache);
+        megamorphicPropertyCache = nullptr;
+    }
+
+    if (samplingProfiler)
+    {
+        HeapDelete(samplingProfiler);
+        samplingProfiler = nullptr;
+    }
+
 #if DBG
     // ThreadContext dtor may be running on a different thread.
     // Recycler may call finalizer that free temp Arenas, which will free pages back to
@@ -867,8 +890,75 @@ ThreadContext::GetPropertyNameImpl(Js::PropertyId propertyId)
 void
 ThreadContext::FindPropertyRecord(Js::JavascriptString *pstName, Js::PropertyRecord const ** propertyRecord)
 {
-    LPCWSTR psz = pstName->GetSz();
-    FindPropertyRecord(psz, pstName->GetLength(), propertyRecord);
+    EnterPinnedScope((volatile void **)propertyRecord);
+    *propertyRecord = FindPropertyRecord(pstName);
+    LeavePinnedScope();
+}
+
+const Js::PropertyRecord *
+ThreadContext::FindPropertyRecord(Js::JavascriptString * propertyNameString)
+{
+    Js::PropertyRecord const * propertyRecord;
+
+    if (VirtualTableInfo<Js::PropertyString>::HasVirtualTable(propertyNameString))
+    {
+        return ((Js::PropertyString *)propertyNameString)->GetPropertyRecord();
+    }
+
+    const uint cacheIndex = GetPropertyRecordStringCacheIndex(propertyNameString);
+    if (propertyRecordStringCache[cacheIndex].propertyNameString == propertyNameString)
+    {
+        propertyRecord = propertyRecordStringCache[cacheIndex].propertyRecord;
+        Assert(propertyRecord == FindPropertyRecord(propertyNameString->GetString(), propertyNameString->GetLength()));
+        return propertyRecord;
+    }
+
+    const char16 * propertyName = propertyNameString->GetString();
+    const charcount_t propertyNameLength = propertyNameString->GetLength();
+    if (IsDirectPropertyName(propertyName, propertyNameLength))
+    {
+        propertyRecord = propertyNamesDirect[propertyName[0]];
+        Assert(propertyRecord == propertyMap->LookupWithKey(propertyNameString));
+    }
+    else
+    {
+        // Look up with the string itself, to use the hash code cached on it
+        propertyRecord = propertyMap->LookupWithKey(propertyNameString);
+    }
+
+    if (propertyRecord != nullptr)
+    {
+        CachePropertyRecord(propertyNameString, propertyRecord);
+    }
+    return propertyRecord;
+}
+
+uint
+ThreadContext::GetPropertyRecordStringCacheIndex(Js::JavascriptString * propertyNameString) const
+{
+    CompileAssert((PropertyRecordStringCacheSize & (PropertyRecordStringCacheSize - 1)) == 0);
+    return (uint)(reinterpret_cast<size_t>(propertyNameString) >> HeapConstants::ObjectAllocationShift) & (PropertyRecordStringCacheSize - 1);
+}
+
+void
+ThreadContext::CachePropertyRecord(Js::JavascriptString * propertyNameString, const Js::PropertyRecord * propertyRecord)
+{
+    Assert(propertyRecord != nullptr);
+
+    if (PHASE_OFF1(Js::PropertyRecordStringCachePhase))
+    {
+        return;
+    }
+
+    PropertyRecordStringCacheEntry * entry = &propertyRecordStringCache[GetPropertyRecordStringCacheIndex(propertyNameString)];
+    entry->propertyNameString = propertyNameString;
+    entry->propertyRecord = propertyRecord;
+}
+
+void
+ThreadContext::ClearPropertyRecordStringCache()
+{
+    memset(propertyRecordStringCache, 0, sizeof(propertyRecordStringCache));
 }
 
 void
@@ -1198,6 +1288,18 @@ void ThreadContext::GetOrAddPropertyId(JsUtil::CharacterBuffer<WCHAR> const& pro
     LeavePinnedScope();
 }
 
+void ThreadContext::GetOrAddPropertyId(Js::JavascriptString * propertyNameString, Js::PropertyRecord const ** propRecord)
+{
+    EnterPinnedScope((volatile void **)propRecord);
+    *propRecord = FindPropertyRecord(propertyNameString);
+    if (*propRecord == nullptr)
+    {
+        *propRecord = GetOrAddPropertyRecord(JsUtil::CharacterBuffer<WCHAR>(propertyNameString->GetString(), propertyNameString->GetLength()));
+        CachePropertyRecord(propertyNameString, *propRecord);
+    }
+    LeavePinnedScope();
+}
+
 const Js::PropertyRecord *
 ThreadContext::GetOrAddPropertyRecordImpl(JsUtil::CharacterBuffer<char16> propertyName, bool bind)
 {
@@ -1607,6 +1709,7 @@ ThreadContext::IsOnStack(void const *ptr)
     FAULTINJECT_SCRIPT_TERMINATION;
     size_t limit = this->stackLimitForCurrentThread;
     Assert(limit == Js::Constants::StackLimitForScriptInterrupt
+        || limit == Js::Constants::StackLimitForSampleInterrupt
         || !this->GetStackProber()
         || limit == this->GetStackProber()->GetScriptStackLimit());
     return limit;
@@ -1623,6 +1726,11 @@ ThreadContext::IsStackAvailable(size_t size)
 {
     size_t sp = (size_t)_AddressOfReturnAddress();
     size_t stackLimit = this->GetStackLimitForCurrentThread();
+    if (stackLimit == Js::Constants::StackLimitForSampleInterrupt)
+    {
+        // The request stays pending until the next ProbeStack
+        stackLimit = this->GetStackProber()->GetScriptStackLimit();
+    }
     bool stackAvailable = (sp > size && (sp - size) > stackLimit);
 
     // Verify that JIT'd frames didn't mess up the ABI stack alignment
@@ -1659,6 +1767,10 @@ ThreadContext::IsStackAvailableNoThrow(size_t size)
 {
     size_t sp = (size_t)_AddressOfReturnAddress();
     size_t stackLimit = this->GetStackLimitForCurrentThread();
+    if (stackLimit == Js::Constants::StackLimitForSampleInterrupt)
+    {
+        stackLimit = this->GetStackProber()->GetScriptStackLimit();
+    }
     bool stackAvailable = (sp > stackLimit) && (sp > size) && ((sp - size) > stackLimit);
 
     FAULTINJECT_STACK_PROBE
@@ -1688,6 +1800,11 @@ void
 ThreadContext::ProbeStackNoDispose(size_t size, Js::ScriptContext *scriptContext, PVOID returnAddress)
 {
     AssertCanHandleStackOverflow();
+    if (this->IsSampleRequested())
+    {
+        this->TakeRequestedSample(returnAddress);
+    }
+
     if (!this->IsStackAvailable(size))
     {
         if (this->IsExecutionDisabled())
@@ -2563,6 +2680,14 @@ ThreadContext::PreSweepCallback()
     ClearForInCaches();
 
     this->dynamicObjectEnumeratorCacheMap.Clear();
+
+    // The megamorphic property cache doesn't keep its types alive
+    if (this->megamorphicPropertyCache)
+    {
+        this->megamorphicPropertyCache->Clear();
+    }
+    // Neither does the property record string cache keep its strings or property records alive
+    ClearPropertyRecordStringCache();
 }
 
 void
@@ -3265,6 +3390,11 @@ ThreadContext::InvalidateProtoInlineCaches(Js::PropertyId propertyId)
 void
 ThreadContext::InvalidateStoreFieldInlineCaches(Js::PropertyId propertyId)
 {
+    if (megamorphicPropertyCache)
+    {
+        megamorphicPropertyCache->Clear(propertyId);
+    }
+
     InlineCacheList* inlineCacheList;
     if (storeFieldInlineCacheByPropId.TryGetValueAndRemove(propertyId, &inlineCacheList))
     {
@@ -3730,6 +3860,11 @@ ThreadContext::AreAllProtoInlineCachesInvalidated()
 void
 ThreadContext::InvalidateAllStoreFieldInlineCaches()
 {
+    if (megamorphicPropertyCache)
+    {
+        megamorphicPropertyCache->Clear();
+    }
+
     storeFieldInlineCacheByPropId.Map([this](Js::PropertyId propertyId, InlineCacheList* inlineCacheList)
     {
         InvalidateAndDeleteInlineCacheList(inlineCacheList);
@@ -3910,6 +4045,11 @@ void ThreadContext::InvalidateProtoTypePropertyCaches(const Js::PropertyId prope
 
 void ThreadContext::InternalInvalidateProtoTypePropertyCaches(const Js::PropertyId propertyId)
 {
+    if (megamorphicPropertyCache)
+    {
+        megamorphicPropertyCache->ClearIfPropertyIsOnAPrototype(propertyId);
+    }
+
     // Get the hash set of registered types associated with the property ID, invalidate each type in the hash set, and
     // remove the property ID and its hash set from the map
     PropertyIdToTypeHashSetDictionary &typesWithProtoPropertyCache = recyclableData->typesWithProtoPropertyCache;
@@ -3922,6 +4062,11 @@ void ThreadContext::InternalInvalidateProtoTypePropertyCaches(const Js::Property
 
 void ThreadContext::InvalidateAllProtoTypePropertyCaches()
 {
+    if (megamorphicPropertyCache)
+    {
+        megamorphicPropertyCache->Clear();
+    }
+
     PropertyIdToTypeHashSetDictionary &typesWithProtoPropertyCache = recyclableData->typesWithProtoPropertyCache;
     if (typesWithProtoPropertyCache.Count() > 0)
     {
@@ -4463,6 +4608,26 @@ ThreadContext::AddDynamicObjectEnumeratorCache(Js::DynamicType const * dynamicTy
     this->dynamicObjectEnumeratorCacheMap.Item(dynamicType, cache);
 }
 
+Js::MegamorphicPropertyCache *
+ThreadContext::EnsureMegamorphicPropertyCache()
+{
+    if (this->megamorphicPropertyCache == nullptr)
+    {
+        this->megamorphicPropertyCache = HeapNew(Js::MegamorphicPropertyCache);
+    }
+    return this->megamorphicPropertyCache;
+}
+
+Js::SamplingProfiler *
+ThreadContext::EnsureSamplingProfiler()
+{
+    if (this->samplingProfiler == nullptr)
+    {
+        this->samplingProfiler = HeapNew(Js::SamplingProfiler, this);
+    }
+    return this->samplingProfiler;
+}
+
 InterruptPoller::InterruptPoller(ThreadContext *tc) :
     threadContext(tc),
     lastPollTick(0),
@@ -4511,6 +4676,34 @@ void ThreadContext::DisableExecution()
     return;
 }
 
+void ThreadContext::RequestSample()
+{
+    // Called by the sampling timer, possibly from a signal handler that interrupted this very thread, so it can't do
+    // more than swap the stack limit. A host that disabled execution in the meantime keeps its own stack limit.
+    const size_t stackLimit = this->stackLimitForCurrentThread;
+    if (stackLimit != Js::Constants::StackLimitForScriptInterrupt && stackLimit != Js::Constants::StackLimitForSampleInterrupt)
+    {
+        InterlockedCompareExchangePointer(
+            (PVOID volatile *)&this->stackLimitForCurrentThread, (PVOID)Js::Constants::StackLimitForSampleInterrupt, (PVOID)stackLimit);
+    }
+}
+
+void ThreadContext::TakeRequestedSample(PVOID returnAddress)
+{
+    Assert(this->GetStackProber());
+
+    // Restore the normal stack limit first, unless execution was disabled since the request
+    InterlockedCompareExchangePointer(
+        (PVOID volatile *)&this->stackLimitForCurrentThread,
+        (PVOID)this->GetStackProber()->GetScriptStackLimit(),
+        (PVOID)Js::Constants::StackLimitForSampleInterrupt);
+
+    if (this->samplingProfiler != nullptr && this->GetScriptEntryExit() != nullptr)
+    {
+        this->samplingProfiler->TakeSample(returnAddress);
+    }
+}
+
 void ThreadContext::EnableExecution()
 {
     Assert(this->GetStackProber());
@@ -10,6 +10,8 @@ namespace Js
     struct InlineCache;
     class DebugManager;
     class CodeGenRecyclableData;
+    class MegamorphicPropertyCache;
+    class SamplingProfiler;
     struct ReturnedValue;
     typedef JsUtil::List<ReturnedValue*> ReturnedValueList;
 }
@@ -214,6 +216,18 @@ struct ThreadContextWatsonTelemetryBlock
 };
 #endif
 
+// Work of the JIT for all the script contexts of a thread, kept in all builds so that hosts can see how much of the code
+// reaches each tier. Jobs are counted when the job processor is done with them, which may be on a background thread.
+struct ThreadContextJitStatistics
+{
+    uint simpleJitFunctionCount;            // Function bodies jitted by the simple JIT
+    uint fullJitFunctionCount;              // Function bodies jitted by the full JIT, including rejits
+    uint loopBodyCount;                     // Loop bodies jitted
+    uint failedCount;                       // Jobs that failed or were aborted
+    uint bailOutCount;                      // Bailouts that were checked for a rejit
+    uint rejitCount;                        // Rejits of functions and loop bodies scheduled after a bailout
+};
+
 class NativeLibraryEntryRecord
 {
 public:
@@ -803,6 +817,25 @@ private:
     typedef JsUtil::BaseDictionary<Js::DynamicType const *, void *, HeapAllocator, PowerOf2SizePolicy> DynamicObjectEnumeratorCacheMap;
     DynamicObjectEnumeratorCacheMap dynamicObjectEnumeratorCacheMap;
 
+    // Created when the first property access site goes megamorphic
+    Js::MegamorphicPropertyCache * megamorphicPropertyCache;
+
+    // Created when the host first starts the sampling profiler
+    Js::SamplingProfiler * samplingProfiler;
+
+    // Direct mapped cache of the property records last looked up for strings that are not PropertyStrings, so that a string
+    // used as a key over and over doesn't need a property map lookup every time. Keyed by the address of the string, which
+    // doesn't keep the string or the property record alive, so the cache is cleared before every sweep.
+    struct PropertyRecordStringCacheEntry
+    {
+        Js::JavascriptString * propertyNameString;
+        const Js::PropertyRecord * propertyRecord;
+    };
+    static const uint PropertyRecordStringCacheSize = 256; // Must be a power of 2
+    PropertyRecordStringCacheEntry propertyRecordStringCache[PropertyRecordStringCacheSize];
+
+    ThreadContextJitStatistics jitStatistics;
+
 #ifdef NTBUILD
     ThreadContextWatsonTelemetryBlock localTelemetryBlock;
     ThreadContextWatsonTelemetryBlock * telemetryBlock;
@@ -1088,6 +1121,7 @@ public:
 
     void GetOrAddPropertyId(__in LPCWSTR propertyName, __in int propertyNameLength, Js::PropertyRecord const** propertyRecord);
     void GetOrAddPropertyId(JsUtil::CharacterBuffer<WCHAR> const& propertyName, Js::PropertyRecord const** propertyRecord);
+    void GetOrAddPropertyId(Js::JavascriptString * propertyNameString, Js::PropertyRecord const** propertyRecord);
     Js::PropertyRecord const * UncheckedAddPropertyId(JsUtil::CharacterBuffer<WCHAR> const& propertyName, bool bind, bool isSymbol = false);
     Js::PropertyRecord const * UncheckedAddPropertyId(__in LPCWSTR propertyName, __in int propertyNameLength, bool bind = false, bool isSymbol = false);
 
@@ -1097,6 +1131,10 @@ public:
 
 private:
     const Js::PropertyRecord * GetOrAddPropertyRecordImpl(JsUtil::CharacterBuffer<char16> propertyName, bool bind);
+    const Js::PropertyRecord * FindPropertyRecord(Js::JavascriptString * propertyNameString);
+    uint GetPropertyRecordStringCacheIndex(Js::JavascriptString * propertyNameString) const;
+    void CachePropertyRecord(Js::JavascriptString * propertyNameString, const Js::PropertyRecord * propertyRecord);
+    void ClearPropertyRecordStringCache();
     void AddPropertyRecordInternal(const Js::PropertyRecord * propertyRecord);
     void BindPropertyRecord(const Js::PropertyRecord * propertyRecord);
     bool IsDirectPropertyName(const char16 * propertyName, int propertyNameLength);
@@ -1172,6 +1210,7 @@ public:
     Js::ScriptEntryExitRecord * GetScriptEntryExit() const { return entryExitRecord; }
     void RegisterCodeGenRecyclableData(Js::CodeGenRecyclableData *const codeGenRecyclableData);
     void UnregisterCodeGenRecyclableData(Js::CodeGenRecyclableData *const codeGenRecyclableData);
+    ThreadContextJitStatistics * GetJitStatistics() { return &jitStatistics; }
 #if ENABLE_NATIVE_CODEGEN
     BOOL IsNativeAddress(void * pCodeAddr);
     JsUtil::JobProcessor *GetJobProcessor();
@@ -1574,6 +1613,12 @@ public:
 
     void * GetDynamicObjectEnumeratorCache(Js::DynamicType const * dynamicType);
     void AddDynamicObjectEnumeratorCache(Js::DynamicType const * dynamicType, void * cache);
+
+    Js::MegamorphicPropertyCache * GetMegamorphicPropertyCache() const { return megamorphicPropertyCache; }
+    Js::MegamorphicPropertyCache * EnsureMegamorphicPropertyCache();
+
+    Js::SamplingProfiler * GetSamplingProfiler() const { return samplingProfiler; }
+    Js::SamplingProfiler * EnsureSamplingProfiler();
 public:
     bool IsScriptActive() const { return isScriptActive; }
     void SetIsScriptActive(bool isActive) { isScriptActive = isActive; }
@@ -1583,6 +1628,12 @@ public:
     }
     void DisableExecution();
     void EnableExecution();
+    bool IsSampleRequested() const
+    {
+        return this->stackLimitForCurrentThread == Js::Constants::StackLimitForSampleInterrupt;
+    }
+    void RequestSample();
+    void TakeRequestedSample(PVOID returnAddress);
     bool TestThreadContextFlag(ThreadContextFlags threadContextFlag) const;
     void SetThreadContextFlag(ThreadContextFlags threadContextFlag);
     void ClearThreadContextFlag(ThreadContextFlags threadContextFlag);
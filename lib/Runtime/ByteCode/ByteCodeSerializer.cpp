@@ -4127,6 +4127,18 @@ HRESULT ByteCodeSerializer::DeserializeFromBuffer(ScriptContext * scriptContext,
     return ByteCodeSerializer::DeserializeFromBufferInternal(scriptContext, scriptFlags, utf8Source, /* sourceHolder */ nullptr, srcInfo, buffer, nativeModule, function, sourceIndex);
 }
 // Deserialize function body from supplied buffer
+#if ENABLE_DEBUG_CONFIG_OPTIONS
+void ByteCodeSerializer::ChangeMajorVersion(byte * buffer)
+{
+    // The major version follows the magic constant, the total size and the version scheme
+    byte * majorVersion = buffer + sizeof(int) * 2 + sizeof(byte);
+    DWORD version;
+    js_memcpy_s(&version, sizeof(version), majorVersion, sizeof(version));
+    version++;
+    js_memcpy_s(majorVersion, sizeof(version), &version, sizeof(version));
+}
+#endif
+
 HRESULT ByteCodeSerializer::DeserializeFromBuffer(ScriptContext * scriptContext, uint32 scriptFlags, ISourceHolder* sourceHolder, SRCINFO const * srcInfo, byte * buffer, NativeModule *nativeModule, FunctionBody** function, uint sourceIndex)
 {
     AssertMsg(sourceHolder != nullptr, "SourceHolder can't be null, if you have an empty source then pass ISourceHolder::GetEmptySourceHolder()");
@@ -168,6 +168,11 @@ namespace Js
 
         static void ReadSourceInfo(const DeferDeserializeFunctionInfo* deferredFunction, int& lineNumber, int& columnNumber, bool& m_isEval, bool& m_isDynamicFunction);
 
+#if ENABLE_DEBUG_CONFIG_OPTIONS
+        // Makes a buffer look like another version of the engine serialized it, so that it is rejected when deserialized
+        static void ChangeMajorVersion(byte * buffer);
+#endif
+
     private:
         static HRESULT DeserializeFromBufferInternal(ScriptContext * scriptContext, uint32 scriptFlags, LPCUTF8 utf8Source, ISourceHolder* sourceHolder, SRCINFO const * srcInfo, byte * buffer, NativeModule *nativeModule, FunctionBody** function, uint sourceIndex = Js::Constants::InvalidSourceIndex);
     };
@@ -10,6 +10,7 @@ namespace Js
 {
     ProbeContainer::ProbeContainer() :
         diagProbeList(nullptr),
+        pendingProbeList(nullptr),
         pScriptContext(nullptr),
         debugManager(nullptr),
         haltCallbackProbe(nullptr),
@@ -25,7 +26,8 @@ namespace Js
         forceBypassDebugEngine(false),
         isPrimaryBrokenToDebuggerContext(false),
         isForcedToEnterScriptStart(false),
-        registeredFuncContextList(nullptr)
+        registeredFuncContextList(nullptr),
+        pinnedPropertyRecords(nullptr)
     {
     }
 
@@ -58,18 +60,24 @@ namespace Js
 
     void ProbeContainer::Initialize(ScriptContext* pScriptContext)
     {
-        if (!diagProbeList)
+        if (!this->pScriptContext)
         {
-            ArenaAllocator* global = pScriptContext->AllocatorForDiagnostics();
+            // The probe lists and the pinned property records are only needed once a probe is added or the debugger
+            // breaks in, so they are allocated on first use; most script contexts are never debugged.
+            this->pScriptContext = pScriptContext;
+            this->debugManager = this->pScriptContext->GetThreadContext()->GetDebugManager();
+        }
+    }
 
-            diagProbeList = ProbeList::New(global);
+    void ProbeContainer::EnsureProbeLists()
+    {
+        if (!diagProbeList)
+        {
+            ArenaAllocator* global = this->pScriptContext->AllocatorForDiagnostics();
 
             pendingProbeList = ProbeList::New(global);
 
-            this->pScriptContext = pScriptContext;
-            this->debugManager = this->pScriptContext->GetThreadContext()->GetDebugManager();
-            this->pinnedPropertyRecords = JsUtil::List<const Js::PropertyRecord*>::New(this->pScriptContext->GetRecycler());
-            this->pScriptContext->BindReference((void *)this->pinnedPropertyRecords);
+            diagProbeList = ProbeList::New(global);
         }
     }
 
@@ -234,7 +242,10 @@ namespace Js
         Assert(debugManager);
         debugManager->UnsetCurrentInterpreterLocation();
 
-        pinnedPropertyRecords->Reset();
+        if (pinnedPropertyRecords)
+        {
+            pinnedPropertyRecords->Reset();
+        }
 
         // Guarding if the probe engine goes away when we are sitting at breakpoint.
         if (haltCallbackProbe)
@@ -537,6 +548,8 @@ namespace Js
 
             if (pHaltState->IsValid())
             {
+                EnsureProbeLists();
+
                 Js::ProbeList * localPendingProbeList = this->pendingProbeList;
                 diagProbeList->Map([pHaltState, localPendingProbeList](int index, Probe * probe)
                 {
@@ -564,7 +577,10 @@ namespace Js
         },
         [&](bool)
         {
-            pendingProbeList->Clear();
+            if (pendingProbeList)
+            {
+                pendingProbeList->Clear();
+            }
             DestroyLocation();
         });
     }
@@ -616,13 +632,14 @@ namespace Js
     {
         if (pProbe->Install(nullptr))
         {
+            EnsureProbeLists();
             diagProbeList->Add(pProbe);
         }
     }
 
     void ProbeContainer::RemoveProbe(Probe* pProbe)
     {
-        if (pProbe->Uninstall(nullptr))
+        if (pProbe->Uninstall(nullptr) && diagProbeList)
         {
             diagProbeList->Remove(pProbe);
         }
@@ -636,6 +653,11 @@ namespace Js
             ClearMutationBreakpoints();
         }
 #endif
+        if (!diagProbeList)
+        {
+            return;
+        }
+
         for (int i = 0; i < diagProbeList->Count(); i++)
         {
             diagProbeList->Item(i)->Uninstall(nullptr);
@@ -1020,6 +1042,11 @@ namespace Js
     void ProbeContainer::PinPropertyRecord(const Js::PropertyRecord *propertyRecord)
     {
         Assert(propertyRecord);
+        if (!this->pinnedPropertyRecords)
+        {
+            this->pinnedPropertyRecords = JsUtil::List<const Js::PropertyRecord*>::New(this->pScriptContext->GetRecycler());
+            this->pScriptContext->BindReference((void *)this->pinnedPropertyRecords);
+        }
         this->pinnedPropertyRecords->Add(propertyRecord);
     }
 #ifdef ENABLE_MUTATION_BREAKPOINT
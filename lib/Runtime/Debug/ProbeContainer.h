@@ -63,6 +63,7 @@ namespace Js
         JsUtil::List<DWORD_PTR, ArenaAllocator> *registeredFuncContextList;
         JsUtil::List<const Js::PropertyRecord*> *pinnedPropertyRecords;
 
+        void EnsureProbeLists();
         void UpdateFramePointers(bool fMatchWithCurrentScriptContext, DWORD_PTR dispatchHaltFrameAddress = 0);
         bool InitializeLocation(InterpreterHaltState* pHaltState, bool fMatchWithCurrentScriptContext = true);
         void DestroyLocation();
@@ -106,13 +107,19 @@ namespace Js
         template<class TMapFunction>
         void MapProbes(TMapFunction map)
         {
-            this->diagProbeList->Map(map);
+            if (this->diagProbeList)
+            {
+                this->diagProbeList->Map(map);
+            }
         }
 
         template<class TMapFunction>
         void MapProbesUntil(TMapFunction map)
         {
-            this->diagProbeList->MapUntil(map);
+            if (this->diagProbeList)
+            {
+                this->diagProbeList->MapUntil(map);
+            }
         }
 
         void RemoveAllProbes();
@@ -607,7 +607,7 @@ namespace TTD
         m_diagnosticLogger(),
 #endif
         m_modeStack(), m_currentMode(TTDMode::Invalid),
-        m_snapExtractor(), m_elapsedExecutionTimeSinceSnapshot(0.0),
+        m_snapExtractor(), m_elapsedExecutionTimeSinceSnapshot(0.0), m_snapshotBudgetInterval(0.0),
         m_lastInflateSnapshotTime(-1), m_lastInflateMap(nullptr), m_propertyRecordList(&this->m_miscSlabAllocator),
         m_loadedTopLevelScripts(&this->m_miscSlabAllocator), m_newFunctionTopLevelScripts(&this->m_miscSlabAllocator), m_evalTopLevelScripts(&this->m_miscSlabAllocator)
     {
@@ -1726,7 +1726,8 @@ namespace TTD
 
     bool EventLog::IsTimeForSnapshot() const
     {
-        return (this->m_elapsedExecutionTimeSinceSnapshot > this->m_threadContext->TTDContext->SnapInterval);
+        return (this->m_elapsedExecutionTimeSinceSnapshot > this->m_threadContext->TTDContext->SnapInterval)
+            && (this->m_elapsedExecutionTimeSinceSnapshot > this->m_snapshotBudgetInterval);
     }
 
     void EventLog::PruneLogLength()
@@ -1771,12 +1772,17 @@ namespace TTD
         this->SetSnapshotOrInflateInProgress(true);
         this->PushMode(TTDMode::ExcludedExecutionTTAction);
 
+        double startTime = this->m_timer.Now();
+
         ///////////////////////////
         //Create the event object and add it to the log
         NSLogEvents::SnapshotEventLogEntry* snapEvent = this->RecordGetInitializedEvent_DataOnly<NSLogEvents::SnapshotEventLogEntry, NSLogEvents::EventKind::SnapshotTag>();
         snapEvent->RestoreTimestamp = this->GetLastEventTime();
         snapEvent->Snap = this->DoSnapshotExtract_Helper();
 
+        //Snapshots of big heaps are expensive so space them out enough that they stay within budget
+        double snapshotTime = this->m_timer.Now() - startTime;
+        this->m_snapshotBudgetInterval = snapshotTime * (100.0 / TTD_SNAPSHOT_TIME_BUDGET_PERCENT);
         this->m_elapsedExecutionTimeSinceSnapshot = 0.0;
 
 #if ENABLE_BASIC_TRACE || ENABLE_FULL_BC_TRACE
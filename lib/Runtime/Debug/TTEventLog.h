@@ -8,6 +8,9 @@
 
 #define TTD_EVENTLOG_LIST_BLOCK_SIZE 4096
 
+//The share of the recorded execution time that taking snapshots may cost (percent) -- expensive snapshots are taken less often
+#define TTD_SNAPSHOT_TIME_BUDGET_PERCENT 5
+
 namespace TTD
 {
     //A class to ensure that even when exceptions are thrown we increment/decrement the root nesting depth
@@ -235,6 +238,9 @@ namespace TTD
         //The execution time that has elapsed since the last snapshot
         double m_elapsedExecutionTimeSinceSnapshot;
 
+        //The execution time to wait after the last snapshot to keep the time spent taking snapshots within budget
+        double m_snapshotBudgetInterval;
+
         //If we are inflating a snapshot multiple times we want to re-use the inflated objects when possible so keep this recent info
         int64 m_lastInflateSnapshotTime;
         InflateMap* m_lastInflateMap;
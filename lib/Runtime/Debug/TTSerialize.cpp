@@ -38,6 +38,370 @@ namespace TTD
         }
     }
 
+    namespace NSCompression
+    {
+        const size_t MinMatchLength = 4;
+        const size_t MaxOffset = 0xFFFF;
+
+        //The last bytes of a block are always literals, which keeps the match copy loops of the decompressor simple
+        const size_t EndLiteralLength = 8;
+
+        static uint32 HashSequence(const byte* src)
+        {
+            uint32 seq;
+            js_memcpy_s(&seq, sizeof(uint32), src, sizeof(uint32));
+
+            return (seq * 2654435761u) >> (32 - HashTableBits);
+        }
+
+        static byte* WriteExtendedLength(byte* dst, const byte* dstEnd, size_t length)
+        {
+            while(length >= 255)
+            {
+                if(dst == dstEnd)
+                {
+                    return nullptr;
+                }
+                *dst++ = 255;
+                length -= 255;
+            }
+
+            if(dst == dstEnd)
+            {
+                return nullptr;
+            }
+            *dst++ = (byte)length;
+            return dst;
+        }
+
+        static byte* WriteSequence(byte* dst, const byte* dstEnd, const byte* literals, size_t literalLength, size_t offset, size_t matchLength)
+        {
+            if(dst == dstEnd)
+            {
+                return nullptr;
+            }
+
+            size_t matchCode = (matchLength != 0) ? (matchLength - MinMatchLength) : 0;
+            byte* token = dst++;
+            *token = (byte)(((literalLength < 15 ? literalLength : 15) << 4) | (matchCode < 15 ? matchCode : 15));
+
+            if(literalLength >= 15)
+            {
+                dst = WriteExtendedLength(dst, dstEnd, literalLength - 15);
+                if(dst == nullptr)
+                {
+                    return nullptr;
+                }
+            }
+
+            if((size_t)(dstEnd - dst) < literalLength)
+            {
+                return nullptr;
+            }
+            js_memcpy_s(dst, dstEnd - dst, literals, literalLength);
+            dst += literalLength;
+
+            if(matchLength != 0)
+            {
+                if(dstEnd - dst < 2)
+                {
+                    return nullptr;
+                }
+                *dst++ = (byte)(offset & 0xFF);
+                *dst++ = (byte)(offset >> 8);
+
+                if(matchCode >= 15)
+                {
+                    dst = WriteExtendedLength(dst, dstEnd, matchCode - 15);
+                }
+            }
+
+            return dst;
+        }
+
+        size_t Compress(const byte* src, size_t srcLength, byte* dst, size_t dstCapacity, uint32* hashTable)
+        {
+            memset(hashTable, 0, HashTableSize * sizeof(uint32));
+
+            const byte* srcEnd = src + srcLength;
+            const byte* matchLimit = (srcLength > EndLiteralLength) ? (srcEnd - EndLiteralLength) : src;
+            byte* dstStart = dst;
+            byte* dstEnd = dst + dstCapacity;
+
+            const byte* literals = src;
+            const byte* curr = src;
+            while(curr + MinMatchLength <= matchLimit)
+            {
+                uint32 hash = HashSequence(curr);
+                const byte* candidate = src + hashTable[hash];
+                hashTable[hash] = (uint32)(curr - src);
+
+                if(candidate >= curr || (size_t)(curr - candidate) > MaxOffset || memcmp(candidate, curr, MinMatchLength) != 0)
+                {
+                    curr++;
+                    continue;
+                }
+
+                size_t matchLength = MinMatchLength;
+                while(curr + matchLength < matchLimit && candidate[matchLength] == curr[matchLength])
+                {
+                    matchLength++;
+                }
+
+                dst = WriteSequence(dst, dstEnd, literals, (size_t)(curr - literals), (size_t)(curr - candidate), matchLength);
+                if(dst == nullptr)
+                {
+                    return 0;
+                }
+
+                curr += matchLength;
+                literals = curr;
+            }
+
+            dst = WriteSequence(dst, dstEnd, literals, (size_t)(srcEnd - literals), 0, 0);
+            if(dst == nullptr || (size_t)(dst - dstStart) >= srcLength)
+            {
+                return 0;
+            }
+
+            return (size_t)(dst - dstStart);
+        }
+
+        static bool ReadExtendedLength(const byte** src, const byte* srcEnd, size_t* length)
+        {
+            byte b;
+            do
+            {
+                if(*src == srcEnd)
+                {
+                    return false;
+                }
+                b = *(*src)++;
+                *length += b;
+            } while(b == 255);
+
+            return true;
+        }
+
+        bool Decompress(const byte* src, size_t srcLength, byte* dst, size_t dstLength)
+        {
+            const byte* srcEnd = src + srcLength;
+            byte* dstStart = dst;
+            byte* dstEnd = dst + dstLength;
+
+            while(src != srcEnd)
+            {
+                byte token = *src++;
+
+                size_t literalLength = (token >> 4);
+                if(literalLength == 15 && !ReadExtendedLength(&src, srcEnd, &literalLength))
+                {
+                    return false;
+                }
+
+                if((size_t)(srcEnd - src) < literalLength || (size_t)(dstEnd - dst) < literalLength)
+                {
+                    return false;
+                }
+                js_memcpy_s(dst, dstEnd - dst, src, literalLength);
+                src += literalLength;
+                dst += literalLength;
+
+                //The last sequence has no match
+                if(src == srcEnd)
+                {
+                    break;
+                }
+
+                if(srcEnd - src < 2)
+                {
+                    return false;
+                }
+                size_t offset = (size_t)src[0] | ((size_t)src[1] << 8);
+                src += 2;
+
+                size_t matchLength = (token & 0xF);
+                if(matchLength == 15 && !ReadExtendedLength(&src, srcEnd, &matchLength))
+                {
+                    return false;
+                }
+                matchLength += MinMatchLength;
+
+                if(offset == 0 || (size_t)(dst - dstStart) < offset || (size_t)(dstEnd - dst) < matchLength)
+                {
+                    return false;
+                }
+
+                //The match may overlap the bytes it produces, so copy it forward a byte at a time
+                const byte* match = dst - offset;
+                for(size_t i = 0; i < matchLength; ++i)
+                {
+                    dst[i] = match[i];
+                }
+                dst += matchLength;
+            }
+
+            return dst == dstEnd;
+        }
+    }
+
+    //////////////////
+
+    AsyncBlockWriter::AsyncBlockWriter(JsTTDStreamHandle handle, TTDWriteBytesToStreamCallback pfWrite)
+        : m_hfile(handle), m_pfWrite(pfWrite), m_ringHead(0), m_ringCount(0), m_isClosing(false),
+        m_ringLock(), m_blockReadyEvent(nullptr), m_blockFreeEvent(nullptr), m_writerThread(nullptr),
+        m_compressedBlock(nullptr), m_hashTable(nullptr)
+    {
+        for(uint32 i = 0; i < RingBlockCount; ++i)
+        {
+            this->m_ringBlocks[i] = TT_HEAP_ALLOC_ARRAY(byte, TTD_SERIALIZATION_BUFFER_SIZE);
+            this->m_ringBlockLengths[i] = 0;
+        }
+
+        this->m_compressedBlock = TT_HEAP_ALLOC_ARRAY(byte, 2 * sizeof(uint32) + NSCompression::GetMaxCompressedSize(TTD_SERIALIZATION_BUFFER_SIZE));
+        this->m_hashTable = TT_HEAP_ALLOC_ARRAY(uint32, NSCompression::HashTableSize);
+
+        this->m_blockReadyEvent = CreateEvent(nullptr, FALSE, FALSE, nullptr);
+        this->m_blockFreeEvent = CreateEvent(nullptr, FALSE, FALSE, nullptr);
+        if(this->m_blockReadyEvent != nullptr && this->m_blockFreeEvent != nullptr)
+        {
+            this->m_writerThread = (HANDLE)PlatformAgnostic::Thread::Create(0, &AsyncBlockWriter::StaticThreadProc, this, PlatformAgnostic::Thread::ThreadInitRunImmediately);
+        }
+    }
+
+    AsyncBlockWriter::~AsyncBlockWriter()
+    {
+        if(this->m_writerThread != nullptr)
+        {
+            {
+                AutoCriticalSection autoLock(&this->m_ringLock);
+                this->m_isClosing = true;
+            }
+            SetEvent(this->m_blockReadyEvent);
+
+            WaitForSingleObject(this->m_writerThread, INFINITE);
+            CloseHandle(this->m_writerThread);
+            this->m_writerThread = nullptr;
+        }
+        TTDAssert(this->m_ringCount == 0, "Blocks were not written!!!");
+
+        if(this->m_blockReadyEvent != nullptr)
+        {
+            CloseHandle(this->m_blockReadyEvent);
+        }
+
+        if(this->m_blockFreeEvent != nullptr)
+        {
+            CloseHandle(this->m_blockFreeEvent);
+        }
+
+        for(uint32 i = 0; i < RingBlockCount; ++i)
+        {
+            TT_HEAP_FREE_ARRAY(byte, this->m_ringBlocks[i], TTD_SERIALIZATION_BUFFER_SIZE);
+        }
+
+        TT_HEAP_FREE_ARRAY(byte, this->m_compressedBlock, 2 * sizeof(uint32) + NSCompression::GetMaxCompressedSize(TTD_SERIALIZATION_BUFFER_SIZE));
+        TT_HEAP_FREE_ARRAY(uint32, this->m_hashTable, NSCompression::HashTableSize);
+    }
+
+    void AsyncBlockWriter::CompressAndWriteBlock(const byte* buff, size_t bufflen)
+    {
+        size_t compressedLength = NSCompression::Compress(buff, bufflen, this->m_compressedBlock + 2 * sizeof(uint32), NSCompression::GetMaxCompressedSize(TTD_SERIALIZATION_BUFFER_SIZE), this->m_hashTable);
+
+        uint32 header[2] = { (uint32)bufflen, (uint32)(compressedLength != 0 ? compressedLength : bufflen) };
+        js_memcpy_s(this->m_compressedBlock, sizeof(header), header, sizeof(header));
+
+        size_t bwp = 0;
+        if(compressedLength != 0)
+        {
+            this->m_pfWrite(this->m_hfile, this->m_compressedBlock, sizeof(header) + compressedLength, &bwp);
+        }
+        else
+        {
+            this->m_pfWrite(this->m_hfile, this->m_compressedBlock, sizeof(header), &bwp);
+            this->m_pfWrite(this->m_hfile, buff, bufflen, &bwp);
+        }
+    }
+
+    unsigned int CALLBACK AsyncBlockWriter::StaticThreadProc(LPVOID lpParameter)
+    {
+        ((AsyncBlockWriter*)lpParameter)->ThreadProc();
+        return 0;
+    }
+
+    void AsyncBlockWriter::ThreadProc()
+    {
+        while(true)
+        {
+            WaitForSingleObject(this->m_blockReadyEvent, INFINITE);
+
+            while(true)
+            {
+                const byte* block = nullptr;
+                size_t blockLength = 0;
+                {
+                    AutoCriticalSection autoLock(&this->m_ringLock);
+                    if(this->m_ringCount == 0)
+                    {
+                        if(this->m_isClosing)
+                        {
+                            return;
+                        }
+                        break;
+                    }
+
+                    block = this->m_ringBlocks[this->m_ringHead];
+                    blockLength = this->m_ringBlockLengths[this->m_ringHead];
+                }
+
+                //The recording thread doesn't touch a block until we give it back
+                this->CompressAndWriteBlock(block, blockLength);
+
+                {
+                    AutoCriticalSection autoLock(&this->m_ringLock);
+                    this->m_ringHead = (this->m_ringHead + 1) % RingBlockCount;
+                    this->m_ringCount--;
+                }
+                SetEvent(this->m_blockFreeEvent);
+            }
+        }
+    }
+
+    void AsyncBlockWriter::WriteBlock(const byte* buff, size_t bufflen)
+    {
+        TTDAssert(bufflen <= TTD_SERIALIZATION_BUFFER_SIZE, "Block is too big!!!");
+
+        if(this->m_writerThread == nullptr)
+        {
+            this->CompressAndWriteBlock(buff, bufflen);
+            return;
+        }
+
+        uint32 tail = 0;
+        while(true)
+        {
+            {
+                AutoCriticalSection autoLock(&this->m_ringLock);
+                if(this->m_ringCount < RingBlockCount)
+                {
+                    tail = (this->m_ringHead + this->m_ringCount) % RingBlockCount;
+                    break;
+                }
+            }
+
+            WaitForSingleObject(this->m_blockFreeEvent, INFINITE);
+        }
+
+        js_memcpy_s(this->m_ringBlocks[tail], TTD_SERIALIZATION_BUFFER_SIZE, buff, bufflen);
+        this->m_ringBlockLengths[tail] = bufflen;
+
+        {
+            AutoCriticalSection autoLock(&this->m_ringLock);
+            this->m_ringCount++;
+        }
+        SetEvent(this->m_blockReadyEvent);
+    }
+
     //////////////////
 
     void FileWriter::WriteBlock(const byte* buff, size_t bufflen)
@@ -45,14 +409,25 @@ namespace TTD
         TTDAssert(bufflen != 0, "Shouldn't be writing empty blocks");
         TTDAssert(this->m_hfile != nullptr, "Trying to write to closed file.");
 
+        if(this->m_asyncWriter != nullptr)
+        {
+            this->m_asyncWriter->WriteBlock(buff, bufflen);
+            return;
+        }
+
         size_t bwp = 0;
         this->m_pfWrite(this->m_hfile, buff, bufflen, &bwp);
     }
 
     FileWriter::FileWriter(JsTTDStreamHandle handle, bool doCompression, TTDWriteBytesToStreamCallback pfWrite, TTDFlushAndCloseStreamCallback pfClose)
-        : m_hfile(handle), m_pfWrite(pfWrite), m_pfClose(pfClose), m_doCompression(doCompression), m_cursor(0), m_buffer(nullptr)
+        : m_hfile(handle), m_pfWrite(pfWrite), m_pfClose(pfClose), m_doCompression(doCompression), m_cursor(0), m_buffer(nullptr), m_asyncWriter(nullptr)
     {
         this->m_buffer = TT_HEAP_ALLOC_ARRAY(byte, TTD_SERIALIZATION_BUFFER_SIZE);
+
+        if(this->m_doCompression && handle != nullptr)
+        {
+            this->m_asyncWriter = TT_HEAP_NEW(AsyncBlockWriter, handle, pfWrite);
+        }
     }
 
     FileWriter::~FileWriter()
@@ -70,6 +445,12 @@ namespace TTD
                 this->m_cursor = 0;
             }
 
+            if(this->m_asyncWriter != nullptr)
+            {
+                TT_HEAP_DELETE(AsyncBlockWriter, this->m_asyncWriter);
+                this->m_asyncWriter = nullptr;
+            }
+
             this->m_pfClose(this->m_hfile, false, true);
             this->m_hfile = nullptr;
         }
@@ -493,25 +874,25 @@ namespace TTD
     void BinaryFormatWriter::WriteNakedInt32(int32 val, NSTokens::Separator separator)
     {
         this->WriteSeperator(separator);
-        this->WriteRawByteBuff_Fixed<int32>(val);
+        this->WriteRawVarInt64(val);
     }
 
     void BinaryFormatWriter::WriteNakedUInt32(uint32 val, NSTokens::Separator separator)
     {
         this->WriteSeperator(separator);
-        this->WriteRawByteBuff_Fixed<uint32>(val);
+        this->WriteRawVarUInt64(val);
     }
 
     void BinaryFormatWriter::WriteNakedInt64(int64 val, NSTokens::Separator separator)
     {
         this->WriteSeperator(separator);
-        this->WriteRawByteBuff_Fixed<int64>(val);
+        this->WriteRawVarInt64(val);
     }
 
     void BinaryFormatWriter::WriteNakedUInt64(uint64 val, NSTokens::Separator separator)
     {
         this->WriteSeperator(separator);
-        this->WriteRawByteBuff_Fixed<uint64>(val);
+        this->WriteRawVarUInt64(val);
     }
 
     void BinaryFormatWriter::WriteNakedDouble(double val, NSTokens::Separator separator)
@@ -523,19 +904,19 @@ namespace TTD
     void BinaryFormatWriter::WriteNakedAddr(TTD_PTR_ID val, NSTokens::Separator separator)
     {
         this->WriteSeperator(separator);
-        this->WriteRawByteBuff_Fixed<TTD_PTR_ID>(val);
+        this->WriteRawVarUInt64(val);
     }
 
     void BinaryFormatWriter::WriteNakedLogTag(TTD_LOG_PTR_ID val, NSTokens::Separator separator)
     {
         this->WriteSeperator(separator);
-        this->WriteRawByteBuff_Fixed<TTD_LOG_PTR_ID>(val);
+        this->WriteRawVarUInt64(val);
     }
 
     void BinaryFormatWriter::WriteNakedTag(uint32 tagvalue, NSTokens::Separator separator)
     {
         this->WriteSeperator(separator);
-        this->WriteRawByteBuff_Fixed<uint32>(tagvalue);
+        this->WriteRawVarUInt64(tagvalue);
     }
 
     void BinaryFormatWriter::WriteNakedString(const TTString& val, NSTokens::Separator separator)
@@ -544,11 +925,11 @@ namespace TTD
 
         if(IsNullPtrTTString(val))
         {
-            this->WriteRawByteBuff_Fixed<uint32>(UINT32_MAX);
+            this->WriteRawVarUInt64(UINT32_MAX);
         }
         else
         {
-            this->WriteRawByteBuff_Fixed<uint32>(val.Length);
+            this->WriteRawVarUInt64(val.Length);
             this->WriteRawByteBuff((const byte*)val.Contents, val.Length * sizeof(char16));
         }
     }
@@ -558,7 +939,7 @@ namespace TTD
         this->WriteSeperator(separator);
 
         uint32 charLen = (uint32)wcslen(val);
-        this->WriteRawByteBuff_Fixed<uint32>(charLen);
+        this->WriteRawVarUInt64(charLen);
         this->WriteRawByteBuff((const byte*)val, charLen * sizeof(char16));
     }
 
@@ -566,26 +947,107 @@ namespace TTD
     {
         this->WriteSeperator(separator);
 
-        this->WriteRawByteBuff_Fixed<uint32>(length);
+        this->WriteRawVarUInt64(length);
         this->WriteRawByteBuff((const byte*)code, length * sizeof(char16));
     }
 
     //////////////////
 
+    size_t FileReader::ReadStreamBytes(byte* buff, size_t size)
+    {
+        size_t readCount = 0;
+        while(readCount < size)
+        {
+            size_t bwp = 0;
+            this->m_pfRead(this->m_hfile, buff + readCount, size - readCount, &bwp);
+            if(bwp == 0)
+            {
+                break;
+            }
+
+            readCount += bwp;
+        }
+
+        return readCount;
+    }
+
+    bool FileReader::ReadCompressedBlock()
+    {
+        uint32 header[2] = { 0, 0 };
+        size_t headerCount = this->ReadStreamBytes((byte*)header, sizeof(header));
+        if(headerCount == 0)
+        {
+            return false;
+        }
+        TTDAssert(headerCount == sizeof(header), "Truncated block header.");
+
+        size_t blockLength = header[0];
+        size_t storedLength = header[1];
+        TTDAssert(blockLength <= TTD_SERIALIZATION_BUFFER_SIZE && storedLength <= blockLength, "Corrupt block header.");
+
+        if(storedLength == blockLength)
+        {
+            size_t readCount = this->ReadStreamBytes(this->m_block, blockLength);
+            TTDAssert(readCount == blockLength, "Truncated block.");
+        }
+        else
+        {
+            size_t readCount = this->ReadStreamBytes(this->m_compressedBlock, storedLength);
+            TTDAssert(readCount == storedLength, "Truncated block.");
+
+            bool success = NSCompression::Decompress(this->m_compressedBlock, storedLength, this->m_block, blockLength);
+            TTDAssert(success, "Corrupt block.");
+        }
+
+        this->m_blockCursor = 0;
+        this->m_blockCount = blockLength;
+
+        return true;
+    }
+
     void FileReader::ReadBlock(byte* buff, size_t* readSize)
     {
         TTDAssert(this->m_hfile != nullptr, "Trying to read a invalid file.");
 
-        size_t bwp = 0;
-        this->m_pfRead(this->m_hfile, buff, TTD_SERIALIZATION_BUFFER_SIZE, &bwp);
+        if(!this->m_doDecompress)
+        {
+            size_t bwp = 0;
+            this->m_pfRead(this->m_hfile, buff, TTD_SERIALIZATION_BUFFER_SIZE, &bwp);
+
+            *readSize = (size_t)bwp;
+            return;
+        }
 
-        *readSize = (size_t)bwp;
+        //The blocks have whatever size the writer flushed, so fill the buffer from as many of them as it takes
+        size_t readCount = 0;
+        while(readCount < TTD_SERIALIZATION_BUFFER_SIZE)
+        {
+            if(this->m_blockCursor == this->m_blockCount && !this->ReadCompressedBlock())
+            {
+                break;
+            }
+
+            size_t copyCount = min(TTD_SERIALIZATION_BUFFER_SIZE - readCount, this->m_blockCount - this->m_blockCursor);
+            js_memcpy_s(buff + readCount, TTD_SERIALIZATION_BUFFER_SIZE - readCount, this->m_block + this->m_blockCursor, copyCount);
+
+            readCount += copyCount;
+            this->m_blockCursor += copyCount;
+        }
+
+        *readSize = readCount;
     }
 
     FileReader::FileReader(JsTTDStreamHandle handle, bool doDecompress, TTDReadBytesFromStreamCallback pfRead, TTDFlushAndCloseStreamCallback pfClose)
-        : m_hfile(handle), m_pfRead(pfRead), m_pfClose(pfClose), m_peekChar(-1), m_doDecompress(doDecompress), m_cursor(0), m_buffCount(0), m_buffer(nullptr)
+        : m_hfile(handle), m_pfRead(pfRead), m_pfClose(pfClose), m_peekChar(-1), m_doDecompress(doDecompress), m_cursor(0), m_buffCount(0), m_buffer(nullptr),
+        m_block(nullptr), m_blockCursor(0), m_blockCount(0), m_compressedBlock(nullptr)
     {
         this->m_buffer = TT_HEAP_ALLOC_ARRAY(byte, TTD_SERIALIZATION_BUFFER_SIZE);
+
+        if(this->m_doDecompress)
+        {
+            this->m_block = TT_HEAP_ALLOC_ARRAY(byte, TTD_SERIALIZATION_BUFFER_SIZE);
+            this->m_compressedBlock = TT_HEAP_ALLOC_ARRAY(byte, TTD_SERIALIZATION_BUFFER_SIZE);
+        }
     }
 
     FileReader::~FileReader()
@@ -601,6 +1063,18 @@ namespace TTD
             TT_HEAP_FREE_ARRAY(byte, this->m_buffer, TTD_SERIALIZATION_BUFFER_SIZE);
             this->m_buffer = nullptr;
         }
+
+        if(this->m_block != nullptr)
+        {
+            TT_HEAP_FREE_ARRAY(byte, this->m_block, TTD_SERIALIZATION_BUFFER_SIZE);
+            this->m_block = nullptr;
+        }
+
+        if(this->m_compressedBlock != nullptr)
+        {
+            TT_HEAP_FREE_ARRAY(byte, this->m_compressedBlock, TTD_SERIALIZATION_BUFFER_SIZE);
+            this->m_compressedBlock = nullptr;
+        }
     }
 
     uint32 FileReader::ReadLengthValue(bool readSeparator)
@@ -1540,40 +2014,28 @@ namespace TTD
     {
         this->ReadSeperator(readSeparator);
 
-        int32 i;
-        this->ReadBytesInto_Fixed<int32>(i);
-
-        return i;
+        return (int32)this->ReadRawVarInt64();
     }
 
     uint32 BinaryFormatReader::ReadNakedUInt32(bool readSeparator)
     {
         this->ReadSeperator(readSeparator);
 
-        uint32 i;
-        this->ReadBytesInto_Fixed<uint32>(i);
-
-        return i;
+        return (uint32)this->ReadRawVarUInt64();
     }
 
     int64 BinaryFormatReader::ReadNakedInt64(bool readSeparator)
     {
         this->ReadSeperator(readSeparator);
 
-        int64 i;
-        this->ReadBytesInto_Fixed<int64>(i);
-
-        return i;
+        return this->ReadRawVarInt64();
     }
 
     uint64 BinaryFormatReader::ReadNakedUInt64(bool readSeparator)
     {
         this->ReadSeperator(readSeparator);
 
-        uint64 i;
-        this->ReadBytesInto_Fixed<uint64>(i);
-
-        return i;
+        return this->ReadRawVarUInt64();
     }
 
     double BinaryFormatReader::ReadNakedDouble(bool readSeparator)
@@ -1590,38 +2052,28 @@ namespace TTD
     {
         this->ReadSeperator(readSeparator);
 
-        TTD_PTR_ID addr;
-        this->ReadBytesInto_Fixed<TTD_PTR_ID>(addr);
-
-        return addr;
+        return (TTD_PTR_ID)this->ReadRawVarUInt64();
     }
 
     TTD_LOG_PTR_ID BinaryFormatReader::ReadNakedLogTag(bool readSeparator)
     {
         this->ReadSeperator(readSeparator);
 
-        TTD_LOG_PTR_ID tag;
-        this->ReadBytesInto_Fixed<TTD_LOG_PTR_ID>(tag);
-
-        return tag;
+        return (TTD_LOG_PTR_ID)this->ReadRawVarUInt64();
     }
 
     uint32 BinaryFormatReader::ReadNakedTag(bool readSeparator)
     {
         this->ReadSeperator(readSeparator);
 
-        uint32 tag;
-        this->ReadBytesInto_Fixed<uint32>(tag);
-
-        return tag;
+        return (uint32)this->ReadRawVarUInt64();
     }
 
     void BinaryFormatReader::ReadNakedString(SlabAllocator& alloc, TTString& into, bool readSeparator)
     {
         this->ReadSeperator(readSeparator);
 
-        uint32 sizeField;
-        this->ReadBytesInto_Fixed<uint32>(sizeField);
+        uint32 sizeField = (uint32)this->ReadRawVarUInt64();
 
         if(sizeField == UINT32_MAX)
         {
@@ -1638,8 +2090,7 @@ namespace TTD
     {
         this->ReadSeperator(readSeparator);
 
-        uint32 sizeField;
-        this->ReadBytesInto_Fixed<uint32>(sizeField);
+        uint32 sizeField = (uint32)this->ReadRawVarUInt64();
 
         if(sizeField == UINT32_MAX)
         {
@@ -1656,8 +2107,7 @@ namespace TTD
     {
         this->ReadSeperator(readSeparator);
 
-        uint32 charLen;
-        this->ReadBytesInto_Fixed<uint32>(charLen);
+        uint32 charLen = (uint32)this->ReadRawVarUInt64();
 
         char16* cbuff = alloc.SlabAllocateArray<char16>(charLen + 1);
         this->ReadBytesInto((byte*)cbuff, charLen * sizeof(char16));
@@ -1670,8 +2120,7 @@ namespace TTD
     {
         this->ReadSeperator(readSeparator);
 
-        uint32 charLen;
-        this->ReadBytesInto_Fixed<uint32>(charLen);
+        uint32 charLen = (uint32)this->ReadRawVarUInt64();
 
         char16* cbuff = alloc.SlabAllocateArray<char16>(charLen + 1);
         this->ReadBytesInto((byte*)cbuff, charLen * sizeof(char16));
@@ -1682,8 +2131,7 @@ namespace TTD
 
     void BinaryFormatReader::ReadInlineCode(_Out_writes_(length) char16* code, uint32 length, bool readSeparator)
     {
-        uint32 wlen = 0;
-        this->ReadBytesInto_Fixed<uint32>(wlen);
+        uint32 wlen = (uint32)this->ReadRawVarUInt64();
         TTDAssert(wlen == length, "Not exepcted string length!!!");
 
         this->ReadBytesInto((byte*)code, length * sizeof(char16));
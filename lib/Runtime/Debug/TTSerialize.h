@@ -74,6 +74,71 @@ namespace TTD
         void CleanupKeyNamesArray(const char16*** names, size_t** lengths);
     }
 
+    namespace NSCompression
+    {
+        //Hash table used by the compressor to find earlier occurrences of the next 4 bytes
+        const uint32 HashTableBits = 12;
+        const uint32 HashTableSize = (1 << HashTableBits);
+
+        //The worst case size of a compressed block -- incompressible data only grows by its literal run lengths
+        inline size_t GetMaxCompressedSize(size_t length)
+        {
+            return length + (length / 255) + 16;
+        }
+
+        //LZ77 compression with an LZ4 style sequence layout (literal and match lengths in a token byte, 16 bit offsets)
+        //Returns the compressed size, or 0 if the result would not be smaller than the input
+        size_t Compress(const byte* src, size_t srcLength, byte* dst, size_t dstCapacity, uint32* hashTable);
+
+        //Returns false if the data is corrupt or does not decompress to exactly dstLength bytes
+        bool Decompress(const byte* src, size_t srcLength, byte* dst, size_t dstLength);
+    }
+
+    //Compresses the blocks of a FileWriter and writes them to its stream on a background thread.
+    //The blocks are handed over through a small ring of buffers, so the recording thread only waits when it gets a whole
+    //ring ahead of the writer thread. If the thread can't be created the blocks are compressed and written synchronously.
+    //
+    //Each block is written as its uncompressed length and stored length (uint32 each) followed by the stored bytes, which
+    //are the block itself when it doesn't compress.
+    class AsyncBlockWriter
+    {
+    private:
+        static const uint32 RingBlockCount = 3;
+
+        JsTTDStreamHandle m_hfile;
+        TTDWriteBytesToStreamCallback m_pfWrite;
+
+        //The ring of blocks waiting to be written -- only the counts are shared with the writer thread and they are guarded by the lock
+        byte* m_ringBlocks[RingBlockCount];
+        size_t m_ringBlockLengths[RingBlockCount];
+        uint32 m_ringHead;
+        uint32 m_ringCount;
+        bool m_isClosing;
+
+        CriticalSection m_ringLock;
+        HANDLE m_blockReadyEvent;
+        HANDLE m_blockFreeEvent;
+        HANDLE m_writerThread;
+
+        //Owned by the thread compressing the blocks
+        byte* m_compressedBlock;
+        uint32* m_hashTable;
+
+        void CompressAndWriteBlock(const byte* buff, size_t bufflen);
+
+        static unsigned int CALLBACK StaticThreadProc(LPVOID lpParameter);
+        void ThreadProc();
+
+    public:
+        AsyncBlockWriter(JsTTDStreamHandle handle, TTDWriteBytesToStreamCallback pfWrite);
+
+        //Waits for all the blocks to be written
+        ~AsyncBlockWriter();
+
+        //Copies the block (at most TTD_SERIALIZATION_BUFFER_SIZE bytes) into the ring
+        void WriteBlock(const byte* buff, size_t bufflen);
+    };
+
     ////
 
     //A virtual class that handles the actual write (and format) of a value to a stream
@@ -89,6 +154,9 @@ namespace TTD
         size_t m_cursor;
         byte* m_buffer;
 
+        //Does the writes to the stream when we compress
+        AsyncBlockWriter* m_asyncWriter;
+
         //flush the buffer contents to disk
         void WriteBlock(const byte* buff, size_t bufflen);
 
@@ -168,6 +236,28 @@ namespace TTD
             this->WriteRawByteBuff_Fixed<char16>(c);
         }
 
+        //Write an integer in 7 bit groups, low group first, with the high bit set on all but the last byte
+        void WriteRawVarUInt64(uint64 val)
+        {
+            byte* trgt = this->ReserveSpaceForSmallData<10>();
+
+            size_t used = 0;
+            while(val >= 0x80)
+            {
+                trgt[used++] = (byte)(val | 0x80);
+                val >>= 7;
+            }
+            trgt[used++] = (byte)val;
+
+            this->CommitSpaceForSmallData(used);
+        }
+
+        //Zig-zag encode so small negative values are short too
+        void WriteRawVarInt64(int64 val)
+        {
+            this->WriteRawVarUInt64(((uint64)val << 1) ^ (uint64)(val >> 63));
+        }
+
         template <size_t N, typename T>
         void WriteFormattedCharData(const char16(&formatString)[N], T data)
         {
@@ -370,6 +460,15 @@ namespace TTD
         size_t m_buffCount;
         byte* m_buffer;
 
+        //The decompressed contents of the current block of a compressed stream (see AsyncBlockWriter)
+        byte* m_block;
+        size_t m_blockCursor;
+        size_t m_blockCount;
+        byte* m_compressedBlock;
+
+        size_t ReadStreamBytes(byte* buff, size_t size);
+        bool ReadCompressedBlock();
+
         void ReadBlock(byte* buff, size_t* readSize);
 
     protected:
@@ -447,6 +546,30 @@ namespace TTD
             }
         }
 
+        uint64 ReadRawVarUInt64()
+        {
+            uint64 val = 0;
+            for(uint32 shift = 0; ; shift += 7)
+            {
+                TTDAssert(shift < 64, "Malformed variable length integer.");
+
+                byte b;
+                this->ReadBytesInto_Fixed<byte>(b);
+
+                val |= ((uint64)(b & 0x7F) << shift);
+                if((b & 0x80) == 0)
+                {
+                    return val;
+                }
+            }
+        }
+
+        int64 ReadRawVarInt64()
+        {
+            uint64 val = this->ReadRawVarUInt64();
+            return (int64)((val >> 1) ^ (0 - (val & 1)));
+        }
+
         bool PeekRawChar(char16* c)
         {
             if(this->m_peekChar != -1)
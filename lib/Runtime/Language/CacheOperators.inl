@@ -105,7 +105,20 @@ namespace Js
                     ReturnOperationInfo ? operationInfo : nullptr,
                     propertyValueInfo))
         {
-            return false;
+            // Types seen by megamorphic sites are also cached per thread, try that before the slow lookup
+            MegamorphicPropertyCache *const megamorphicPropertyCache = requestContext->GetThreadContext()->GetMegamorphicPropertyCache();
+            if(!megamorphicPropertyCache ||
+                !megamorphicPropertyCache->TryGetProperty(
+                        CheckMissing,
+                        object,
+                        propertyId,
+                        propertyValue,
+                        requestContext,
+                        ReturnOperationInfo ? operationInfo : nullptr,
+                        propertyValueInfo))
+            {
+                return false;
+            }
         }
 
         if(!ReturnOperationInfo || operationInfo->cacheType == CacheType_TypeProperty)
@@ -217,7 +230,18 @@ namespace Js
                 ReturnOperationInfo ? operationInfo : nullptr,
                 propertyValueInfo))
         {
-            return false;
+            MegamorphicPropertyCache *const megamorphicPropertyCache = requestContext->GetThreadContext()->GetMegamorphicPropertyCache();
+            if(!megamorphicPropertyCache ||
+                !megamorphicPropertyCache->TrySetProperty(
+                    object,
+                    propertyId,
+                    propertyValue,
+                    requestContext,
+                    ReturnOperationInfo ? operationInfo : nullptr,
+                    propertyValueInfo))
+            {
+                return false;
+            }
         }
 
         if(!ReturnOperationInfo || operationInfo->cacheType == CacheType_TypeProperty)
@@ -364,6 +388,7 @@ namespace Js
 
         const bool includeTypePropertyCache = IncludeTypePropertyCache && !isRoot;
         bool createTypePropertyCache = false;
+        bool cacheMegamorphic = false;
         PolymorphicInlineCache *polymorphicInlineCache = info->GetPolymorphicInlineCache();
         if(!polymorphicInlineCache && info->GetFunctionBody())
         {
@@ -445,6 +470,11 @@ namespace Js
                             info->GetInlineCacheIndex(),
                             propertyId);
                 }
+                else
+                {
+                    // The site has seen more types than its polymorphic inline cache can hold
+                    cacheMegamorphic = !PHASE_OFF1(MegamorphicPropertyCachePhase);
+                }
                 if(includeTypePropertyCache)
                 {
                     createTypePropertyCache = true;
@@ -496,6 +526,32 @@ namespace Js
         }
         Assert(!IsAccessor);
 
+        if(cacheMegamorphic)
+        {
+            MegamorphicPropertyCache *const megamorphicPropertyCache =
+                requestContext->GetThreadContext()->EnsureMegamorphicPropertyCache();
+            if(isProto)
+            {
+                megamorphicPropertyCache->Cache(
+                    type,
+                    propertyId,
+                    propertyIndex,
+                    isInlineSlot,
+                    info->IsWritable() && info->IsStoreFieldCacheEnabled(),
+                    isMissing,
+                    objectWithProperty);
+            }
+            else
+            {
+                megamorphicPropertyCache->Cache(
+                    type,
+                    propertyId,
+                    propertyIndex,
+                    isInlineSlot,
+                    info->IsWritable() && info->IsStoreFieldCacheEnabled());
+            }
+        }
+
         TypePropertyCache *typePropertyCache = type->GetPropertyCache();
         if(!typePropertyCache)
         {
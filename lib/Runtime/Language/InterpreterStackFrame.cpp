@@ -35,12 +35,17 @@
 /// additional indirection would slow the main interpreter loop further by
 /// preventing the main 'switch' statement from using the OpCode to become a
 /// direct local-function jump.
+///
+/// Each handler is tagged with PROCESS_OPCODE_LABEL and finishes with
+/// PROCESS_NEXT_OPCODE. By default these expand to nothing and 'break', but
+/// the main loop in InterpreterLoop.inl may redefine them so that every
+/// handler fetches and dispatches the next OpCode itself (direct threading).
 ///----------------------------------------------------------------------------
 
 #define PROCESS_FALLTHROUGH(name, func) \
-    case OpCode::name:
+    case OpCode::name: PROCESS_OPCODE_LABEL(name)
 #define PROCESS_FALLTHROUGH_COMMON(name, func, suffix) \
-    case OpCode::name:
+    case OpCode::name: PROCESS_OPCODE_LABEL(name)
 
 #define PROCESS_READ_LAYOUT(name, layout, suffix) \
     CompileAssert(OpCodeInfo<OpCode::name>::Layout == OpLayoutType::layout); \
@@ -49,30 +54,30 @@
 
 
 #define PROCESS_NOP_COMMON(name, layout, suffix) \
-    case OpCode::name: \
+    case OpCode::name: PROCESS_OPCODE_LABEL(name) \
     { \
         PROCESS_READ_LAYOUT(name, layout, suffix); \
-        break; \
+        PROCESS_NEXT_OPCODE(); \
     }
 
 #define PROCESS_NOP(name, layout) PROCESS_NOP_COMMON(name, layout,)
 
 #define PROCESS_CUSTOM_COMMON(name, func, layout, suffix) \
-    case OpCode::name: \
+    case OpCode::name: PROCESS_OPCODE_LABEL(name) \
     { \
         PROCESS_READ_LAYOUT(name, layout, suffix); \
         func(playout); \
-        break; \
+        PROCESS_NEXT_OPCODE(); \
     }
 
 #define PROCESS_CUSTOM(name, func, layout) PROCESS_CUSTOM_COMMON(name, func, layout,)
 
 #define PROCESS_CUSTOM_L_COMMON(name, func, layout, regslot, suffix) \
-    case OpCode::name: \
+    case OpCode::name: PROCESS_OPCODE_LABEL(name) \
     { \
         PROCESS_READ_LAYOUT(name, layout, suffix); \
         func(playout); \
-        break; \
+        PROCESS_NEXT_OPCODE(); \
     }
 
 #define PROCESS_CUSTOM_L(name, func, layout, regslot) PROCESS_CUSTOM_L_COMMON(name, func, layout, regslot,)
@@ -91,48 +96,48 @@
 #define PROCESS_CUSTOM_L_Value(name, func, layout) PROCESS_CUSTOM_L_COMMON(name, func, layout, Value,)
 
 #define PROCESS_TRY(name, func) \
-    case OpCode::name: \
+    case OpCode::name: PROCESS_OPCODE_LABEL(name) \
     { \
         PROCESS_READ_LAYOUT(name, Br,); \
         func(playout); \
         ip = m_reader.GetIP(); \
-        break; \
+        PROCESS_NEXT_OPCODE(); \
     }
 
 #define PROCESS_EMPTY(name, func) \
-    case OpCode::name: \
+    case OpCode::name: PROCESS_OPCODE_LABEL(name) \
     { \
         PROCESS_READ_LAYOUT(name, Empty, ); \
         func(); \
         ip = m_reader.GetIP(); \
-        break; \
+        PROCESS_NEXT_OPCODE(); \
     }
 
 #define PROCESS_TRYBR2_COMMON(name, func, suffix) \
-    case OpCode::name: \
+    case OpCode::name: PROCESS_OPCODE_LABEL(name) \
     { \
         PROCESS_READ_LAYOUT(name, BrReg2, suffix); \
         func((const byte*)(playout + 1), playout->RelativeJumpOffset, playout->R1, playout->R2); \
         ip = m_reader.GetIP(); \
-        break; \
+        PROCESS_NEXT_OPCODE(); \
     }
 
 #define PROCESS_CALL_COMMON(name, func, layout, suffix) \
-    case OpCode::name: \
+    case OpCode::name: PROCESS_OPCODE_LABEL(name) \
     { \
         PROCESS_READ_LAYOUT(name, layout, suffix); \
         func(playout); \
-        break; \
+        PROCESS_NEXT_OPCODE(); \
     }
 
 #define PROCESS_CALL(name, func, layout) PROCESS_CALL_COMMON(name, func, layout,)
 
 #define PROCESS_CALL_FLAGS_COMMON(name, func, layout, flags, suffix) \
-    case OpCode::name: \
+    case OpCode::name: PROCESS_OPCODE_LABEL(name) \
     { \
         PROCESS_READ_LAYOUT(name, layout, suffix); \
         func(playout, flags); \
-        break; \
+        PROCESS_NEXT_OPCODE(); \
     }
 
 #define PROCESS_CALL_FLAGS(name, func, layout, regslot) PROCESS_CALL_FLAGS_COMMON(name, func, layout, regslot,)
@@ -147,469 +152,469 @@
 #define PROCESS_CALL_FLAGS_CallEval(name, func, layout) PROCESS_CALL_FLAGS_COMMON(name, func, layout, CallFlags_ExtraArg,)
 
 #define PROCESS_A1toXX_ALLOW_STACK_COMMON(name, func, suffix) \
-    case OpCode::name: \
+    case OpCode::name: PROCESS_OPCODE_LABEL(name) \
     { \
         PROCESS_READ_LAYOUT(name, Reg1, suffix); \
         func(GetRegAllowStackVar(playout->R0)); \
-        break; \
+        PROCESS_NEXT_OPCODE(); \
     }
 
 #define PROCESS_A1toXX_COMMON(name, func, suffix) \
-    case OpCode::name: \
+    case OpCode::name: PROCESS_OPCODE_LABEL(name) \
     { \
         PROCESS_READ_LAYOUT(name, Reg1, suffix); \
         func(GetReg(playout->R0)); \
-        break; \
+        PROCESS_NEXT_OPCODE(); \
     }
 
 #define PROCESS_A1toXX(name, func) PROCESS_A1toXX_COMMON(name, func,)
 
 #define PROCESS_A1toXXMem_COMMON(name, func, suffix) \
-    case OpCode::name: \
+    case OpCode::name: PROCESS_OPCODE_LABEL(name) \
     { \
         PROCESS_READ_LAYOUT(name, Reg1, suffix); \
         func(GetReg(playout->R0), GetScriptContext()); \
-        break; \
+        PROCESS_NEXT_OPCODE(); \
     }
 
 #define PROCESS_A1toXXMem(name, func) PROCESS_A1toXXMem_COMMON(name, func,)
 
 #define PROCESS_A1toXXMemNonVar_COMMON(name, func, type, suffix) \
-    case OpCode::name: \
+    case OpCode::name: PROCESS_OPCODE_LABEL(name) \
     { \
         PROCESS_READ_LAYOUT(name, Reg1, suffix); \
         func((type)GetNonVarReg(playout->R0), GetScriptContext()); \
-        break; \
+        PROCESS_NEXT_OPCODE(); \
     }
 
 #define PROCESS_A1toXXMemNonVar(name, func, type) PROCESS_A1toXXMemNonVar_COMMON(name, func, type,)
 
 #define PROCESS_XXtoA1_COMMON(name, func, suffix) \
-    case OpCode::name: \
+    case OpCode::name: PROCESS_OPCODE_LABEL(name) \
     { \
         PROCESS_READ_LAYOUT(name, Reg1, suffix); \
         SetReg(playout->R0, \
                 func()); \
-        break; \
+        PROCESS_NEXT_OPCODE(); \
     }
 
 #define PROCESS_XXtoA1(name, func) PROCESS_XXtoA1_COMMON(name, func,)
 
 #define PROCESS_XXtoA1NonVar_COMMON(name, func, suffix) \
-    case OpCode::name: \
+    case OpCode::name: PROCESS_OPCODE_LABEL(name) \
     { \
         PROCESS_READ_LAYOUT(name, Reg1, suffix); \
         SetNonVarReg(playout->R0, \
                 func()); \
-        break; \
+        PROCESS_NEXT_OPCODE(); \
     }
 
 #define PROCESS_XXtoA1NonVar(name, func) PROCESS_XXtoA1NonVar_COMMON(name, func,)
 
 #define PROCESS_XXtoA1Mem_COMMON(name, func, suffix) \
-    case OpCode::name: \
+    case OpCode::name: PROCESS_OPCODE_LABEL(name) \
     { \
         PROCESS_READ_LAYOUT(name, Reg1, suffix); \
         SetReg(playout->R0, \
                 func(GetScriptContext())); \
-        break; \
+        PROCESS_NEXT_OPCODE(); \
     }
 
 #define PROCESS_XXtoA1Mem(name, func) PROCESS_XXtoA1Mem_COMMON(name, func,)
 
 #define PROCESS_A1toA1_ALLOW_STACK_COMMON(name, func, suffix) \
-    case OpCode::name: \
+    case OpCode::name: PROCESS_OPCODE_LABEL(name) \
     { \
         PROCESS_READ_LAYOUT(name, Reg2, suffix); \
         SetRegAllowStackVar(playout->R0, \
                 func(GetRegAllowStackVar(playout->R1))); \
-        break; \
+        PROCESS_NEXT_OPCODE(); \
     }
 
 #define PROCESS_A1toA1_ALLOW_STACK(name, func) PROCESS_A1toA1_ALLOW_STACK_COMMON(name, func,)
 
 #define PROCESS_A1toA1_COMMON(name, func, suffix) \
-    case OpCode::name: \
+    case OpCode::name: PROCESS_OPCODE_LABEL(name) \
     { \
         PROCESS_READ_LAYOUT(name, Reg2, suffix); \
         SetReg(playout->R0, \
                 func(GetReg(playout->R1))); \
-        break; \
+        PROCESS_NEXT_OPCODE(); \
     }
 
 #define PROCESS_A1toA1(name, func) PROCESS_A1toA1_COMMON(name, func,)
 
 
 #define PROCESS_A1toA1Profiled_COMMON(name, func, suffix) \
-    case OpCode::name: \
+    case OpCode::name: PROCESS_OPCODE_LABEL(name) \
     { \
         PROCESS_READ_LAYOUT(name, ProfiledReg2, suffix); \
         SetReg(playout->R0, \
                 func(GetReg(playout->R1), playout->profileId)); \
-        break; \
+        PROCESS_NEXT_OPCODE(); \
     }
 
 #define PROCESS_A1toA1Profiled(name, func) PROCESS_A1toA1Profiled_COMMON(name, func,)
 
 #define PROCESS_A1toA1CallNoArg_COMMON(name, func, layout, suffix) \
-    case OpCode::name: \
+    case OpCode::name: PROCESS_OPCODE_LABEL(name) \
     { \
         PROCESS_READ_LAYOUT(name, layout, suffix); \
         SetReg(playout->R0, \
                 func(playout)); \
-        break; \
+        PROCESS_NEXT_OPCODE(); \
     }
 
 #define PROCESS_A1toA1CallNoArg(name, func, layout) PROCESS_A1toA1CallNoArg_COMMON(name, func, layout,)
 
 #define PROCESS_A1toA1Mem_COMMON(name, func, suffix) \
-    case OpCode::name: \
+    case OpCode::name: PROCESS_OPCODE_LABEL(name) \
     { \
         PROCESS_READ_LAYOUT(name, Reg2, suffix); \
         SetReg(playout->R0, \
                 func(GetReg(playout->R1),GetScriptContext())); \
-        break; \
+        PROCESS_NEXT_OPCODE(); \
     }
 
 #define PROCESS_A1toA1Mem(name, func) PROCESS_A1toA1Mem_COMMON(name, func,)
 
 #define PROCESS_A1toA1NonVar_COMMON(name, func, suffix) \
-    case OpCode::name: \
+    case OpCode::name: PROCESS_OPCODE_LABEL(name) \
     { \
         PROCESS_READ_LAYOUT(name, Reg2, suffix); \
         SetNonVarReg(playout->R0, \
                 func(GetNonVarReg(playout->R1))); \
-        break; \
+        PROCESS_NEXT_OPCODE(); \
     }
 
 #define PROCESS_A1toA1NonVar(name, func) PROCESS_A1toA1NonVar_COMMON(name, func,)
 
 #define PROCESS_A1toA1MemNonVar_COMMON(name, func, suffix) \
-    case OpCode::name: \
+    case OpCode::name: PROCESS_OPCODE_LABEL(name) \
     { \
         PROCESS_READ_LAYOUT(name, Reg2, suffix); \
         SetNonVarReg(playout->R0, \
                 func(GetNonVarReg(playout->R1),GetScriptContext())); \
-        break; \
+        PROCESS_NEXT_OPCODE(); \
     }
 
 #define PROCESS_A1toA1MemNonVar(name, func) PROCESS_A1toA1MemNonVar_COMMON(name, func,)
 
 #define PROCESS_INNERtoA1_COMMON(name, func, suffix) \
-    case OpCode::name: \
+    case OpCode::name: PROCESS_OPCODE_LABEL(name) \
     { \
         PROCESS_READ_LAYOUT(name, Reg1Unsigned1, suffix); \
         SetReg(playout->R0, InnerScopeFromIndex(playout->C1)); \
-        break; \
+        PROCESS_NEXT_OPCODE(); \
     }
 
 #define PROCESS_INNERtoA1(name, fun) PROCESS_INNERtoA1_COMMON(name, func,)
 
 #define PROCESS_U1toINNERMemNonVar_COMMON(name, func, suffix) \
-    case OpCode::name: \
+    case OpCode::name: PROCESS_OPCODE_LABEL(name) \
     { \
         PROCESS_READ_LAYOUT(name, Unsigned1, suffix); \
         SetInnerScopeFromIndex(playout->C1, func(GetScriptContext())); \
-        break; \
+        PROCESS_NEXT_OPCODE(); \
     }
 
 #define PROCESS_U1toINNERMemNonVar(name, func) PROCESS_U1toINNERMemNonVar_COMMON(name, func,)
 
 #define PROCESS_XXINNERtoA1MemNonVar_COMMON(name, func, suffix) \
-    case OpCode::name: \
+    case OpCode::name: PROCESS_OPCODE_LABEL(name) \
     { \
         PROCESS_READ_LAYOUT(name, Reg1Unsigned1, suffix); \
         SetNonVarReg(playout->R0, \
                 func(InnerScopeFromIndex(playout->C1), GetScriptContext())); \
-        break; \
+        PROCESS_NEXT_OPCODE(); \
     }
 
 #define PROCESS_XXINNERtoA1MemNonVar(name, func) PROCESS_XXINNERtoA1MemNonVar_COMMON(name, func,)
 
 #define PROCESS_A1INNERtoA1MemNonVar_COMMON(name, func, suffix) \
-    case OpCode::name: \
+    case OpCode::name: PROCESS_OPCODE_LABEL(name) \
     { \
         PROCESS_READ_LAYOUT(name, Reg2Int1, suffix); \
         SetNonVarReg(playout->R0, \
                 func(InnerScopeFromIndex(playout->C1), GetNonVarReg(playout->R1), GetScriptContext())); \
-        break; \
+        PROCESS_NEXT_OPCODE(); \
     }
 
 #define PROCESS_A1LOCALtoA1MemNonVar(name, func) PROCESS_A1LOCALtoA1MemNonVar_COMMON(name, func,)
 
 #define PROCESS_LOCALI1toA1_COMMON(name, func, suffix) \
-    case OpCode::name: \
+    case OpCode::name: PROCESS_OPCODE_LABEL(name) \
     { \
         PROCESS_READ_LAYOUT(name, Reg1Unsigned1, suffix); \
         SetReg(playout->R0, \
                 func(this->localClosure, playout->C1)); \
-        break; \
+        PROCESS_NEXT_OPCODE(); \
     }
 
 #define PROCESS_LOCALI1toA1(name, func) PROCESS_LOCALI1toA1_COMMON(name, func,)
 
 #define PROCESS_A1I1toA1_COMMON(name, func, suffix) \
-    case OpCode::name: \
+    case OpCode::name: PROCESS_OPCODE_LABEL(name) \
     { \
         PROCESS_READ_LAYOUT(name, Reg2Int1, suffix); \
         SetReg(playout->R0, \
                 func(GetReg(playout->R1), playout->C1)); \
-        break; \
+        PROCESS_NEXT_OPCODE(); \
     }
 
 #define PROCESS_A1I1toA1(name, func) PROCESS_A1I1toA1_COMMON(name, func,)
 
 #define PROCESS_A1I1toA1Mem_COMMON(name, func, suffix) \
-    case OpCode::name: \
+    case OpCode::name: PROCESS_OPCODE_LABEL(name) \
     { \
         PROCESS_READ_LAYOUT(name, Reg2Int1, suffix); \
         SetReg(playout->R0, \
                 func(GetReg(playout->R1), playout->C1, GetScriptContext())); \
-        break; \
+        PROCESS_NEXT_OPCODE(); \
     }
 
 #define PROCESS_A1I1toA1Mem(name, func) PROCESS_A1I1toA1Mem_COMMON(name, func,)
 
 #define PROCESS_RegextoA1_COMMON(name, func, suffix) \
-    case OpCode::name: \
+    case OpCode::name: PROCESS_OPCODE_LABEL(name) \
     { \
         PROCESS_READ_LAYOUT(name, Reg1Unsigned1, suffix); \
         SetReg(playout->R0, \
                 func(this->m_functionBody->GetLiteralRegex(playout->C1), GetScriptContext())); \
-        break; \
+        PROCESS_NEXT_OPCODE(); \
     }
 
 #define PROCESS_RegextoA1(name, func) PROCESS_RegextoA1_COMMON(name, func,)
 
 #define PROCESS_A2toXX_COMMON(name, func, suffix) \
-    case OpCode::name: \
+    case OpCode::name: PROCESS_OPCODE_LABEL(name) \
     { \
         PROCESS_READ_LAYOUT(name, Reg2, suffix); \
         func(GetReg(playout->R0), GetReg(playout->R1)); \
-        break; \
+        PROCESS_NEXT_OPCODE(); \
     }
 
 #define PROCESS_A2toXX(name, func) PROCESS_A2toXX_COMMON(name, func,)
 
 #define PROCESS_A2toXXMemNonVar_COMMON(name, func, suffix) \
-    case OpCode::name: \
+    case OpCode::name: PROCESS_OPCODE_LABEL(name) \
     { \
         PROCESS_READ_LAYOUT(name, Reg2, suffix); \
         func(GetNonVarReg(playout->R0), GetNonVarReg(playout->R1), GetScriptContext()); \
-        break; \
+        PROCESS_NEXT_OPCODE(); \
     }
 
 #define PROCESS_A2toXXMemNonVar(name, func) PROCESS_A2toXXMemNonVar_COMMON(name, func,)
 
 #define PROCESS_A1NonVarToA1_COMMON(name, func, suffix) \
-    case OpCode::name: \
+    case OpCode::name: PROCESS_OPCODE_LABEL(name) \
     { \
         PROCESS_READ_LAYOUT(name, Reg2, suffix); \
         SetReg(playout->R0, \
             func(GetNonVarReg(playout->R1))); \
-        break; \
+        PROCESS_NEXT_OPCODE(); \
     }
 
 
 #define PROCESS_A2NonVarToA1Reg_COMMON(name, func, suffix) \
-    case OpCode::name: \
+    case OpCode::name: PROCESS_OPCODE_LABEL(name) \
     { \
         PROCESS_READ_LAYOUT(name, Reg3, suffix); \
         SetReg(playout->R0, \
             func(GetNonVarReg(playout->R1), playout->R2)); \
-        break; \
+        PROCESS_NEXT_OPCODE(); \
     }
 
 #define PROCESS_A2toA1Mem_COMMON(name, func, suffix) \
-    case OpCode::name: \
+    case OpCode::name: PROCESS_OPCODE_LABEL(name) \
     { \
         PROCESS_READ_LAYOUT(name, Reg3, suffix); \
         SetReg(playout->R0, \
                 func(GetReg(playout->R1), GetReg(playout->R2),GetScriptContext())); \
-        break; \
+        PROCESS_NEXT_OPCODE(); \
     }
 
 #define PROCESS_A2toA1Mem(name, func) PROCESS_A2toA1Mem_COMMON(name, func,)
 
 #define PROCESS_A2toA1MemProfiled_COMMON(name, func, suffix) \
-    case OpCode::name: \
+    case OpCode::name: PROCESS_OPCODE_LABEL(name) \
     { \
         PROCESS_READ_LAYOUT(name, ProfiledReg3, suffix); \
         SetReg(playout->R0, \
         func(GetReg(playout->R1), GetReg(playout->R2),GetScriptContext(), playout->profileId)); \
-        break; \
+        PROCESS_NEXT_OPCODE(); \
     }
 
 #define PROCESS_A2toA1MemProfiled(name, func) PROCESS_A2toA1MemProfiled_COMMON(name, func,)
 
 #define PROCESS_A2toA1NonVar_COMMON(name, func, suffix) \
-    case OpCode::name: \
+    case OpCode::name: PROCESS_OPCODE_LABEL(name) \
     { \
         PROCESS_READ_LAYOUT(name, Reg3, suffix); \
         SetNonVarReg(playout->R0, \
                 func(GetNonVarReg(playout->R1), GetNonVarReg(playout->R2))); \
-        break; \
+        PROCESS_NEXT_OPCODE(); \
     }
 
 #define PROCESS_A2toA1NonVar(name, func) PROCESS_A2toA1NonVar_COMMON(name, func,)
 
 #define PROCESS_A2toA1MemNonVar_COMMON(name, func, suffix) \
-    case OpCode::name: \
+    case OpCode::name: PROCESS_OPCODE_LABEL(name) \
     { \
         PROCESS_READ_LAYOUT(name, Reg3, suffix); \
         SetNonVarReg(playout->R0, \
                 func(GetNonVarReg(playout->R1), GetNonVarReg(playout->R2),GetScriptContext())); \
-        break; \
+        PROCESS_NEXT_OPCODE(); \
     }
 
 #define PROCESS_A2toA1MemNonVar(name, func) PROCESS_A2toA1MemNonVar_COMMON(name, func,)
 
 #define PROCESS_CMMem_COMMON(name, func, suffix) \
-    case OpCode::name: \
+    case OpCode::name: PROCESS_OPCODE_LABEL(name) \
     { \
         PROCESS_READ_LAYOUT(name, Reg3, suffix); \
         SetReg(playout->R0, \
             func(GetReg(playout->R1), GetReg(playout->R2), GetScriptContext()) ? JavascriptBoolean::OP_LdTrue(GetScriptContext()) : \
                     JavascriptBoolean::OP_LdFalse(GetScriptContext())); \
-        break; \
+        PROCESS_NEXT_OPCODE(); \
     }
 
 #define PROCESS_CMMem(name, func) PROCESS_CMMem_COMMON(name, func,)
 
 #define PROCESS_ELEM_RtU_to_XX_COMMON(name, func, suffix) \
-    case OpCode::name: \
+    case OpCode::name: PROCESS_OPCODE_LABEL(name) \
     { \
         PROCESS_READ_LAYOUT(name, ElementRootU, suffix); \
         func(playout->PropertyIdIndex); \
-        break; \
+        PROCESS_NEXT_OPCODE(); \
     }
 
 #define PROCESS_ELEM_RtU_to_XX(name, func) PROCESS_ELEM_RtU_to_XX_COMMON(name, func,)
 
 #define PROCESS_ELEM_C2_to_XX_COMMON(name, func, suffix) \
-    case OpCode::name: \
+    case OpCode::name: PROCESS_OPCODE_LABEL(name) \
     { \
         PROCESS_READ_LAYOUT(name, ElementScopedC, suffix); \
         func(GetEnvForEvalCode(), playout->PropertyIdIndex, GetReg(playout->Value)); \
-        break; \
+        PROCESS_NEXT_OPCODE(); \
     }
 
 #define PROCESS_ELEM_C2_to_XX(name, func) PROCESS_ELEM_C2_to_XX_COMMON(name, func,)
 
 #define PROCESS_GET_ELEM_SLOT_FB_COMMON(name, func, suffix) \
-    case OpCode::name: \
+    case OpCode::name: PROCESS_OPCODE_LABEL(name) \
     { \
         PROCESS_READ_LAYOUT(name, ElementSlot, suffix); \
         SetReg(playout->Value, \
                 func((FrameDisplay*)GetNonVarReg(playout->Instance), this->m_functionBody->GetNestedFuncReference(playout->SlotIndex))); \
-        break; \
+        PROCESS_NEXT_OPCODE(); \
     }
 
 #define PROCESS_GET_ELEM_SLOT_FB(name, func) PROCESS_GET_ELEM_SLOT_FB_COMMON(name, func,)
 
 #define PROCESS_GET_SLOT_FB_COMMON(name, func, suffix) \
-    case OpCode::name: \
+    case OpCode::name: PROCESS_OPCODE_LABEL(name) \
     { \
         PROCESS_READ_LAYOUT(name, ElementSlotI1, suffix); \
         SetReg(playout->Value, \
                func(this->GetFrameDisplayForNestedFunc(), this->m_functionBody->GetNestedFuncReference(playout->SlotIndex))); \
-        break; \
+        PROCESS_NEXT_OPCODE(); \
     }
 
 #define PROCESS_GET_SLOT_FB(name, func) PROCESS_GET_SLOT_FB_COMMON(name, func,)
 
 #define PROCESS_GET_ELEM_IMem_COMMON(name, func, suffix) \
-    case OpCode::name: \
+    case OpCode::name: PROCESS_OPCODE_LABEL(name) \
     { \
         PROCESS_READ_LAYOUT(name, ElementI, suffix); \
         SetReg(playout->Value, \
                 func(GetReg(playout->Instance), GetReg(playout->Element), GetScriptContext())); \
-        break; \
+        PROCESS_NEXT_OPCODE(); \
     }
 
 #define PROCESS_GET_ELEM_IMem(name, func) PROCESS_GET_ELEM_IMem_COMMON(name, func,)
 
 #define PROCESS_GET_ELEM_IMem_Strict_COMMON(name, func, suffix) \
-    case OpCode::name: \
+    case OpCode::name: PROCESS_OPCODE_LABEL(name) \
     { \
         PROCESS_READ_LAYOUT(name, ElementI, suffix); \
         SetReg(playout->Value, \
                 func(GetReg(playout->Instance), GetReg(playout->Element), GetScriptContext(), PropertyOperation_StrictMode)); \
-        break; \
+        PROCESS_NEXT_OPCODE(); \
     }
 
 #define PROCESS_GET_ELEM_IMem_Strict(name, func) PROCESS_GET_ELEM_IMem_Strict_COMMON(name, func,)
 
 #define PROCESS_BR(name, func) \
-    case OpCode::name: \
+    case OpCode::name: PROCESS_OPCODE_LABEL(name) \
     { \
         PROCESS_READ_LAYOUT(name, Br,); \
         ip = func(playout); \
-        break; \
+        PROCESS_NEXT_OPCODE(); \
     }
 
 #ifdef BYTECODE_BRANCH_ISLAND
 #define PROCESS_BRLONG(name, func) \
-    case OpCode::name: \
+    case OpCode::name: PROCESS_OPCODE_LABEL(name) \
     { \
         PROCESS_READ_LAYOUT(name, BrLong,); \
         ip = func(playout); \
-        break; \
+        PROCESS_NEXT_OPCODE(); \
     }
 #endif
 
 #define PROCESS_BRS(name,func)  \
-    case OpCode::name: \
+    case OpCode::name: PROCESS_OPCODE_LABEL(name) \
     { \
         PROCESS_READ_LAYOUT(name, BrS,); \
         if (func(playout->val,GetScriptContext())) \
         { \
             ip = m_reader.SetCurrentRelativeOffset(ip, playout->RelativeJumpOffset); \
         } \
-        break; \
+        PROCESS_NEXT_OPCODE(); \
     }
 
 #define PROCESS_BRB_COMMON(name, func, suffix) \
-    case OpCode::name: \
+    case OpCode::name: PROCESS_OPCODE_LABEL(name) \
     { \
         PROCESS_READ_LAYOUT(name, BrReg1, suffix); \
         if (func(GetReg(playout->R1))) \
         { \
             ip = m_reader.SetCurrentRelativeOffset(ip, playout->RelativeJumpOffset); \
         } \
-        break; \
+        PROCESS_NEXT_OPCODE(); \
     }
 
 #define PROCESS_BRB(name, func) PROCESS_BRB_COMMON(name, func,)
 
 #define PROCESS_BRB_ALLOW_STACK_COMMON(name, func, suffix) \
-    case OpCode::name: \
+    case OpCode::name: PROCESS_OPCODE_LABEL(name) \
     { \
         PROCESS_READ_LAYOUT(name, BrReg1, suffix); \
         if (func(GetRegAllowStackVar(playout->R1))) \
         { \
             ip = m_reader.SetCurrentRelativeOffset(ip, playout->RelativeJumpOffset); \
         } \
-        break; \
+        PROCESS_NEXT_OPCODE(); \
     }
 
 #define PROCESS_BRB_ALLOW_STACK(name, func) PROCESS_BRB_ALLOW_STACK_COMMON(name, func,)
 
 #define PROCESS_BRBS_COMMON(name, func, suffix) \
-    case OpCode::name: \
+    case OpCode::name: PROCESS_OPCODE_LABEL(name) \
     { \
         PROCESS_READ_LAYOUT(name, BrReg1, suffix); \
         if (func(GetReg(playout->R1), GetScriptContext())) \
         { \
             ip = m_reader.SetCurrentRelativeOffset(ip, playout->RelativeJumpOffset); \
         } \
-        break; \
+        PROCESS_NEXT_OPCODE(); \
     }
 
 #define PROCESS_BRBS(name, func) PROCESS_BRBS_COMMON(name, func,)
 
 #define PROCESS_BRBReturnP1toA1_COMMON(name, func, suffix) \
-    case OpCode::name: \
+    case OpCode::name: PROCESS_OPCODE_LABEL(name) \
     { \
         PROCESS_READ_LAYOUT(name, BrReg1Unsigned1, suffix); \
         SetReg(playout->R1, func(GetForInEnumerator(playout->C2))); \
@@ -617,286 +622,286 @@
         { \
             ip = m_reader.SetCurrentRelativeOffset(ip, playout->RelativeJumpOffset); \
         } \
-        break; \
+        PROCESS_NEXT_OPCODE(); \
     }
 
 #define PROCESS_BRBReturnP1toA1(name, func) PROCESS_BRBReturnP1toA1_COMMON(name, func,)
 
 #define PROCESS_BRBMem_ALLOW_STACK_COMMON(name, func, suffix) \
-    case OpCode::name: \
+    case OpCode::name: PROCESS_OPCODE_LABEL(name) \
     { \
         PROCESS_READ_LAYOUT(name, BrReg1, suffix); \
         if (func(GetRegAllowStackVar(playout->R1),GetScriptContext())) \
         { \
             ip = m_reader.SetCurrentRelativeOffset(ip, playout->RelativeJumpOffset); \
         } \
-        break; \
+        PROCESS_NEXT_OPCODE(); \
     }
 #define PROCESS_BRBMem_ALLOW_STACK(name, func) PROCESS_BRBMem_ALLOW_STACK_COMMON(name, func,)
 
 #define PROCESS_BRCMem_COMMON(name, func,suffix) \
-    case OpCode::name: \
+    case OpCode::name: PROCESS_OPCODE_LABEL(name) \
     { \
         PROCESS_READ_LAYOUT(name, BrReg2, suffix); \
         if (func(GetReg(playout->R1), GetReg(playout->R2),GetScriptContext())) \
         { \
             ip = m_reader.SetCurrentRelativeOffset(ip, playout->RelativeJumpOffset); \
         } \
-        break; \
+        PROCESS_NEXT_OPCODE(); \
     }
 
 #define PROCESS_BRCMem(name, func) PROCESS_BRCMem_COMMON(name, func,)
 
 #define PROCESS_BRPROP(name, func) \
-    case OpCode::name: \
+    case OpCode::name: PROCESS_OPCODE_LABEL(name) \
     { \
         PROCESS_READ_LAYOUT(name, BrProperty,); \
         if (func(GetReg(playout->Instance), playout->PropertyIdIndex, GetScriptContext())) \
         { \
             ip = m_reader.SetCurrentRelativeOffset(ip, playout->RelativeJumpOffset); \
         } \
-        break; \
+        PROCESS_NEXT_OPCODE(); \
     }
 
 #define PROCESS_BRLOCALPROP(name, func) \
-    case OpCode::name: \
+    case OpCode::name: PROCESS_OPCODE_LABEL(name) \
     { \
         PROCESS_READ_LAYOUT(name, BrLocalProperty,); \
         if (func(this->localClosure, playout->PropertyIdIndex, GetScriptContext())) \
         { \
             ip = m_reader.SetCurrentRelativeOffset(ip, playout->RelativeJumpOffset); \
         } \
-        break; \
+        PROCESS_NEXT_OPCODE(); \
     }
 
 #define PROCESS_BRENVPROP(name, func) \
-    case OpCode::name: \
+    case OpCode::name: PROCESS_OPCODE_LABEL(name) \
     { \
         PROCESS_READ_LAYOUT(name, BrEnvProperty,); \
         if (func(LdEnv(), playout->SlotIndex, playout->PropertyIdIndex, GetScriptContext())) \
         { \
             ip = m_reader.SetCurrentRelativeOffset(ip, playout->RelativeJumpOffset); \
         } \
-        break; \
+        PROCESS_NEXT_OPCODE(); \
     }
 
 #define PROCESS_W1(name, func) \
-    case OpCode::name: \
+    case OpCode::name: PROCESS_OPCODE_LABEL(name) \
     { \
         PROCESS_READ_LAYOUT(name, W1,); \
         func(playout->C1, GetScriptContext()); \
-        break; \
+        PROCESS_NEXT_OPCODE(); \
     }
 
 #define PROCESS_U1toA1_COMMON(name, func, suffix) \
-    case OpCode::name: \
+    case OpCode::name: PROCESS_OPCODE_LABEL(name) \
     { \
         PROCESS_READ_LAYOUT(name, Reg1Unsigned1, suffix); \
         SetReg(playout->R0, \
                 func(playout->C1,GetScriptContext())); \
-        break; \
+        PROCESS_NEXT_OPCODE(); \
     }
 #define PROCESS_U1toA1(name, func) PROCESS_U1toA1_COMMON(name, func,)
 
 #define PROCESS_U1toA1NonVar_COMMON(name, func, suffix) \
-    case OpCode::name: \
+    case OpCode::name: PROCESS_OPCODE_LABEL(name) \
     { \
         PROCESS_READ_LAYOUT(name, Reg1Unsigned1, suffix); \
         SetNonVarReg(playout->R0, \
                 func(playout->C1)); \
-        break; \
+        PROCESS_NEXT_OPCODE(); \
     }
 #define PROCESS_U1toA1NonVar(name, func) PROCESS_U1toA1NonVar_COMMON(name, func,)
 
 #define PROCESS_U1toA1NonVar_FuncBody_COMMON(name, func, suffix) \
-    case OpCode::name: \
+    case OpCode::name: PROCESS_OPCODE_LABEL(name) \
     { \
         PROCESS_READ_LAYOUT(name, Reg1Unsigned1, suffix); \
         SetNonVarReg(playout->R0, \
                 func(playout->C1,GetScriptContext(), this->m_functionBody)); \
-        break; \
+        PROCESS_NEXT_OPCODE(); \
     }
 #define PROCESS_U1toA1NonVar_FuncBody(name, func) PROCESS_U1toA1NonVar_FuncBody_COMMON(name, func,)
 
 #define PROCESS_A1I2toXXNonVar_FuncBody(name, func) PROCESS_A1I2toXXNonVar_FuncBody_COMMON(name, func,)
 
 #define PROCESS_A1I2toXXNonVar_FuncBody_COMMON(name, func, suffix) \
-    case OpCode::name: \
+    case OpCode::name: PROCESS_OPCODE_LABEL(name) \
     { \
         PROCESS_READ_LAYOUT(name, Reg3, suffix); \
         func(playout->R0, playout->R1, playout->R2, GetScriptContext(), this->m_functionBody); \
-        break; \
+        PROCESS_NEXT_OPCODE(); \
     }
 
 #define PROCESS_A1U1toXX_COMMON(name, func, suffix) \
-    case OpCode::name: \
+    case OpCode::name: PROCESS_OPCODE_LABEL(name) \
     { \
         PROCESS_READ_LAYOUT(name, Reg1Unsigned1, suffix); \
         func(GetReg(playout->R0), playout->C1); \
-        break; \
+        PROCESS_NEXT_OPCODE(); \
     }
 
 #define PROCESS_A1U1toXX(name, func) PROCESS_A1U1toXX_COMMON(name, func,)
 
 #define PROCESS_A1U1toXXWithCache_COMMON(name, func, suffix) \
-    case OpCode::name: \
+    case OpCode::name: PROCESS_OPCODE_LABEL(name) \
     { \
         PROCESS_READ_LAYOUT(name, ProfiledReg1Unsigned1, suffix); \
         func(GetReg(playout->R0), playout->C1, playout->profileId); \
-        break; \
+        PROCESS_NEXT_OPCODE(); \
     }
 
 #define PROCESS_A1U1toXXWithCache(name, func) PROCESS_A1U1toXXWithCache_COMMON(name, func,)
 
 #define PROCESS_EnvU1toXX_COMMON(name, func, suffix) \
-    case OpCode::name: \
+    case OpCode::name: PROCESS_OPCODE_LABEL(name) \
     { \
         PROCESS_READ_LAYOUT(name, Unsigned1, suffix); \
         func(LdEnv(), playout->C1); \
-        break; \
+        PROCESS_NEXT_OPCODE(); \
     }
 
 #define PROCESS_EnvU1toXX(name, func) PROCESS_EnvU1toXX_COMMON(name, func,)
 
 #define PROCESS_GET_ELEM_SLOTNonVar_COMMON(name, func, layout, suffix) \
-    case OpCode::name: \
+    case OpCode::name: PROCESS_OPCODE_LABEL(name) \
     { \
         PROCESS_READ_LAYOUT(name, layout, suffix); \
         SetNonVarReg(playout->Value, func(GetNonVarReg(playout->Instance), playout)); \
-        break; \
+        PROCESS_NEXT_OPCODE(); \
     }
 
 #define PROCESS_GET_ELEM_SLOTNonVar(name, func, layout) PROCESS_GET_ELEM_SLOTNonVar_COMMON(name, func, layout,)
 
 #define PROCESS_GET_ELEM_LOCALSLOTNonVar_COMMON(name, func, layout, suffix) \
-    case OpCode::name: \
+    case OpCode::name: PROCESS_OPCODE_LABEL(name) \
     { \
         PROCESS_READ_LAYOUT(name, layout, suffix); \
         SetNonVarReg(playout->Value, func((Var*)GetLocalClosure(), playout)); \
-        break; \
+        PROCESS_NEXT_OPCODE(); \
     }
 
 #define PROCESS_GET_ELEM_LOCALSLOTNonVar(name, func, layout) PROCESS_GET_ELEM_LOCALSLOTNonVar_COMMON(name, func, layout,)
 
 #define PROCESS_GET_ELEM_PARAMSLOTNonVar_COMMON(name, func, layout, suffix) \
-    case OpCode::name: \
+    case OpCode::name: PROCESS_OPCODE_LABEL(name) \
     { \
         PROCESS_READ_LAYOUT(name, layout, suffix); \
         SetNonVarReg(playout->Value, func((Var*)GetParamClosure(), playout)); \
-        break; \
+        PROCESS_NEXT_OPCODE(); \
     }
 
 #define PROCESS_GET_ELEM_PARAMSLOTNonVar(name, func, layout) PROCESS_GET_ELEM_PARAMSLOTNonVar_COMMON(name, func, layout,)
 
 #define PROCESS_GET_ELEM_INNERSLOTNonVar_COMMON(name, func, layout, suffix) \
-    case OpCode::name: \
+    case OpCode::name: PROCESS_OPCODE_LABEL(name) \
     { \
         PROCESS_READ_LAYOUT(name, layout, suffix); \
         SetNonVarReg(playout->Value, func(InnerScopeFromIndex(playout->SlotIndex1), playout)); \
-        break; \
+        PROCESS_NEXT_OPCODE(); \
     }
 
 #define PROCESS_GET_ELEM_INNERSLOTNonVar(name, func, layout) PROCESS_GET_ELEM_INNERSLOTNonVar_COMMON(name, func, layout,)
 
 #define PROCESS_GET_ELEM_ENVSLOTNonVar_COMMON(name, func, layout, suffix) \
-    case OpCode::name: \
+    case OpCode::name: PROCESS_OPCODE_LABEL(name) \
     { \
         PROCESS_READ_LAYOUT(name, layout, suffix); \
         SetNonVarReg(playout->Value, func(LdEnv(), playout)); \
-        break; \
+        PROCESS_NEXT_OPCODE(); \
     }
 
 #define PROCESS_GET_ELEM_ENVSLOTNonVar(name, func, layout) PROCESS_GET_ELEM_ENVSLOTNonVar_COMMON(name, func, layout,)
 
 #define PROCESS_SET_ELEM_SLOTNonVar_COMMON(name, func, suffix) \
-    case OpCode::name: \
+    case OpCode::name: PROCESS_OPCODE_LABEL(name) \
     { \
         PROCESS_READ_LAYOUT(name, ElementSlot, suffix); \
         func(GetNonVarReg(playout->Instance), playout->SlotIndex, GetRegAllowStackVarEnableOnly(playout->Value)); \
-        break; \
+        PROCESS_NEXT_OPCODE(); \
     }
 
 #define PROCESS_SET_ELEM_SLOTNonVar(name, func) PROCESS_SET_ELEM_SLOTNonVar_COMMON(name, func,)
 
 #define PROCESS_SET_ELEM_LOCALSLOTNonVar_COMMON(name, func, suffix) \
-    case OpCode::name: \
+    case OpCode::name: PROCESS_OPCODE_LABEL(name) \
     { \
         PROCESS_READ_LAYOUT(name, ElementSlotI1, suffix); \
         func((Var*)GetLocalClosure(), playout->SlotIndex, GetRegAllowStackVarEnableOnly(playout->Value)); \
-        break; \
+        PROCESS_NEXT_OPCODE(); \
     }
 
 #define PROCESS_SET_ELEM_LOCALSLOTNonVar(name, func) PROCESS_SET_ELEM_LOCALSLOTNonVar_COMMON(name, func,)
 
 #define PROCESS_SET_ELEM_INNERSLOTNonVar_COMMON(name, func, suffix) \
-    case OpCode::name: \
+    case OpCode::name: PROCESS_OPCODE_LABEL(name) \
     { \
         PROCESS_READ_LAYOUT(name, ElementSlotI2, suffix); \
         func(InnerScopeFromIndex(playout->SlotIndex1), playout->SlotIndex2, GetRegAllowStackVarEnableOnly(playout->Value)); \
-        break; \
+        PROCESS_NEXT_OPCODE(); \
     }
 
 #define PROCESS_SET_ELEM_INNERSLOTNonVar(name, func) PROCESS_SET_ELEM_INNERSLOTNonVar_COMMON(name, func,)
 
 #define PROCESS_SET_ELEM_ENVSLOTNonVar_COMMON(name, func, suffix) \
-    case OpCode::name: \
+    case OpCode::name: PROCESS_OPCODE_LABEL(name) \
     { \
         PROCESS_READ_LAYOUT(name, ElementSlotI2, suffix); \
         func(LdEnv(), playout->SlotIndex1, playout->SlotIndex2, GetRegAllowStackVarEnableOnly(playout->Value)); \
-        break; \
+        PROCESS_NEXT_OPCODE(); \
     }
 
 #define PROCESS_SET_ELEM_ENVSLOTNonVar(name, func) PROCESS_SET_ELEM_ENVSLOTNonVar_COMMON(name, func,)
 
 /*---------------------------------------------------------------------------------------------- */
 #define PROCESS_A3toA1Mem_COMMON(name, func, suffix) \
-    case OpCode::name: \
+    case OpCode::name: PROCESS_OPCODE_LABEL(name) \
     { \
         PROCESS_READ_LAYOUT(name, Reg4, suffix); \
         SetReg(playout->R0, \
                 func(GetReg(playout->R1), GetReg(playout->R2), GetReg(playout->R3), GetScriptContext())); \
-        break; \
+        PROCESS_NEXT_OPCODE(); \
     }
 
 #define PROCESS_A3toA1Mem(name, func) PROCESS_A3toA1Mem_COMMON(name, func,)
 
 /*---------------------------------------------------------------------------------------------- */
 #define PROCESS_A2I1toA1Mem_COMMON(name, func, suffix) \
-    case OpCode::name: \
+    case OpCode::name: PROCESS_OPCODE_LABEL(name) \
     { \
         PROCESS_READ_LAYOUT(name, Reg3B1, suffix); \
         SetReg(playout->R0, \
                 func(GetReg(playout->R1), GetReg(playout->R2), playout->B3, GetScriptContext())); \
-        break; \
+        PROCESS_NEXT_OPCODE(); \
     }
 
 #define PROCESS_A2I1toA1Mem(name, func) PROCESS_A2I1toA1Mem_COMMON(name, func,)
 
 /*---------------------------------------------------------------------------------------------- */
 #define PROCESS_A2I1toXXMem_COMMON(name, func, suffix) \
-    case OpCode::name: \
+    case OpCode::name: PROCESS_OPCODE_LABEL(name) \
     { \
         PROCESS_READ_LAYOUT(name, Reg2B1, suffix); \
         func(GetReg(playout->R0), GetReg(playout->R1), playout->B2, scriptContext); \
-        break; \
+        PROCESS_NEXT_OPCODE(); \
     }
 
 #define PROCESS_A2I1toXXMem(name, func) PROCESS_A2I1toXXMem_COMMON(name, func,)
 
 /*---------------------------------------------------------------------------------------------- */
 #define PROCESS_A3I1toXXMem_COMMON(name, func, suffix) \
-    case OpCode::name: \
+    case OpCode::name: PROCESS_OPCODE_LABEL(name) \
     { \
         PROCESS_READ_LAYOUT(name, Reg3B1, suffix); \
         func(GetReg(playout->R0), GetReg(playout->R1), GetReg(playout->R2), playout->B3, scriptContext); \
-        break; \
+        PROCESS_NEXT_OPCODE(); \
     }
 
 #define PROCESS_A3I1toXXMem(name, func) PROCESS_A3I1toXXMem_COMMON(name, func,)
 
 #if ENABLE_PROFILE_INFO
 #define PROCESS_IP_TARG_IMPL(name, func, layoutSize) \
-    case OpCode::name: \
+    case OpCode::name: PROCESS_OPCODE_LABEL(name) \
     { \
         Assert(!switchProfileMode); \
         ip = func<layoutSize, INTERPRETERPROFILE>(ip); \
@@ -905,14 +910,14 @@
             m_reader.SetIP(ip); \
             return nullptr; \
         } \
-        break; \
+        PROCESS_NEXT_OPCODE(); \
     }
 #else
 #define PROCESS_IP_TARG_IMPL(name, func, layoutSize) \
-    case OpCode::name: \
+    case OpCode::name: PROCESS_OPCODE_LABEL(name) \
     { \
         ip = func<layoutSize, INTERPRETERPROFILE>(ip); \
-       break; \
+       PROCESS_NEXT_OPCODE(); \
     }
 #endif
 
@@ -307,7 +307,7 @@ CommonNumber:
             }
             else
             {
-                scriptContext->GetOrAddPropertyRecord(propName->GetString(), propName->GetLength(), propertyRecord);
+                scriptContext->GetOrAddPropertyRecord(propName, propertyRecord);
             }
         }
     }
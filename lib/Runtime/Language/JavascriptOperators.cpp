@@ -122,18 +122,29 @@ namespace Js
             char16 const * propertyName = indexStr->GetString();
             charcount_t const propertyLength = indexStr->GetLength();
 
-            if (!createIfNotFound && preferJavascriptStringOverPropertyRecord)
+            if (JavascriptOperators::TryConvertToUInt32(propertyName, propertyLength, index) &&
+                (*index != JavascriptArray::InvalidIndex))
             {
-                if (JavascriptOperators::TryConvertToUInt32(propertyName, propertyLength, index) &&
-                    (*index != JavascriptArray::InvalidIndex))
-                {
-                    return IndexType_Number;
-                }
+                return IndexType_Number;
+            }
 
+            if (!createIfNotFound && preferJavascriptStringOverPropertyRecord)
+            {
                 *propertyNameString = indexStr;
                 return IndexType_JavascriptString;
             }
-            return GetIndexTypeFromString(propertyName, propertyLength, scriptContext, index, propertyRecord, createIfNotFound);
+
+            // Look up with the string itself rather than its buffer, so that a string used as a key repeatedly
+            // finds its property record in the thread context's cache
+            if (createIfNotFound)
+            {
+                scriptContext->GetOrAddPropertyRecord(indexStr, propertyRecord);
+            }
+            else
+            {
+                scriptContext->FindPropertyRecord(indexStr, propertyRecord);
+            }
+            return IndexType_PropertyId;
         }
     }
 
@@ -153,6 +164,21 @@ namespace Js
         return GetIndexType(indexVar, scriptContext, index, propertyRecord, nullptr, createIfNotFound, false);
     }
 
+    // Returns the type handler of a plain object that is used as a hash table (see SimpleDictionaryUnorderedTypeHandler), for
+    // which keyed accesses with a string can go straight to the string keyed property map.
+    DynamicTypeHandler * GetStringKeyedTypeHandler(RecyclableObject* object, ScriptContext* scriptContext)
+    {
+        if (object->GetTypeId() != TypeIds_Object ||
+            object->GetScriptContext() != scriptContext ||
+            PHASE_OFF1(Js::StringKeyedElementFastPathPhase))
+        {
+            return nullptr;
+        }
+
+        DynamicTypeHandler * typeHandler = DynamicObject::FromVar(object)->GetTypeHandler();
+        return typeHandler->IsStringTypeHandler() ? typeHandler : nullptr;
+    }
+
     BOOL FEqualDbl(double dbl1, double dbl2)
     {
         // If the low ulongs don't match, they can't be equal.
@@ -1522,7 +1548,15 @@ CommonNumber:
         RecyclableObject* object = TaggedNumber::Is(instance) ?
             scriptContext->GetLibrary()->GetNumberPrototype() :
             RecyclableObject::FromVar(instance);
-        BOOL result = HasProperty(object, propertyId);
+
+        BOOL result;
+        MegamorphicPropertyCache* megamorphicPropertyCache = scriptContext->GetThreadContext()->GetMegamorphicPropertyCache();
+        if (megamorphicPropertyCache && megamorphicPropertyCache->TryHasProperty(object, propertyId, &result))
+        {
+            return result;
+        }
+
+        result = HasProperty(object, propertyId);
         return result;
     }
 
@@ -3790,6 +3824,13 @@ CommonNumber:
         }
         else if (indexType == IndexType_JavascriptString)
         {
+            DynamicTypeHandler * typeHandler = receiver == object ? GetStringKeyedTypeHandler(object, scriptContext) : nullptr;
+            if (typeHandler != nullptr &&
+                typeHandler->TryGetStringKeyedDataProperty(DynamicObject::FromVar(object), propertyNameString, &value))
+            {
+                return value;
+            }
+
             if (JavascriptOperators::GetPropertyWPCache(receiver, object, propertyNameString, &value, scriptContext, nullptr))
             {
                 return value;
@@ -4475,6 +4516,15 @@ CommonNumber:
                 return JavascriptOperators::SetProperty(receiver, object, PropertyIds::Infinity, value, scriptContext, flags);
             }
 
+            // An existing own data property of an object used as a hash table shadows the prototype chain, so the store does
+            // not need to look for setters first
+            DynamicTypeHandler * typeHandler = receiver == object ? GetStringKeyedTypeHandler(object, scriptContext) : nullptr;
+            if (typeHandler != nullptr &&
+                typeHandler->TrySetStringKeyedDataProperty(DynamicObject::FromVar(object), propertyNameString, value))
+            {
+                return TRUE;
+            }
+
             return JavascriptOperators::SetPropertyWPCache(receiver, object, propertyNameString, value, scriptContext, nullptr, flags);
         }
         else if (indexType == IndexType_PropertyId)
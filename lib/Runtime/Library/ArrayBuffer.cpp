@@ -564,7 +564,7 @@ namespace Js
 
     ArrayBufferDetachedStateBase* JavascriptArrayBuffer::CreateDetachedState(BYTE* buffer, uint32 bufferLength)
     {
-#if _WIN64
+#if ENABLE_FAST_ARRAYBUFFER
         if (IsValidVirtualBufferLength(bufferLength))
         {
             return HeapNew(ArrayBufferDetachedState<FreeFn>, buffer, bufferLength, FreeMemAlloc, ArrayBufferAllocationType::MemAlloc);
@@ -580,7 +580,7 @@ namespace Js
 
     bool JavascriptArrayBuffer::IsValidAsmJsBufferLength(uint length, bool forceCheck)
     {
-#if _WIN64
+#if ENABLE_FAST_ARRAYBUFFER
         /*
         1. length >= 2^16
         2. length is power of 2 or (length > 2^24 and length is multiple of 2^24)
@@ -611,7 +611,7 @@ namespace Js
     bool JavascriptArrayBuffer::IsValidVirtualBufferLength(uint length)
     {
 
-#if _WIN64
+#if ENABLE_FAST_ARRAYBUFFER
         /*
         1. length >= 2^16
         2. length is power of 2 or (length > 2^24 and length is multiple of 2^24)
@@ -642,7 +642,7 @@ namespace Js
             // Recycler may not be available at Dispose. We need to
             // free the memory and report that it has been freed at the same
             // time. Otherwise, AllocationPolicyManager is unable to provide correct feedback
-#if _WIN64
+#if ENABLE_FAST_ARRAYBUFFER
             //AsmJS Virtual Free
             //TOD - see if isBufferCleared need to be added for free too
             if (IsValidVirtualBufferLength(this->bufferLength) && !isBufferCleared)
@@ -216,7 +216,7 @@ namespace Js
         virtual void Finalize(bool isShutdown) override;
         static void*__cdecl  AllocWrapper(DECLSPEC_GUARD_OVERFLOW size_t length)
         {
-#if _WIN64
+#if ENABLE_FAST_ARRAYBUFFER
             LPVOID address = VirtualAlloc(nullptr, MAX_ASMJS_ARRAYBUFFER_LENGTH, MEM_RESERVE, PAGE_NOACCESS);
             //throw out of memory
             if (!address)
@@ -6182,42 +6182,641 @@ Case0:
         }
     }
 
-    static void hybridSort(__inout_ecount(length) Var *elements, uint32 length, CompareVarsInfo* compareInfo)
+    // Stable, run-adaptive merge sort (TimSort) used for Var arrays sorted with a user comparator. Every comparison
+    // is a full script call, so the algorithm is tuned to minimize comparisons rather than memory moves: natural
+    // ascending/descending runs are detected and extended with binary insertion, and merges switch to galloping
+    // when one run keeps winning. Elements are moved only inside the segment and a recycler allocated scratch
+    // buffer, so a comparator that throws (or triggers a GC) never loses an element.
+    class VarTimSort
     {
-        // The cost of memory moves starts to be more expensive than additional comparer calls (given a simple comparer)
-        // for arrays of more than 512 elements.
-        if (length > 512)
+    public:
+        VarTimSort(__inout_ecount(length) Var* elements, uint32 length, CompareVarsInfo* compareInfo, Recycler* recycler) :
+            elements(elements),
+            length(length),
+            compareInfo(compareInfo),
+            recycler(recycler),
+            tmp(nullptr),
+            tmpSize(0),
+            minGallop(InitialMinGallop),
+            pendingRunCount(0)
         {
-            qsort_s(elements, length, sizeof(Var), compareVars, compareInfo);
-            return;
         }
 
-        for (int i = 1; i < (int)length; i++)
+        void Sort()
         {
-            if (compareVars(compareInfo, elements + i, elements + i - 1) < 0) {
-                // binary search for the left-most element greater than value:
-                int first = 0;
-                int last = i - 1;
-                while (first <= last)
+            if (length < 2)
+            {
+                return;
+            }
+
+            if (length < MinMerge)
+            {
+                // Small arrays: one run extended with binary insertion, no merging.
+                uint32 runLength = CountRunAndMakeAscending(0, length);
+                BinaryInsertionSort(0, length, runLength);
+                return;
+            }
+
+            uint32 minRun = MinRunLength(length);
+            uint32 low = 0;
+            uint32 remaining = length;
+            do
+            {
+                uint32 runLength = CountRunAndMakeAscending(low, low + remaining);
+                if (runLength < minRun)
                 {
-                    int middle = (first + last) / 2;
-                    if (compareVars(compareInfo, elements + i, elements + middle) < 0)
+                    uint32 forced = remaining <= minRun ? remaining : minRun;
+                    BinaryInsertionSort(low, low + forced, low + runLength);
+                    runLength = forced;
+                }
+
+                PushRun(low, runLength);
+                MergeCollapse();
+
+                low += runLength;
+                remaining -= runLength;
+            } while (remaining != 0);
+
+            MergeForceCollapse();
+            Assert(pendingRunCount == 1 && pendingRuns[0].base == 0 && pendingRuns[0].length == length);
+        }
+
+    private:
+        static const uint32 MinMerge = 32;
+        static const uint32 InitialMinGallop = 7;
+        // Pending run lengths grow at least as fast as the Fibonacci numbers, so this bounds any uint32 length.
+        static const uint32 MaxPendingRuns = 64;
+
+        struct Run
+        {
+            uint32 base;
+            uint32 length;
+        };
+
+        bool LessThan(Var a, Var b)
+        {
+            return compareVars(compareInfo, &a, &b) < 0;
+        }
+
+        static uint32 MinRunLength(uint32 n)
+        {
+            // Pick a run length in [MinMerge/2, MinMerge] such that n / minRun is (close to) a power of 2.
+            uint32 r = 0;
+            while (n >= MinMerge)
+            {
+                r |= (n & 1);
+                n >>= 1;
+            }
+            return n + r;
+        }
+
+        // Returns the length of the run starting at 'low', reversing it in place if it is strictly descending.
+        // Only strictly descending runs are reversed so that equal elements keep their relative order.
+        uint32 CountRunAndMakeAscending(uint32 low, uint32 high)
+        {
+            Assert(low < high);
+            uint32 runHigh = low + 1;
+            if (runHigh == high)
+            {
+                return 1;
+            }
+
+            if (LessThan(elements[runHigh++], elements[low]))
+            {
+                while (runHigh < high && LessThan(elements[runHigh], elements[runHigh - 1]))
+                {
+                    runHigh++;
+                }
+                ReverseRange(low, runHigh);
+            }
+            else
+            {
+                while (runHigh < high && !LessThan(elements[runHigh], elements[runHigh - 1]))
+                {
+                    runHigh++;
+                }
+            }
+
+            return runHigh - low;
+        }
+
+        void ReverseRange(uint32 low, uint32 high)
+        {
+            while (high - low > 1)
+            {
+                high--;
+                Var t = elements[low];
+                elements[low] = elements[high];
+                elements[high] = t;
+                low++;
+            }
+        }
+
+        // Sorts [low, high) given that [low, start) is already sorted.
+        void BinaryInsertionSort(uint32 low, uint32 high, uint32 start)
+        {
+            Assert(low <= start && start <= high);
+            if (start == low)
+            {
+                start++;
+            }
+
+            for (; start < high; start++)
+            {
+                Var pivot = elements[start];
+
+                // Find the right-most position for the pivot, keeping the sort stable.
+                uint32 left = low;
+                uint32 right = start;
+                while (left < right)
+                {
+                    uint32 middle = left + ((right - left) >> 1);
+                    if (LessThan(pivot, elements[middle]))
                     {
-                        last = middle - 1;
+                        right = middle;
                     }
                     else
                     {
-                        first = middle + 1;
+                        left = middle + 1;
                     }
                 }
 
-                // insert value right before first:
-                Var value = elements[i];
-                memmove(elements + first + 1, elements + first, (i - first) * sizeof(Var));
-                elements[first] = value;
+                memmove(elements + left + 1, elements + left, (start - left) * sizeof(Var));
+                elements[left] = pivot;
             }
         }
-    }
+
+        void PushRun(uint32 base, uint32 runLength)
+        {
+            Assert(pendingRunCount < MaxPendingRuns);
+            pendingRuns[pendingRunCount].base = base;
+            pendingRuns[pendingRunCount].length = runLength;
+            pendingRunCount++;
+        }
+
+        // Merges pending runs until the run-length invariants hold:
+        //   1. runLength[i - 3] > runLength[i - 2] + runLength[i - 1]
+        //   2. runLength[i - 2] > runLength[i - 1]
+        void MergeCollapse()
+        {
+            while (pendingRunCount > 1)
+            {
+                uint32 n = pendingRunCount - 2;
+                if ((n > 0 && pendingRuns[n - 1].length <= pendingRuns[n].length + pendingRuns[n + 1].length) ||
+                    (n > 1 && pendingRuns[n - 2].length <= pendingRuns[n - 1].length + pendingRuns[n].length))
+                {
+                    if (pendingRuns[n - 1].length < pendingRuns[n + 1].length)
+                    {
+                        n--;
+                    }
+                }
+                else if (pendingRuns[n].length > pendingRuns[n + 1].length)
+                {
+                    break;
+                }
+                MergeAt(n);
+            }
+        }
+
+        void MergeForceCollapse()
+        {
+            while (pendingRunCount > 1)
+            {
+                uint32 n = pendingRunCount - 2;
+                if (n > 0 && pendingRuns[n - 1].length < pendingRuns[n + 1].length)
+                {
+                    n--;
+                }
+                MergeAt(n);
+            }
+        }
+
+        // Merges pending runs i and i + 1.
+        void MergeAt(uint32 i)
+        {
+            Assert(pendingRunCount >= 2 && (i == pendingRunCount - 2 || i == pendingRunCount - 3));
+
+            uint32 base1 = pendingRuns[i].base;
+            uint32 length1 = pendingRuns[i].length;
+            uint32 base2 = pendingRuns[i + 1].base;
+            uint32 length2 = pendingRuns[i + 1].length;
+            Assert(base1 + length1 == base2);
+
+            pendingRuns[i].length = length1 + length2;
+            if (i == pendingRunCount - 3)
+            {
+                pendingRuns[i + 1] = pendingRuns[i + 2];
+            }
+            pendingRunCount--;
+
+            // Elements of run1 that are <= the first element of run2 are already in place.
+            uint32 k = GallopRight(elements[base2], elements, base1, length1, 0);
+            base1 += k;
+            length1 -= k;
+            if (length1 == 0)
+            {
+                return;
+            }
+
+            // Elements of run2 that are >= the last element of run1 are already in place.
+            length2 = GallopLeft(elements[base1 + length1 - 1], elements, base2, length2, length2 - 1);
+            if (length2 == 0)
+            {
+                return;
+            }
+
+            if (length1 <= length2)
+            {
+                MergeLow(base1, length1, base2, length2);
+            }
+            else
+            {
+                MergeHigh(base1, length1, base2, length2);
+            }
+        }
+
+        // Returns the index k in [0, len] such that a[base + k - 1] < key <= a[base + k], searching outward from hint.
+        uint32 GallopLeft(Var key, const Var* a, uint32 base, uint32 len, uint32 hint)
+        {
+            Assert(len > 0 && hint < len);
+            uint32 lastOffset = 0;
+            uint32 offset = 1;
+            uint32 low;
+            uint32 high;
+
+            if (LessThan(a[base + hint], key))
+            {
+                // Gallop right until a[base + hint + lastOffset] < key <= a[base + hint + offset].
+                uint32 maxOffset = len - hint;
+                while (offset < maxOffset && LessThan(a[base + hint + offset], key))
+                {
+                    lastOffset = offset;
+                    offset = NextGallopOffset(offset, maxOffset);
+                }
+                if (offset > maxOffset)
+                {
+                    offset = maxOffset;
+                }
+                low = hint + lastOffset + 1;
+                high = hint + offset;
+            }
+            else
+            {
+                // Gallop left until a[base + hint - offset] < key <= a[base + hint - lastOffset].
+                uint32 maxOffset = hint + 1;
+                while (offset < maxOffset && !LessThan(a[base + hint - offset], key))
+                {
+                    lastOffset = offset;
+                    offset = NextGallopOffset(offset, maxOffset);
+                }
+                if (offset > maxOffset)
+                {
+                    offset = maxOffset;
+                }
+                low = hint + 1 - offset;
+                high = hint - lastOffset;
+            }
+
+            while (low < high)
+            {
+                uint32 middle = low + ((high - low) >> 1);
+                if (LessThan(a[base + middle], key))
+                {
+                    low = middle + 1;
+                }
+                else
+                {
+                    high = middle;
+                }
+            }
+            return high;
+        }
+
+        // Like GallopLeft, except that for equal elements it returns the index after the right-most one, i.e. the
+        // index k in [0, len] such that a[base + k - 1] <= key < a[base + k].
+        uint32 GallopRight(Var key, const Var* a, uint32 base, uint32 len, uint32 hint)
+        {
+            Assert(len > 0 && hint < len);
+            uint32 lastOffset = 0;
+            uint32 offset = 1;
+            uint32 low;
+            uint32 high;
+
+            if (LessThan(key, a[base + hint]))
+            {
+                // Gallop left until a[base + hint - offset] <= key < a[base + hint - lastOffset].
+                uint32 maxOffset = hint + 1;
+                while (offset < maxOffset && LessThan(key, a[base + hint - offset]))
+                {
+                    lastOffset = offset;
+                    offset = NextGallopOffset(offset, maxOffset);
+                }
+                if (offset > maxOffset)
+                {
+                    offset = maxOffset;
+                }
+                low = hint + 1 - offset;
+                high = hint - lastOffset;
+            }
+            else
+            {
+                // Gallop right until a[base + hint + lastOffset] <= key < a[base + hint + offset].
+                uint32 maxOffset = len - hint;
+                while (offset < maxOffset && !LessThan(key, a[base + hint + offset]))
+                {
+                    lastOffset = offset;
+                    offset = NextGallopOffset(offset, maxOffset);
+                }
+                if (offset > maxOffset)
+                {
+                    offset = maxOffset;
+                }
+                low = hint + lastOffset + 1;
+                high = hint + offset;
+            }
+
+            while (low < high)
+            {
+                uint32 middle = low + ((high - low) >> 1);
+                if (LessThan(key, a[base + middle]))
+                {
+                    high = middle;
+                }
+                else
+                {
+                    low = middle + 1;
+                }
+            }
+            return high;
+        }
+
+        static uint32 NextGallopOffset(uint32 offset, uint32 maxOffset)
+        {
+            // offset * 2 + 1, saturating at maxOffset instead of overflowing
+            return offset >= maxOffset / 2 ? maxOffset : (offset << 1) + 1;
+        }
+
+        Var* EnsureTmp(uint32 minSize)
+        {
+            if (tmpSize < minSize)
+            {
+                // Grow geometrically (capped at half the array, the most a merge ever needs) to avoid
+                // reallocating on every merge.
+                uint32 newSize = max(minSize, min(tmpSize * 2, length / 2));
+                tmp = RecyclerNewArray(recycler, Var, newSize);
+                tmpSize = newSize;
+            }
+            return tmp;
+        }
+
+        // Merges the adjacent runs [base1, base1 + length1) and [base2, base2 + length2) with run1 copied to the
+        // scratch buffer, filling the array from the low end. Requires length1 <= length2, that the first element
+        // of run2 is less than the first element of run1, and that the last element of run1 is greater than all of
+        // run2.
+        void MergeLow(uint32 base1, uint32 length1, uint32 base2, uint32 length2)
+        {
+            Assert(length1 > 0 && length2 > 0 && base1 + length1 == base2);
+
+            Var* a = elements;
+            Var* t = EnsureTmp(length1);
+            js_memcpy_s(t, tmpSize * sizeof(Var), a + base1, length1 * sizeof(Var));
+
+            // Live state: merged output a[base1, dest); remaining run1 t[cursor1, cursor1 + length1); remaining run2
+            // a[cursor2, cursor2 + length2). Whatever is left when we exit (normally or by a comparator throwing)
+            // is put back by sliding run2 down to dest and appending the rest of run1 after it.
+            struct MergeLowFinisher
+            {
+                Var* a; Var* t; uint32& dest; uint32& cursor1; uint32& length1; uint32& cursor2; uint32& length2;
+                ~MergeLowFinisher()
+                {
+                    memmove(a + dest, a + cursor2, length2 * sizeof(Var));
+                    js_memcpy_s(a + dest + length2, length1 * sizeof(Var), t + cursor1, length1 * sizeof(Var));
+                }
+            };
+
+            uint32 cursor1 = 0;
+            uint32 cursor2 = base2;
+            uint32 dest = base1;
+            MergeLowFinisher finisher = { a, t, dest, cursor1, length1, cursor2, length2 };
+
+            a[dest++] = a[cursor2++];
+            if (--length2 == 0 || length1 == 1)
+            {
+                return;
+            }
+
+            uint32 currentMinGallop = minGallop;
+            for (;;)
+            {
+                uint32 count1 = 0; // number of times in a row that run1 won
+                uint32 count2 = 0; // number of times in a row that run2 won
+
+                // One element at a time until one run starts winning consistently.
+                do
+                {
+                    Assert(length1 > 1 && length2 > 0);
+                    if (LessThan(a[cursor2], t[cursor1]))
+                    {
+                        a[dest++] = a[cursor2++];
+                        count2++;
+                        count1 = 0;
+                        if (--length2 == 0)
+                        {
+                            goto Done;
+                        }
+                    }
+                    else
+                    {
+                        a[dest++] = t[cursor1++];
+                        count1++;
+                        count2 = 0;
+                        if (--length1 == 1)
+                        {
+                            goto Done;
+                        }
+                    }
+                } while ((count1 | count2) < currentMinGallop);
+
+                // Galloping until neither run is winning consistently any more.
+                do
+                {
+                    Assert(length1 > 1 && length2 > 0);
+                    count1 = GallopRight(a[cursor2], t, cursor1, length1, 0);
+                    if (count1 != 0)
+                    {
+                        js_memcpy_s(a + dest, count1 * sizeof(Var), t + cursor1, count1 * sizeof(Var));
+                        dest += count1;
+                        cursor1 += count1;
+                        length1 -= count1;
+                        if (length1 <= 1)
+                        {
+                            goto Done;
+                        }
+                    }
+                    a[dest++] = a[cursor2++];
+                    if (--length2 == 0)
+                    {
+                        goto Done;
+                    }
+
+                    count2 = GallopLeft(t[cursor1], a, cursor2, length2, 0);
+                    if (count2 != 0)
+                    {
+                        memmove(a + dest, a + cursor2, count2 * sizeof(Var));
+                        dest += count2;
+                        cursor2 += count2;
+                        length2 -= count2;
+                        if (length2 == 0)
+                        {
+                            goto Done;
+                        }
+                    }
+                    a[dest++] = t[cursor1++];
+                    if (--length1 == 1)
+                    {
+                        goto Done;
+                    }
+
+                    if (currentMinGallop > 0)
+                    {
+                        currentMinGallop--;
+                    }
+                } while (count1 >= InitialMinGallop || count2 >= InitialMinGallop);
+
+                // Penalize leaving gallop mode.
+                currentMinGallop += 2;
+            }
+
+        Done:
+            minGallop = currentMinGallop < 1 ? 1 : currentMinGallop;
+        }
+
+        // Mirror image of MergeLow: run2 is copied to the scratch buffer and the array is filled from the high end.
+        // Requires length1 >= length2 and the same ordering preconditions as MergeLow.
+        void MergeHigh(uint32 base1, uint32 length1, uint32 base2, uint32 length2)
+        {
+            Assert(length1 > 0 && length2 > 0 && base1 + length1 == base2);
+
+            Var* a = elements;
+            Var* t = EnsureTmp(length2);
+            js_memcpy_s(t, tmpSize * sizeof(Var), a + base2, length2 * sizeof(Var));
+
+            // Live state: remaining run1 a[base1, base1 + length1); remaining run2 t[0, length2); merged output
+            // from base1 + length1 + length2 to the end of the two runs. Whatever is left when we exit is put back
+            // by sliding run1 up and placing the rest of run2 in front of it.
+            struct MergeHighFinisher
+            {
+                Var* a; Var* t; uint32 base1; uint32& length1; uint32& length2;
+                ~MergeHighFinisher()
+                {
+                    memmove(a + base1 + length2, a + base1, length1 * sizeof(Var));
+                    js_memcpy_s(a + base1, length2 * sizeof(Var), t, length2 * sizeof(Var));
+                }
+            };
+
+            MergeHighFinisher finisher = { a, t, base1, length1, length2 };
+
+            // The last element of run1 is known to be the largest of both runs.
+            a[base1 + length1 + length2 - 1] = a[base1 + length1 - 1];
+            if (--length1 == 0 || length2 == 1)
+            {
+                return;
+            }
+
+            uint32 currentMinGallop = minGallop;
+            for (;;)
+            {
+                uint32 count1 = 0; // number of times in a row that run1 won
+                uint32 count2 = 0; // number of times in a row that run2 won
+
+                do
+                {
+                    Assert(length1 > 0 && length2 > 1);
+                    uint32 dest = base1 + length1 + length2 - 1;
+                    if (LessThan(t[length2 - 1], a[base1 + length1 - 1]))
+                    {
+                        a[dest] = a[base1 + length1 - 1];
+                        count1++;
+                        count2 = 0;
+                        if (--length1 == 0)
+                        {
+                            goto Done;
+                        }
+                    }
+                    else
+                    {
+                        a[dest] = t[length2 - 1];
+                        count2++;
+                        count1 = 0;
+                        if (--length2 == 1)
+                        {
+                            goto Done;
+                        }
+                    }
+                } while ((count1 | count2) < currentMinGallop);
+
+                do
+                {
+                    Assert(length1 > 0 && length2 > 1);
+                    count1 = length1 - GallopRight(t[length2 - 1], a, base1, length1, length1 - 1);
+                    if (count1 != 0)
+                    {
+                        length1 -= count1;
+                        memmove(a + base1 + length1 + length2, a + base1 + length1, count1 * sizeof(Var));
+                        if (length1 == 0)
+                        {
+                            goto Done;
+                        }
+                    }
+                    a[base1 + length1 + length2 - 1] = t[length2 - 1];
+                    if (--length2 == 1)
+                    {
+                        goto Done;
+                    }
+
+                    count2 = length2 - GallopLeft(a[base1 + length1 - 1], t, 0, length2, length2 - 1);
+                    if (count2 != 0)
+                    {
+                        length2 -= count2;
+                        js_memcpy_s(a + base1 + length1 + length2, count2 * sizeof(Var), t + length2, count2 * sizeof(Var));
+                        if (length2 <= 1)
+                        {
+                            goto Done;
+                        }
+                    }
+                    a[base1 + length1 + length2 - 1] = a[base1 + length1 - 1];
+                    if (--length1 == 0)
+                    {
+                        goto Done;
+                    }
+
+                    if (currentMinGallop > 0)
+                    {
+                        currentMinGallop--;
+                    }
+                } while (count1 >= InitialMinGallop || count2 >= InitialMinGallop);
+
+                currentMinGallop += 2;
+            }
+
+        Done:
+            minGallop = currentMinGallop < 1 ? 1 : currentMinGallop;
+        }
+
+        Var* elements;
+        uint32 length;
+        CompareVarsInfo* compareInfo;
+        Recycler* recycler;
+
+        // Scratch buffer for merges; recycler allocated so that elements parked in it stay alive if the
+        // comparator triggers a collection.
+        Var* tmp;
+        uint32 tmpSize;
+
+        uint32 minGallop;
+        uint32 pendingRunCount;
+        Run pendingRuns[MaxPendingRuns];
+    };
 
     void JavascriptArray::Sort(RecyclableObject* compFn)
     {
@@ -6262,7 +6861,7 @@ Case0:
 #ifdef VALIDATE_ARRAY
                     ValidateSegment(startSeg);
 #endif
-                    hybridSort(startSeg->elements, startSeg->length, &cvInfo);
+                    VarTimSort(startSeg->elements, startSeg->length, &cvInfo, recycler).Sort();
                 }
                 else
                 {
@@ -6294,7 +6893,7 @@ Case0:
 
                 if (compFn != nullptr)
                 {
-                    hybridSort(allElements->elements, allElements->length, &cvInfo);
+                    VarTimSort(allElements->elements, allElements->length, &cvInfo, recycler).Sort();
                 }
                 else
                 {
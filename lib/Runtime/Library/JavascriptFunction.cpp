@@ -665,9 +665,8 @@ namespace Js
 #endif
 
 #ifdef DISABLE_SEH
-        // xplat: JavascriptArrayBuffer::AllocWrapper is disabled on cross-platform
-        // (IsValidVirtualBufferLength always returns false).
-        // SEH and ResumeForOutOfBoundsArrayRefs are not needed.
+        // xplat: out of bounds accesses to virtual buffers are resumed from the PAL's
+        // SIGSEGV handler (see ResumeForOutOfBoundsArrayRefsHandler), so SEH is not needed.
         ret = CallRootFunctionInternal(args, scriptContext, inScript);
 #else
         // mark volatile, because otherwise VC will incorrectly optimize away load in the finally block
@@ -2201,6 +2200,10 @@ LABEL1:
         }
 
         ThreadContext* threadContext = ThreadContext::GetContextForCurrentThread();
+        if (threadContext == nullptr)
+        {
+            return false;
+        }
 
         // AV should come from JITed code, since we don't eliminate bound checks in interpreter
         if (!threadContext->IsNativeAddress((Var)exceptionInfo->ContextRecord->Rip))
@@ -2321,6 +2324,13 @@ LABEL1:
 
         return true;
     }
+
+#if ENABLE_FAST_ARRAYBUFFER && !defined(_WIN32)
+    BOOL PALAPI JavascriptFunction::ResumeForOutOfBoundsArrayRefsHandler(PEXCEPTION_POINTERS exceptionInfo)
+    {
+        return ResumeForOutOfBoundsArrayRefs(exceptionInfo->ExceptionRecord->ExceptionCode, exceptionInfo);
+    }
+#endif
 #endif
 
     int JavascriptFunction::CallRootEventFilter(int exceptionCode, PEXCEPTION_POINTERS exceptionInfo)
@@ -215,6 +215,11 @@ namespace Js
             static int CallRootEventFilter(int exceptionCode, PEXCEPTION_POINTERS exceptionInfo);
 #if ENABLE_NATIVE_CODEGEN && defined(_M_X64)
             static bool ResumeForOutOfBoundsArrayRefs(int exceptionCode, PEXCEPTION_POINTERS exceptionInfo);
+#if ENABLE_FAST_ARRAYBUFFER && !defined(_WIN32)
+        public:
+            // Registered with the PAL, which calls it for SIGSEGV before dispatching it as an exception
+            static BOOL PALAPI ResumeForOutOfBoundsArrayRefsHandler(PEXCEPTION_POINTERS exceptionInfo);
+#endif
 #endif
     };
 #if ENABLE_NATIVE_CODEGEN && defined(_M_X64)
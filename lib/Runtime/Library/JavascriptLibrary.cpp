@@ -620,35 +620,16 @@ namespace Js
             webAssemblyTableType = DynamicType::New(scriptContext, TypeIds_WebAssemblyTable, webAssemblyTablePrototype, nullptr, NullTypeHandler<false>::GetDefaultInstance(), true, true);
         }
 #endif
-        // Initialize Object types
-        for (int16 i = 0; i < PreInitializedObjectTypeCount; i++)
-        {
-            SimplePathTypeHandler * typeHandler =
-                SimplePathTypeHandler::New(
-                    scriptContext,
-                    this->GetRootPath(),
-                    0,
-                    i * InlineSlotCountIncrement,
-                    sizeof(DynamicObject),
-                    true,
-                    true);
-            typeHandler->SetIsInlineSlotCapacityLocked();
-            objectTypes[i] = DynamicType::New(scriptContext, TypeIds_Object, objectPrototype, nullptr, typeHandler, true, true);
-        }
-        for (int16 i = 0; i < PreInitializedObjectTypeCount; i++)
-        {
-            SimplePathTypeHandler * typeHandler =
-                SimplePathTypeHandler::New(
-                    scriptContext,
-                    this->GetRootPath(),
-                    0,
-                    DynamicTypeHandler::GetObjectHeaderInlinableSlotCapacity() + i * InlineSlotCountIncrement,
-                    DynamicTypeHandler::GetOffsetOfObjectHeaderInlineSlots(),
-                    true,
-                    true);
-            typeHandler->SetIsInlineSlotCapacityLocked();
-            objectHeaderInlinedTypes[i] =
-                DynamicType::New(scriptContext, TypeIds_Object, objectPrototype, nullptr, typeHandler, true, true);
+        // Initialize Object types. Only the first of each kind is needed up front, the object literal types with more
+        // inline slots are created when a literal first asks for them (see GetObjectLiteralType).
+        objectTypes[0] = CreateObjectLiteralType(0, sizeof(DynamicObject));
+        objectHeaderInlinedTypes[0] = CreateObjectLiteralType(
+            DynamicTypeHandler::GetObjectHeaderInlinableSlotCapacity(),
+            DynamicTypeHandler::GetOffsetOfObjectHeaderInlineSlots());
+        for (int16 i = 1; i < PreInitializedObjectTypeCount; i++)
+        {
+            objectTypes[i] = nullptr;
+            objectHeaderInlinedTypes[i] = nullptr;
         }
 
         // Initialize regex types
@@ -711,6 +692,21 @@ namespace Js
 #endif
     }
 
+    DynamicType * JavascriptLibrary::CreateObjectLiteralType(uint16 inlineSlotCapacity, uint16 offsetOfInlineSlots)
+    {
+        SimplePathTypeHandler * typeHandler =
+            SimplePathTypeHandler::New(
+                scriptContext,
+                this->GetRootPath(),
+                0,
+                inlineSlotCapacity,
+                offsetOfInlineSlots,
+                true,
+                true);
+        typeHandler->SetIsInlineSlotCapacityLocked();
+        return DynamicType::New(scriptContext, TypeIds_Object, objectPrototype, nullptr, typeHandler, true, true);
+    }
+
     void JavascriptLibrary::InitializeGeneratorFunction(DynamicObject *function, DeferredTypeHandlerBase * typeHandler, DeferredInitializeMode mode)
     {
         bool isAnonymousFunction = JavascriptGeneratorFunction::FromVar(function)->IsAnonymousFunction();
@@ -2591,7 +2587,8 @@ namespace Js
 
     void JavascriptLibrary::InitializeComplexThings()
     {
-        emptyRegexPattern = RegexHelper::CompileDynamic(scriptContext, _u(""), 0, _u(""), 0, false);
+        // The empty regex is compiled when it is first needed, see GetEmptyRegexPattern
+        emptyRegexPattern = nullptr;
 
         Recycler *const recycler = GetRecycler();
 
@@ -2605,7 +2602,8 @@ namespace Js
         // Instead, we just create an ordinary object prototype for RegExp.prototype in InitializePrototypes.
         if (!scriptConfig->IsES6PrototypeChain() && regexPrototype == nullptr)
         {
-            regexPrototype = RecyclerNew(recycler, JavascriptRegExp, emptyRegexPattern,
+            UnifiedRegex::RegexPattern * emptyPattern = GetEmptyRegexPattern();
+            regexPrototype = RecyclerNew(recycler, JavascriptRegExp, emptyPattern,
                 DynamicType::New(scriptContext, TypeIds_RegEx, objectPrototype, nullptr,
                 DeferredTypeHandler<InitializeRegexPrototype, DefaultDeferredTypeFilter, true>::GetDefaultInstance()));
         }
@@ -5137,9 +5135,19 @@ namespace Js
         return LiteralString::CreateEmptyString(stringTypeStatic);
     }
 
+    UnifiedRegex::RegexPattern * JavascriptLibrary::GetEmptyRegexPattern()
+    {
+        if (emptyRegexPattern == nullptr)
+        {
+            emptyRegexPattern = RegexHelper::CompileDynamic(scriptContext, _u(""), 0, _u(""), 0, false);
+        }
+        return emptyRegexPattern;
+    }
+
     JavascriptRegExp* JavascriptLibrary::CreateEmptyRegExp()
     {
-        return RecyclerNew(scriptContext->GetRecycler(), JavascriptRegExp, emptyRegexPattern,
+        UnifiedRegex::RegexPattern * emptyPattern = GetEmptyRegexPattern();
+        return RecyclerNew(scriptContext->GetRecycler(), JavascriptRegExp, emptyPattern,
                            this->GetRegexType());
     }
 
@@ -5853,26 +5861,34 @@ namespace Js
 
     DynamicType * JavascriptLibrary::GetObjectLiteralType(uint16 requestedInlineSlotCapacity)
     {
-        if (requestedInlineSlotCapacity <= MaxPreInitializedObjectTypeInlineSlotCount)
-        {
-            return objectTypes[DynamicTypeHandler::RoundUpInlineSlotCapacity(requestedInlineSlotCapacity) / InlineSlotCountIncrement];
-        }
-        else
+        const uint index = requestedInlineSlotCapacity <= MaxPreInitializedObjectTypeInlineSlotCount
+            ? DynamicTypeHandler::RoundUpInlineSlotCapacity(requestedInlineSlotCapacity) / InlineSlotCountIncrement
+            : PreInitializedObjectTypeCount - 1;
+
+        if (objectTypes[index] == nullptr)
         {
-            return objectTypes[PreInitializedObjectTypeCount - 1];
+            objectTypes[index] = CreateObjectLiteralType((uint16)(index * InlineSlotCountIncrement), sizeof(DynamicObject));
         }
+        return objectTypes[index];
     }
 
     DynamicType * JavascriptLibrary::GetObjectHeaderInlinedLiteralType(uint16 requestedInlineSlotCapacity)
     {
         Assert(requestedInlineSlotCapacity <= MaxPreInitializedObjectHeaderInlinedTypeInlineSlotCount);
 
-        return
-            objectHeaderInlinedTypes[
-                (
-                    DynamicTypeHandler::RoundUpObjectHeaderInlinedInlineSlotCapacity(requestedInlineSlotCapacity) -
-                    DynamicTypeHandler::GetObjectHeaderInlinableSlotCapacity()
-                    ) / InlineSlotCountIncrement];
+        const uint index =
+            (
+                DynamicTypeHandler::RoundUpObjectHeaderInlinedInlineSlotCapacity(requestedInlineSlotCapacity) -
+                DynamicTypeHandler::GetObjectHeaderInlinableSlotCapacity()
+                ) / InlineSlotCountIncrement;
+
+        if (objectHeaderInlinedTypes[index] == nullptr)
+        {
+            objectHeaderInlinedTypes[index] = CreateObjectLiteralType(
+                (uint16)(DynamicTypeHandler::GetObjectHeaderInlinableSlotCapacity() + index * InlineSlotCountIncrement),
+                DynamicTypeHandler::GetOffsetOfObjectHeaderInlineSlots());
+        }
+        return objectHeaderInlinedTypes[index];
     }
 
     HeapArgumentsObject* JavascriptLibrary::CreateHeapArguments(Var frameObj, uint32 formalCount, bool isStrictMode)
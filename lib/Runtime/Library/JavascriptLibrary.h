@@ -842,7 +842,7 @@ namespace Js
         JavascriptFunction* GetDebugObjectNonUserGetterFunction() const { return debugObjectNonUserGetterFunction; }
         JavascriptFunction* GetDebugObjectNonUserSetterFunction() const { return debugObjectNonUserSetterFunction; }
 
-        UnifiedRegex::RegexPattern * GetEmptyRegexPattern() const { return emptyRegexPattern; }
+        UnifiedRegex::RegexPattern * GetEmptyRegexPattern();
         JavascriptFunction* GetRegexExecFunction() const { return regexExecFunction; }
         JavascriptFunction* GetRegexFlagsGetterFunction() const { return regexFlagsGetterFunction; }
         JavascriptFunction* GetRegexGlobalGetterFunction() const { return regexGlobalGetterFunction; }
@@ -1173,6 +1173,7 @@ namespace Js
 
         void InitializePrototypes();
         void InitializeTypes();
+        DynamicType * CreateObjectLiteralType(uint16 inlineSlotCapacity, uint16 offsetOfInlineSlots);
         void InitializeGlobal(GlobalObject * globalObject);
         static void PrecalculateArrayAllocationBuckets();
 
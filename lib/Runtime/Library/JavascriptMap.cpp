@@ -14,7 +14,7 @@ namespace Js
     JavascriptMap* JavascriptMap::New(ScriptContext* scriptContext)
     {
         JavascriptMap* map = scriptContext->GetLibrary()->CreateMap();
-        map->map = RecyclerNew(scriptContext->GetRecycler(), MapDataMap, scriptContext->GetRecycler());
+        map->map = RecyclerNew(scriptContext->GetRecycler(), MapDataTable, scriptContext->GetRecycler());
 
         return map;
     }
@@ -31,9 +31,9 @@ namespace Js
         return static_cast<JavascriptMap *>(RecyclableObject::FromVar(aValue));
     }
 
-    JavascriptMap::MapDataList::Iterator JavascriptMap::GetIterator()
+    JavascriptMap::MapDataTable::Iterator JavascriptMap::GetIterator()
     {
-        return list.GetIterator();
+        return map->GetIterator();
     }
 
     Var JavascriptMap::NewInstance(RecyclableObject* function, CallInfo callInfo, ...)
@@ -83,7 +83,7 @@ namespace Js
             JavascriptError::ThrowTypeErrorVar(scriptContext, JSERR_ObjectIsAlreadyInitialized, _u("Map"), _u("Map"));
         }
 
-        mapObject->map = RecyclerNew(scriptContext->GetRecycler(), MapDataMap, scriptContext->GetRecycler());
+        mapObject->map = RecyclerNew(scriptContext->GetRecycler(), MapDataTable, scriptContext->GetRecycler());
 
         if (iter != nullptr)
         {
@@ -340,27 +340,20 @@ namespace Js
 
     void JavascriptMap::Clear()
     {
-        list.Clear();
         map->Clear();
     }
 
     bool JavascriptMap::Delete(Var key)
     {
-        if (map->ContainsKey(key))
-        {
-            MapDataNode* node = map->Item(key);
-            list.Remove(node);
-            return map->Remove(key);
-        }
-        return false;
+        return map->Remove(key);
     }
 
     bool JavascriptMap::Get(Var key, Var* value)
     {
-        if (map->ContainsKey(key))
+        MapDataKeyValuePair* entry = map->Find(key);
+        if (entry != nullptr)
         {
-            MapDataNode* node = map->Item(key);
-            *value = node->data.Value();
+            *value = entry->Value();
             return true;
         }
         return false;
@@ -373,16 +366,11 @@ namespace Js
 
     void JavascriptMap::Set(Var key, Var value)
     {
-        if (map->ContainsKey(key))
-        {
-            MapDataNode* node = map->Item(key);
-            node->data = MapDataKeyValuePair(key, value);
-        }
-        else
+        MapDataKeyValuePair* entry = map->FindOrAdd(MapDataKeyValuePair(key, value));
+        if (entry != nullptr)
         {
-            MapDataKeyValuePair pair(key, value);
-            MapDataNode* node = list.Append(pair, GetScriptContext()->GetRecycler());
-            map->Add(key, node);
+            // An existing entry keeps its original key
+            *entry = MapDataKeyValuePair(entry->Key(), value);
         }
     }
 
@@ -450,7 +438,7 @@ namespace Js
     JavascriptMap* JavascriptMap::CreateForSnapshotRestore(ScriptContext* ctx)
     {
         JavascriptMap* res = ctx->GetLibrary()->CreateMap();
-        res->map = RecyclerNew(ctx->GetRecycler(), MapDataMap, ctx->GetRecycler());
+        res->map = RecyclerNew(ctx->GetRecycler(), MapDataTable, ctx->GetRecycler());
 
         return res;
     }
@@ -14,7 +14,7 @@ namespace Js
     JavascriptSet* JavascriptSet::New(ScriptContext* scriptContext)
     {
         JavascriptSet* set = scriptContext->GetLibrary()->CreateSet();
-        set->set = RecyclerNew(scriptContext->GetRecycler(), SetDataSet, scriptContext->GetRecycler());
+        set->set = RecyclerNew(scriptContext->GetRecycler(), SetDataTable, scriptContext->GetRecycler());
 
         return set;
     }
@@ -31,9 +31,9 @@ namespace Js
         return static_cast<JavascriptSet *>(RecyclableObject::FromVar(aValue));
     }
 
-    JavascriptSet::SetDataList::Iterator JavascriptSet::GetIterator()
+    JavascriptSet::SetDataTable::Iterator JavascriptSet::GetIterator()
     {
-        return list.GetIterator();
+        return set->GetIterator();
     }
 
     Var JavascriptSet::NewInstance(RecyclableObject* function, CallInfo callInfo, ...)
@@ -84,7 +84,7 @@ namespace Js
         }
 
 
-        setObject->set = RecyclerNew(scriptContext->GetRecycler(), SetDataSet, scriptContext->GetRecycler());
+        setObject->set = RecyclerNew(scriptContext->GetRecycler(), SetDataTable, scriptContext->GetRecycler());
 
         if (iter != nullptr)
         {
@@ -287,30 +287,17 @@ namespace Js
 
     void JavascriptSet::Add(Var value)
     {
-        if (!set->ContainsKey(value))
-        {
-            SetDataNode* node = list.Append(value, GetScriptContext()->GetRecycler());
-            set->Add(value, node);
-        }
+        set->FindOrAdd(value);
     }
 
     void JavascriptSet::Clear()
     {
-        // TODO: (Consider) Should we clear the set here and leave it as large as it has grown, or
-        // toss it away and create a new empty set, letting it grow as needed?
-        list.Clear();
         set->Clear();
     }
 
     bool JavascriptSet::Delete(Var value)
     {
-        if (set->ContainsKey(value))
-        {
-            SetDataNode* node = set->Item(value);
-            list.Remove(node);
-            return set->Remove(value);
-        }
-        return false;
+        return set->Remove(value);
     }
 
     bool JavascriptSet::Has(Var value)
@@ -371,7 +358,7 @@ namespace Js
     JavascriptSet* JavascriptSet::CreateForSnapshotRestore(ScriptContext* ctx)
     {
         JavascriptSet* res = ctx->GetLibrary()->CreateSet();
-        res->set = RecyclerNew(ctx->GetRecycler(), SetDataSet, ctx->GetRecycler());
+        res->set = RecyclerNew(ctx->GetRecycler(), SetDataTable, ctx->GetRecycler());
 
         return res;
     }
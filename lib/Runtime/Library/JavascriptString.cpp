@@ -183,12 +183,18 @@ namespace Js
 
     JavascriptString::JavascriptString(StaticType * type)
         : RecyclableObject(type), m_charLength(0), m_pszValue(0)
+#ifdef TARGET_64
+        , m_hashCode(0)
+#endif
     {
         Assert(type->GetTypeId() == TypeIds_String);
     }
 
     JavascriptString::JavascriptString(StaticType * type, charcount_t charLength, const char16* szValue)
         : RecyclableObject(type), m_charLength(charLength), m_pszValue(szValue)
+#ifdef TARGET_64
+        , m_hashCode(0)
+#endif
     {
         Assert(type->GetTypeId() == TypeIds_String);
         AssertMsg(IsValidCharCount(charLength), "String length is out of range");
@@ -218,11 +224,41 @@ namespace Js
             JavascriptExceptionOperators::ThrowOutOfMemory(this->GetScriptContext());
         }
         m_charLength = newLength;
+#ifdef TARGET_64
+        m_hashCode = 0;
+#endif
     }
 
     void JavascriptString::SetBuffer(const char16* buffer)
     {
         m_pszValue = buffer;
+#ifdef TARGET_64
+        m_hashCode = 0;
+#endif
+    }
+
+    // The cached hash code lives in the padding after m_charLength on 64-bit, make sure it doesn't grow the string
+    CompileAssert(sizeof(JavascriptString) == sizeof(RecyclableObject) + 2 * sizeof(void *));
+
+    uint JavascriptString::GetHashCode()
+    {
+#ifdef TARGET_64
+        // Stored off by one so that a computed hash of 0 is cached too; only 0xFFFFFFFF wraps to 0 and is recomputed
+        uint hashCode = m_hashCode - 1;
+        if (m_hashCode == 0)
+        {
+            // Flatten first, which may reset the cached hash code
+            const char16* buffer = this->GetString();
+            hashCode = JsUtil::CharacterBuffer<char16>::StaticGetHashCode(buffer, this->GetLength());
+            m_hashCode = hashCode + 1;
+        }
+
+        Assert(hashCode == (uint)JsUtil::CharacterBuffer<char16>::StaticGetHashCode(this->UnsafeGetBuffer(), this->GetLength()));
+        return hashCode;
+#else
+        const char16* buffer = this->GetString();
+        return JsUtil::CharacterBuffer<char16>::StaticGetHashCode(buffer, this->GetLength());
+#endif
     }
 
     bool JavascriptString::IsValidIndexValue(charcount_t idx) const
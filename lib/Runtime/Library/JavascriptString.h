@@ -56,6 +56,9 @@ namespace Js
     private:
         const char16* m_pszValue;         // Flattened, '\0' terminated contents
         charcount_t m_charLength;          // Length in characters, not including '\0'.
+#ifdef TARGET_64
+        uint m_hashCode;                   // Cached hash of the contents plus one, 0 if not computed yet. Only kept where it fits in the padding.
+#endif
 
         static const charcount_t MaxCharLength = INT_MAX - 1;  // Max number of chars not including '\0'.
 
@@ -75,6 +78,7 @@ namespace Js
         const char16* UnsafeGetBuffer() const;
         LPCWSTR GetSzCopy(ArenaAllocator* alloc);   // Copy to an Arena
         const char16* GetString(); // Get string, may not be NULL terminated
+        uint GetHashCode();        // Same as CharacterBuffer::StaticGetHashCode of the contents, cached on 64-bit
 
         // NumberUtil::FIntRadStrToDbl and parts of GlobalObject::EntryParseInt were refactored into ToInteger
         Var ToInteger(int radix = 0);
@@ -228,6 +232,13 @@ namespace Js
             return offsetof(JavascriptString, m_charLength);
         }
 
+#ifdef TARGET_64
+        static uint32 GetOffsetOfHashCode()
+        {
+            return offsetof(JavascriptString, m_hashCode);
+        }
+#endif
+
 
         class EntryInfo
         {
@@ -392,7 +403,7 @@ namespace Js
 
         inline static uint GetHashCode(JavascriptString * str)
         {
-            return JsUtil::CharacterBuffer<WCHAR>::StaticGetHashCode(str->GetString(), str->GetLength());
+            return str->GetHashCode();
         }
     };
 
@@ -420,6 +431,6 @@ struct DefaultComparer<Js::JavascriptString*>
 
     inline static uint GetHashCode(Js::JavascriptString * pStr)
     {
-        return JsUtil::CharacterBuffer<char16>::StaticGetHashCode(pStr->GetString(), pStr->GetLength());
+        return pStr->GetHashCode();
     }
 };
@@ -0,0 +1,287 @@
+//-------------------------------------------------------------------------------------------------------
+// Copyright (C) Microsoft. All rights reserved.
+// Licensed under the MIT license. See LICENSE.txt file in the project root for full license information.
+//-------------------------------------------------------------------------------------------------------
+#pragma once
+
+// This is the ordered hash table backing ES6 Map and Set objects. Entries are
+// stored contiguously in insertion order and chained per bucket by index, so
+// an insert is a single append and a lookup walks a short chain within one
+// array instead of going through a dictionary node and a list node for every
+// entry. Deleted entries are left behind as holes until the next rehash,
+// which compacts them away.
+//
+// Iterators must stay valid no matter what modifications are made to the
+// table during iteration, without the table having to track them. An
+// iterator holds the block of entries it is walking and a position in it.
+// Blocks are never reused: when the table is rehashed or cleared it moves to
+// a new block and links the old block to it. An iterator that finds its block
+// retired maps its position into the successor (discounting the holes in
+// front of it, or starting over after a clear) and continues from there.
+
+namespace Js
+{
+    template <typename TData>
+    class MapOrSetDataTable
+    {
+    private:
+        struct Entry
+        {
+            TData data;
+            hash_t hash;
+            uint32 next;        // 1-based index of the next entry in the same bucket, 0 ends the chain
+        };
+
+        class EntryBlock
+        {
+        public:
+            EntryBlock* successor;
+            Entry* entries;
+            uint32 capacity;
+            uint32 count;       // number of entries appended, holes included
+            bool cleared;
+
+            EntryBlock(Entry* entries, uint32 capacity) :
+                successor(nullptr), entries(entries), capacity(capacity), count(0), cleared(false) { }
+
+            uint32 CountLiveEntriesBefore(uint32 index) const
+            {
+                Assert(index <= count);
+
+                uint32 live = 0;
+                for (uint32 i = 0; i < index; i++)
+                {
+                    if (!IsHole(entries[i].data))
+                    {
+                        live++;
+                    }
+                }
+                return live;
+            }
+        };
+
+        static const uint32 MinCapacity = 8;
+        static const uint32 MaxCapacity = 1 << 30;
+        static const uint32 EntriesPerBucket = 2;
+
+        uint32* buckets;        // 1-based index of the last entry added to each bucket, 0 when empty
+        EntryBlock* block;
+        uint32 bucketMask;
+        uint32 liveCount;
+        Recycler* recycler;
+
+        static Var GetKey(Var data) { return data; }
+        static Var GetKey(const JsUtil::KeyValuePair<Var, Var>& data) { return data.Key(); }
+
+        static bool IsHole(const TData& data) { return GetKey(data) == nullptr; }
+
+        static void MakeHole(Var& data) { data = nullptr; }
+        static void MakeHole(JsUtil::KeyValuePair<Var, Var>& data) { data = JsUtil::KeyValuePair<Var, Var>(nullptr, nullptr); }
+
+        static hash_t GetHashCode(Var key) { return SameValueZeroComparer<Var>::GetHashCode(key); }
+
+        Entry* FindEntry(Var key, hash_t hash) const
+        {
+            for (uint32 i = buckets[hash & bucketMask]; i != 0;)
+            {
+                Entry* entry = &block->entries[i - 1];
+                if (entry->hash == hash && SameValueZeroComparer<Var>::Equals(GetKey(entry->data), key))
+                {
+                    return entry;
+                }
+                i = entry->next;
+            }
+            return nullptr;
+        }
+
+        void Allocate(uint32 capacity, EntryBlock** newBlock, uint32** newBuckets)
+        {
+            Assert(capacity >= MinCapacity && capacity <= MaxCapacity && Math::IsPow2((int32)capacity));
+
+            Entry* entries = RecyclerNewArrayZ(recycler, Entry, capacity);
+            *newBlock = RecyclerNew(recycler, EntryBlock, entries, capacity);
+            *newBuckets = RecyclerNewArrayLeafZ(recycler, uint32, capacity / EntriesPerBucket);
+        }
+
+        void Rehash(uint32 newCapacity)
+        {
+            Assert(newCapacity >= liveCount);
+
+            if (newCapacity > MaxCapacity)
+            {
+                Js::Throw::OutOfMemory();
+            }
+
+            EntryBlock* newBlock;
+            uint32* newBuckets;
+            Allocate(newCapacity, &newBlock, &newBuckets);
+
+            const uint32 newBucketMask = newCapacity / EntriesPerBucket - 1;
+            uint32 count = 0;
+            for (uint32 i = 0; i < block->count; i++)
+            {
+                const Entry& entry = block->entries[i];
+                if (IsHole(entry.data))
+                {
+                    continue;
+                }
+
+                Entry& newEntry = newBlock->entries[count];
+                uint32& bucket = newBuckets[entry.hash & newBucketMask];
+                newEntry.data = entry.data;
+                newEntry.hash = entry.hash;
+                newEntry.next = bucket;
+                bucket = ++count;
+            }
+            Assert(count == liveCount);
+            newBlock->count = count;
+
+            block->successor = newBlock;
+            block = newBlock;
+            buckets = newBuckets;
+            bucketMask = newBucketMask;
+        }
+
+    public:
+        class Iterator
+        {
+        private:
+            EntryBlock* block;
+            uint32 index;       // position just past the current entry
+
+        public:
+            Iterator() : block(nullptr), index(0) { }
+            Iterator(EntryBlock* block) : block(block), index(0) { }
+
+            bool Next()
+            {
+                if (block == nullptr)
+                {
+                    return false;
+                }
+
+                // Catch up with any rehash or clear of the table since the last call
+                while (block->successor != nullptr)
+                {
+                    index = block->cleared ? 0 : block->CountLiveEntriesBefore(index);
+                    block = block->successor;
+                }
+
+                while (index < block->count)
+                {
+                    if (!IsHole(block->entries[index++].data))
+                    {
+                        return true;
+                    }
+                }
+
+                block = nullptr;
+                index = 0;
+                return false;
+            }
+
+            TData& Current()
+            {
+                Assert(block != nullptr && index > 0 && index <= block->count);
+                return block->entries[index - 1].data;
+            }
+        };
+
+        MapOrSetDataTable(Recycler* recycler) : liveCount(0), recycler(recycler)
+        {
+            Allocate(MinCapacity, &block, &buckets);
+            bucketMask = MinCapacity / EntriesPerBucket - 1;
+        }
+
+        uint32 Count() const
+        {
+            return liveCount;
+        }
+
+        bool ContainsKey(Var key) const
+        {
+            return FindEntry(key, GetHashCode(key)) != nullptr;
+        }
+
+        TData* Find(Var key) const
+        {
+            Entry* entry = FindEntry(key, GetHashCode(key));
+            return entry != nullptr ? &entry->data : nullptr;
+        }
+
+        // Appends 'data' unless there is already an entry for its key, in which case
+        // that entry's data is returned instead. The returned pointer is only valid
+        // until the table is next modified.
+        TData* FindOrAdd(const TData& data)
+        {
+            Var key = GetKey(data);
+            Assert(key != nullptr);
+
+            const hash_t hash = GetHashCode(key);
+            Entry* entry = FindEntry(key, hash);
+            if (entry != nullptr)
+            {
+                return &entry->data;
+            }
+
+            if (block->count == block->capacity)
+            {
+                // Grow if the table is at least half full, otherwise compacting the holes left
+                // by deleted entries makes enough room
+                Rehash(liveCount >= block->capacity / 2 ? block->capacity * 2 : block->capacity);
+            }
+
+            uint32& bucket = buckets[hash & bucketMask];
+            entry = &block->entries[block->count];
+            entry->data = data;
+            entry->hash = hash;
+            entry->next = bucket;
+            bucket = ++block->count;
+            liveCount++;
+            return nullptr;
+        }
+
+        bool Remove(Var key)
+        {
+            const hash_t hash = GetHashCode(key);
+            for (uint32* link = &buckets[hash & bucketMask]; *link != 0;)
+            {
+                Entry& entry = block->entries[*link - 1];
+                if (entry.hash == hash && SameValueZeroComparer<Var>::Equals(GetKey(entry.data), key))
+                {
+                    *link = entry.next;
+                    entry.next = 0;
+                    MakeHole(entry.data);
+                    liveCount--;
+
+                    if (block->capacity > MinCapacity && liveCount < block->capacity / 4)
+                    {
+                        Rehash(block->capacity / 2);
+                    }
+                    return true;
+                }
+                link = &entry.next;
+            }
+            return false;
+        }
+
+        void Clear()
+        {
+            EntryBlock* newBlock;
+            uint32* newBuckets;
+            Allocate(MinCapacity, &newBlock, &newBuckets);
+
+            block->cleared = true;
+            block->successor = newBlock;
+            block = newBlock;
+            buckets = newBuckets;
+            bucketMask = MinCapacity / EntriesPerBucket - 1;
+            liveCount = 0;
+        }
+
+        Iterator GetIterator()
+        {
+            return Iterator(block);
+        }
+    };
+}
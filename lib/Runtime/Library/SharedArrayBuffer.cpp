@@ -229,7 +229,7 @@ namespace Js
         SharedArrayBuffer * sab = SharedArrayBuffer::FromVar(object);
         SharedContents * contents = sab->GetSharedContents();
 
-#if _WIN64
+#if ENABLE_FAST_ARRAYBUFFER
         if (sab->IsValidVirtualBufferLength(contents->bufferLength))
         {
             return HeapNew(SharableState, contents, ArrayBufferAllocationType::MemAlloc);
@@ -405,7 +405,7 @@ namespace Js
 
     bool JavascriptSharedArrayBuffer::IsValidVirtualBufferLength(uint length)
     {
-#if _WIN64
+#if ENABLE_FAST_ARRAYBUFFER
         /*
         1. length >= 2^16
         2. length is power of 2 or (length > 2^24 and length is multiple of 2^24)
@@ -435,7 +435,7 @@ namespace Js
         uint ref = InterlockedDecrement(&sharedContents->refCount);
         if (ref == 0)
         {
-#if _WIN64
+#if ENABLE_FAST_ARRAYBUFFER
                 //AsmJS Virtual Free
                 //TOD - see if isBufferCleared need to be added for free too
                 if (IsValidVirtualBufferLength(sharedContents->bufferLength) && !sharedContents->isBufferCleared)
@@ -0,0 +1,170 @@
+//-------------------------------------------------------------------------------------------------------
+// Copyright (C) Microsoft. All rights reserved.
+// Licensed under the MIT license. See LICENSE.txt file in the project root for full license information.
+//-------------------------------------------------------------------------------------------------------
+
+#include "RuntimePlatformAgnosticPch.h"
+#include "CommonPal.h"
+
+#include <errno.h>
+#include <pthread.h>
+#include <sched.h>
+#include <signal.h>
+#include <string.h>
+#include <sys/time.h>
+#include <time.h>
+#ifdef __linux__
+#include <sys/syscall.h>
+#include <unistd.h>
+
+// Older glibc headers don't name the thread id field of sigevent
+#ifndef sigev_notify_thread_id
+#define sigev_notify_thread_id _sigev_un._tid
+#endif
+#endif
+
+namespace PlatformAgnostic
+{
+    static SamplingTimer::TickCallback volatile tickCallback = nullptr;
+    static void * volatile tickCallbackState = nullptr;
+
+    // The thread that started the timer, whose ticks are the only ones passed on
+    static pthread_t sampledThread;
+
+    // Number of signal handlers running right now, on any thread
+    static volatile LONG runningHandlerCount = 0;
+
+    static bool isHandlerInstalled = false;
+    static bool isTimerStarted = false;
+
+#ifdef __linux__
+    static timer_t timer;
+#endif
+
+    static void OnProfilingSignal(int signal, siginfo_t * info, void * context)
+    {
+        const int savedErrno = errno;
+
+        InterlockedIncrement(&runningHandlerCount);
+        SamplingTimer::TickCallback callback = tickCallback;
+        if (callback != nullptr && pthread_equal(pthread_self(), sampledThread))
+        {
+            callback(tickCallbackState);
+        }
+        InterlockedDecrement(&runningHandlerCount);
+
+        errno = savedErrno;
+    }
+
+    static bool StartTimer(unsigned int intervalMicroseconds)
+    {
+        struct timespec interval;
+        interval.tv_sec = intervalMicroseconds / 1000000;
+        interval.tv_nsec = (intervalMicroseconds % 1000000) * 1000;
+
+#ifdef __linux__
+        // Counts the CPU time of this thread only, and signals this thread only
+        clockid_t clock;
+        if (pthread_getcpuclockid(pthread_self(), &clock) != 0)
+        {
+            return false;
+        }
+
+        struct sigevent event;
+        memset(&event, 0, sizeof(event));
+        event.sigev_notify = SIGEV_THREAD_ID;
+        event.sigev_signo = SIGPROF;
+        event.sigev_notify_thread_id = (pid_t)syscall(SYS_gettid);
+        if (timer_create(clock, &event, &timer) != 0)
+        {
+            return false;
+        }
+
+        struct itimerspec timerSpec;
+        timerSpec.it_interval = interval;
+        timerSpec.it_value = interval;
+        if (timer_settime(timer, 0, &timerSpec, nullptr) != 0)
+        {
+            timer_delete(timer);
+            return false;
+        }
+        return true;
+#else
+        // Without per thread timers, the process CPU time ticks and the signal goes to any of its threads. The
+        // handler drops the ticks that land on other threads, so the busier they are, the fewer samples are taken.
+        struct itimerval timerValue;
+        timerValue.it_interval.tv_sec = interval.tv_sec;
+        timerValue.it_interval.tv_usec = interval.tv_nsec / 1000;
+        timerValue.it_value = timerValue.it_interval;
+        return setitimer(ITIMER_PROF, &timerValue, nullptr) == 0;
+#endif
+    }
+
+    static void StopTimer()
+    {
+#ifdef __linux__
+        timer_delete(timer);
+#else
+        struct itimerval timerValue;
+        memset(&timerValue, 0, sizeof(timerValue));
+        setitimer(ITIMER_PROF, &timerValue, nullptr);
+#endif
+    }
+
+    bool SamplingTimer::Start(unsigned int intervalMicroseconds, TickCallback callback, void * state)
+    {
+        Assert(intervalMicroseconds != 0);
+        Assert(callback != nullptr);
+
+        Stop();
+
+        // The handler stays installed once the timer was started: a SIGPROF that is already pending when the
+        // timer is stopped would otherwise terminate the process. It ignores the ticks while no one owns the timer.
+        if (!isHandlerInstalled)
+        {
+            struct sigaction action;
+            memset(&action, 0, sizeof(action));
+            action.sa_sigaction = OnProfilingSignal;
+            action.sa_flags = SA_SIGINFO | SA_RESTART;
+            sigemptyset(&action.sa_mask);
+            if (sigaction(SIGPROF, &action, nullptr) != 0)
+            {
+                return false;
+            }
+            isHandlerInstalled = true;
+        }
+
+        sampledThread = pthread_self();
+        tickCallbackState = state;
+        tickCallback = callback;
+
+        if (!StartTimer(intervalMicroseconds))
+        {
+            tickCallback = nullptr;
+            return false;
+        }
+
+        isTimerStarted = true;
+        return true;
+    }
+
+    void SamplingTimer::Stop()
+    {
+        if (!isTimerStarted)
+        {
+            return;
+        }
+
+        StopTimer();
+        isTimerStarted = false;
+
+        // A handler that already read the callback may still be calling it on another thread
+        tickCallback = nullptr;
+        MemoryBarrier();
+        while (runningHandlerCount != 0)
+        {
+            sched_yield();
+        }
+        tickCallbackState = nullptr;
+    }
+} // namespace PlatformAgnostic
@@ -0,0 +1,51 @@
+//-------------------------------------------------------------------------------------------------------
+// Copyright (C) Microsoft. All rights reserved.
+// Licensed under the MIT license. See LICENSE.txt file in the project root for full license information.
+//-------------------------------------------------------------------------------------------------------
+
+#include "RuntimePlatformAgnosticPch.h"
+#include "Common.h"
+
+namespace PlatformAgnostic
+{
+    static HANDLE timer = nullptr;
+    static SamplingTimer::TickCallback tickCallback = nullptr;
+    static void * tickCallbackState = nullptr;
+
+    static VOID CALLBACK OnTimer(PVOID parameter, BOOLEAN timerOrWaitFired)
+    {
+        tickCallback(tickCallbackState);
+    }
+
+    bool SamplingTimer::Start(unsigned int intervalMicroseconds, TickCallback callback, void * state)
+    {
+        Assert(intervalMicroseconds != 0);
+        Assert(callback != nullptr);
+
+        Stop();
+
+        tickCallback = callback;
+        tickCallbackState = state;
+
+        // Timer queue timers have a resolution of a millisecond
+        const DWORD period = max(intervalMicroseconds / 1000, 1u);
+        if (!CreateTimerQueueTimer(&timer, nullptr, OnTimer, nullptr, period, period, WT_EXECUTEINTIMERTHREAD))
+        {
+            timer = nullptr;
+            return false;
+        }
+        return true;
+    }
+
+    void SamplingTimer::Stop()
+    {
+        if (timer == nullptr)
+        {
+            return;
+        }
+
+        // Waits for a callback that is running to return
+        DeleteTimerQueueTimer(nullptr, timer, INVALID_HANDLE_VALUE);
+        timer = nullptr;
+    }
+} // namespace PlatformAgnostic
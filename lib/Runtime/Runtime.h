@@ -150,6 +150,7 @@ namespace Js
     class JavascriptNumberObject;
 
     class ScriptContextProfiler;
+    class SamplingProfiler;
 
     struct RestrictedErrorStrings;
     class JavascriptError;
@@ -483,6 +484,7 @@ enum tagDEBUG_EVENT_INFO_TYPE
 
 #include "Base/StackProber.h"
 #include "Base/ScriptContextProfiler.h"
+#include "Base/SamplingProfiler.h"
 
 #include "Language/EvalMapRecord.h"
 #include "Base/RegexPatternMruMap.h"
@@ -0,0 +1,216 @@
+//-------------------------------------------------------------------------------------------------------
+// Copyright (C) Microsoft. All rights reserved.
+// Licensed under the MIT license. See LICENSE.txt file in the project root for full license information.
+//-------------------------------------------------------------------------------------------------------
+#include "RuntimeTypePch.h"
+
+namespace Js
+{
+    MegamorphicPropertyCache::MegamorphicPropertyCache() : cachedPropertyIds(0)
+    {
+        memset(types, 0, sizeof(types));
+    }
+
+    size_t MegamorphicPropertyCache::ElementIndex(const Type *const type, const PropertyId id)
+    {
+        Assert(type);
+        Assert(id != Constants::NoProperty);
+        CompileAssert((MegamorphicPropertyCache_NumElements & MegamorphicPropertyCache_NumElements - 1) == 0);
+
+        // Types are allocated on PolymorphicInlineCacheShift boundaries, so the low bits carry no information. Spread the
+        // property IDs so that the same property on consecutively allocated types does not collide.
+        return ((((size_t)type) >> PolymorphicInlineCacheShift) ^ ((size_t)id * 0x9E5)) & MegamorphicPropertyCache_NumElements - 1;
+    }
+
+    uint64 MegamorphicPropertyCache::PropertyIdBit(const PropertyId id)
+    {
+        return (uint64)1 << (id & 63);
+    }
+
+    void MegamorphicPropertyCache::ClearElement(const size_t elementIndex)
+    {
+        types[elementIndex] = nullptr;
+        elements[elementIndex].Clear();
+    }
+
+    inline const TypePropertyCacheElement *MegamorphicPropertyCache::TryGetElement(const Type *const type, const PropertyId id) const
+    {
+        const size_t elementIndex = ElementIndex(type, id);
+        if(types[elementIndex] != type || elements[elementIndex].Id() != id)
+        {
+            return nullptr;
+        }
+        return &elements[elementIndex];
+    }
+
+    bool MegamorphicPropertyCache::TryGetProperty(
+        const bool checkMissing,
+        RecyclableObject *const propertyObject,
+        const PropertyId propertyId,
+        Var *const propertyValue,
+        ScriptContext *const requestContext,
+        PropertyCacheOperationInfo *const operationInfo,
+        PropertyValueInfo *const propertyValueInfo)
+    {
+        return
+            TypePropertyCache::TryGetProperty(
+                TryGetElement(propertyObject->GetType(), propertyId),
+                MegamorphicPropertyCachePhase,
+                checkMissing,
+                propertyObject,
+                propertyId,
+                propertyValue,
+                requestContext,
+                operationInfo,
+                propertyValueInfo);
+    }
+
+    bool MegamorphicPropertyCache::TrySetProperty(
+        RecyclableObject *const object,
+        const PropertyId propertyId,
+        Var propertyValue,
+        ScriptContext *const requestContext,
+        PropertyCacheOperationInfo *const operationInfo,
+        PropertyValueInfo *const propertyValueInfo)
+    {
+        return
+            TypePropertyCache::TrySetProperty(
+                TryGetElement(object->GetType(), propertyId),
+                MegamorphicPropertyCachePhase,
+                object,
+                propertyId,
+                propertyValue,
+                requestContext,
+                operationInfo,
+                propertyValueInfo);
+    }
+
+    bool MegamorphicPropertyCache::TryHasProperty(
+        RecyclableObject *const object,
+        const PropertyId propertyId,
+        BOOL *const hasProperty) const
+    {
+        Assert(hasProperty);
+
+        // A cached load says where the property was found, or that it was found nowhere on the prototype chain
+        const TypePropertyCacheElement *const element = TryGetElement(object->GetType(), propertyId);
+        if(!element)
+        {
+            return false;
+        }
+
+    #if DBG_DUMP
+        if(PHASE_TRACE1(MegamorphicPropertyCachePhase))
+        {
+            CacheOperators::TraceCache(
+                static_cast<InlineCache *>(nullptr),
+                _u("MegamorphicPropertyCache has hit"),
+                propertyId,
+                object->GetScriptContext(),
+                object);
+        }
+    #endif
+
+        *hasProperty = !element->IsMissing();
+        Assert(*hasProperty == JavascriptOperators::HasProperty(object, propertyId));
+        return true;
+    }
+
+    void MegamorphicPropertyCache::Cache(
+        Type *const type,
+        const PropertyId id,
+        const PropertyIndex index,
+        const bool isInlineSlot,
+        const bool isSetPropertyAllowed)
+    {
+        const size_t elementIndex = ElementIndex(type, id);
+        types[elementIndex] = type;
+        elements[elementIndex].Cache(id, index, isInlineSlot, isSetPropertyAllowed);
+        cachedPropertyIds |= PropertyIdBit(id);
+    }
+
+    void MegamorphicPropertyCache::Cache(
+        Type *const type,
+        const PropertyId id,
+        const PropertyIndex index,
+        const bool isInlineSlot,
+        const bool isSetPropertyAllowed,
+        const bool isMissing,
+        DynamicObject *const prototypeObjectWithProperty)
+    {
+        Assert(type);
+
+        // The prototype caches of the type are not involved, so the element is not registered with the thread context
+        // the way a TypePropertyCache element is. ThreadContext clears this cache along with them instead.
+        const size_t elementIndex = ElementIndex(type, id);
+        types[elementIndex] = type;
+        elements[elementIndex].Cache(
+            id,
+            index,
+            isInlineSlot,
+            isSetPropertyAllowed,
+            isMissing,
+            prototypeObjectWithProperty);
+        cachedPropertyIds |= PropertyIdBit(id);
+    }
+
+    void MegamorphicPropertyCache::ClearIfPropertyIsOnAPrototype(const PropertyId id)
+    {
+        if(!(cachedPropertyIds & PropertyIdBit(id)))
+        {
+            return;
+        }
+
+        uint64 remainingPropertyIds = 0;
+        for(size_t i = 0; i < MegamorphicPropertyCache_NumElements; ++i)
+        {
+            const TypePropertyCacheElement &element = elements[i];
+            if(element.Id() == id && element.PrototypeObjectWithProperty())
+            {
+                ClearElement(i);
+            }
+            else if(element.Id() != Constants::NoProperty)
+            {
+                remainingPropertyIds |= PropertyIdBit(element.Id());
+            }
+        }
+        cachedPropertyIds = remainingPropertyIds;
+    }
+
+    void MegamorphicPropertyCache::Clear(const PropertyId id)
+    {
+        if(!(cachedPropertyIds & PropertyIdBit(id)))
+        {
+            return;
+        }
+
+        uint64 remainingPropertyIds = 0;
+        for(size_t i = 0; i < MegamorphicPropertyCache_NumElements; ++i)
+        {
+            const TypePropertyCacheElement &element = elements[i];
+            if(element.Id() == id)
+            {
+                ClearElement(i);
+            }
+            else if(element.Id() != Constants::NoProperty)
+            {
+                remainingPropertyIds |= PropertyIdBit(element.Id());
+            }
+        }
+        cachedPropertyIds = remainingPropertyIds;
+    }
+
+    void MegamorphicPropertyCache::Clear()
+    {
+        if(cachedPropertyIds == 0)
+        {
+            return;
+        }
+
+        for(size_t i = 0; i < MegamorphicPropertyCache_NumElements; ++i)
+        {
+            ClearElement(i);
+        }
+        cachedPropertyIds = 0;
+    }
+}
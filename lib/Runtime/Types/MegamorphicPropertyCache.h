@@ -0,0 +1,52 @@
+//-------------------------------------------------------------------------------------------------------
+// Copyright (C) Microsoft. All rights reserved.
+// Licensed under the MIT license. See LICENSE.txt file in the project root for full license information.
+//-------------------------------------------------------------------------------------------------------
+#pragma once
+
+// Must be a power of 2
+#define MegamorphicPropertyCache_NumElements 1024
+
+namespace Js
+{
+    struct PropertyCacheOperationInfo;
+
+    // Per-thread cache of property lookups keyed by (Type, PropertyId), for property access sites that have seen more types
+    // than their polymorphic inline cache can hold. The elements are TypePropertyCacheElements shared by all types, each
+    // tagged with the type it was cached for, so that a type that was seen by some other megamorphic site recently does not
+    // need a type handler lookup. Once the element for the object's type is found, the lookups are TypePropertyCache's.
+    //
+    // The cache does not keep the types or prototype objects alive. It is cleared before every sweep, and elements that
+    // depend on a prototype are cleared when the prototype caches for the property are invalidated.
+    class MegamorphicPropertyCache
+    {
+    private:
+        Type *types[MegamorphicPropertyCache_NumElements];
+        TypePropertyCacheElement elements[MegamorphicPropertyCache_NumElements];
+
+        // One bit per hashed property ID of the cached elements, so that invalidating a property that was never cached
+        // here does not have to look at every element
+        uint64 cachedPropertyIds;
+
+    public:
+        MegamorphicPropertyCache();
+
+    private:
+        static size_t ElementIndex(const Type *const type, const PropertyId id);
+        static uint64 PropertyIdBit(const PropertyId id);
+        void ClearElement(const size_t elementIndex);
+        const TypePropertyCacheElement *TryGetElement(const Type *const type, const PropertyId id) const;
+
+    public:
+        bool TryGetProperty(const bool checkMissing, RecyclableObject *const propertyObject, const PropertyId propertyId, Var *const propertyValue, ScriptContext *const requestContext, PropertyCacheOperationInfo *const operationInfo, PropertyValueInfo *const propertyValueInfo);
+        bool TrySetProperty(RecyclableObject *const object, const PropertyId propertyId, Var propertyValue, ScriptContext *const requestContext, PropertyCacheOperationInfo *const operationInfo, PropertyValueInfo *const propertyValueInfo);
+        bool TryHasProperty(RecyclableObject *const object, const PropertyId propertyId, BOOL *const hasProperty) const;
+
+    public:
+        void Cache(Type *const type, const PropertyId id, const PropertyIndex index, const bool isInlineSlot, const bool isSetPropertyAllowed);
+        void Cache(Type *const type, const PropertyId id, const PropertyIndex index, const bool isInlineSlot, const bool isSetPropertyAllowed, const bool isMissing, DynamicObject *const prototypeObjectWithProperty);
+        void ClearIfPropertyIsOnAPrototype(const PropertyId id);
+        void Clear(const PropertyId id);
+        void Clear();
+    };
+}
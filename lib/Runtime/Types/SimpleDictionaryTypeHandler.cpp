@@ -1238,6 +1238,56 @@ namespace Js
         return true;
     }
 
+    template <typename TPropertyIndex, typename TMapKey, bool IsNotExtensibleSupported>
+    bool SimpleDictionaryTypeHandlerBase<TPropertyIndex, TMapKey, IsNotExtensibleSupported>::TryGetStringKeyedDataProperty(DynamicObject* instance, JavascriptString* propertyNameString, Var* value)
+    {
+        if (!TMapKey_IsJavascriptString<TMapKey>())
+        {
+            return false;
+        }
+
+        JsUtil::CharacterBuffer<WCHAR> propertyName(propertyNameString->GetString(), propertyNameString->GetLength());
+        SimpleDictionaryPropertyDescriptor<TPropertyIndex>* descriptor;
+        if (!propertyMap->TryGetReference(propertyName, &descriptor) ||
+            (descriptor->Attributes & (PropertyDeleted | PropertyLetConstGlobal)) ||
+            descriptor->propertyIndex == NoSlots)
+        {
+            // Not an own property, or not one that lives in a slot. Let the caller look up the prototype chain.
+            return false;
+        }
+
+        *value = instance->GetSlot(descriptor->propertyIndex);
+        return true;
+    }
+
+    template <typename TPropertyIndex, typename TMapKey, bool IsNotExtensibleSupported>
+    bool SimpleDictionaryTypeHandlerBase<TPropertyIndex, TMapKey, IsNotExtensibleSupported>::TrySetStringKeyedDataProperty(DynamicObject* instance, JavascriptString* propertyNameString, Var value)
+    {
+        if (!TMapKey_IsJavascriptString<TMapKey>())
+        {
+            return false;
+        }
+
+        JsUtil::CharacterBuffer<WCHAR> propertyName(propertyNameString->GetString(), propertyNameString->GetLength());
+        SimpleDictionaryPropertyDescriptor<TPropertyIndex>* descriptor;
+        if (!propertyMap->TryGetReference(propertyName, &descriptor) ||
+            (descriptor->Attributes & (PropertyDeleted | PropertyLetConstGlobal | PropertyNoRedecl)) ||
+            !(descriptor->Attributes & PropertyWritable) ||
+            descriptor->propertyIndex == NoSlots ||
+            !descriptor->isInitialized ||
+            descriptor->isFixed ||
+            descriptor->usedAsFixed)
+        {
+            // An own writable data property shadows anything on the prototype chain, so storing to it does not need to look for
+            // setters. Everything else (adds, undeletes, fixed fields) goes through SetPropertyFromDescriptor.
+            return false;
+        }
+
+        SetSlotUnchecked(instance, descriptor->propertyIndex, value);
+        SetPropertyUpdateSideEffect(instance, propertyName, value, SideEffects_Any);
+        return true;
+    }
+
     template <typename TPropertyIndex, typename TMapKey, bool IsNotExtensibleSupported>
     BOOL SimpleDictionaryTypeHandlerBase<TPropertyIndex, TMapKey, IsNotExtensibleSupported>::SetProperty(DynamicObject* instance, JavascriptString* propertyNameString, Var value, PropertyOperationFlags flags, PropertyValueInfo* info)
     {
@@ -105,6 +105,8 @@ namespace Js
         static DynamicType* CreateTypeForNewScObject(ScriptContext* scriptContext, DynamicType* type, const Js::PropertyIdArray *propIds, bool shareType, bool check__proto__);
 
         virtual BOOL IsStringTypeHandler() const override { return PropertyMapKeyTraits<TMapKey>::IsStringTypeHandler(); }
+        virtual bool TryGetStringKeyedDataProperty(DynamicObject* instance, JavascriptString* propertyNameString, Var* value) override;
+        virtual bool TrySetStringKeyedDataProperty(DynamicObject* instance, JavascriptString* propertyNameString, Var value) override;
 
         virtual BOOL IsLockable() const override { return true; }
         virtual BOOL IsSharable() const override { return true; }
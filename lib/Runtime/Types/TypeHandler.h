@@ -393,6 +393,11 @@ namespace Js
 
         virtual BOOL IsStringTypeHandler() const { return false; }
 
+        // Keyed accesses on objects used as hash tables, whose type handler is keyed by JavascriptString. Only an own, plain
+        // data property is handled; anything else returns false and the caller takes the general path.
+        virtual bool TryGetStringKeyedDataProperty(DynamicObject* instance, JavascriptString* propertyNameString, Var* value) { return false; }
+        virtual bool TrySetStringKeyedDataProperty(DynamicObject* instance, JavascriptString* propertyNameString, Var value) { return false; }
+
         virtual BOOL AllPropertiesAreEnumerable() { return false; }
         virtual BOOL IsLockable() const = 0;
         virtual BOOL IsSharable() const = 0;
@@ -71,13 +71,27 @@ namespace Js
         Type *const myParentType)
     {
         Assert(id != Constants::NoProperty);
-        Assert(index != Constants::NoSlot);
         Assert(prototypeObjectWithProperty);
         Assert(myParentType);
 
         if(this->id != id || !this->prototypeObjectWithProperty)
             myParentType->GetScriptContext()->GetThreadContext()->RegisterTypeWithProtoPropertyCache(id, myParentType);
 
+        Cache(id, index, isInlineSlot, isSetPropertyAllowed, isMissing, prototypeObjectWithProperty);
+    }
+
+    void TypePropertyCacheElement::Cache(
+        const PropertyId id,
+        const PropertyIndex index,
+        const bool isInlineSlot,
+        const bool isSetPropertyAllowed,
+        const bool isMissing,
+        DynamicObject *const prototypeObjectWithProperty)
+    {
+        Assert(id != Constants::NoProperty);
+        Assert(index != Constants::NoSlot);
+        Assert(prototypeObjectWithProperty);
+
         this->id = id;
         this->index = index;
         this->isInlineSlot = isInlineSlot;
@@ -104,49 +118,67 @@ namespace Js
         return id & TypePropertyCache_NumElements - 1;
     }
 
+#if DBG_DUMP
+    static void TracePropertyCache(
+        const Phase tracePhase,
+        const char16 *const operation,
+        const PropertyId propertyId,
+        ScriptContext *const requestContext,
+        RecyclableObject *const object)
+    {
+        if(!PHASE_TRACE1(tracePhase))
+            return;
+
+        char16 methodName[64];
+        swprintf_s(methodName, _countof(methodName), _u("%s %s"), PhaseNames[tracePhase], operation);
+        CacheOperators::TraceCache(static_cast<InlineCache *>(nullptr), methodName, propertyId, requestContext, object);
+    }
+#endif
+
     inline bool TypePropertyCache::TryGetIndexForLoad(
+        const TypePropertyCacheElement *const element,
         const bool checkMissing,
         const PropertyId id,
         PropertyIndex *const index,
         bool *const isInlineSlot,
         bool *const isMissing,
-        DynamicObject * *const prototypeObjectWithProperty) const
+        DynamicObject * *const prototypeObjectWithProperty)
     {
         Assert(index);
         Assert(isInlineSlot);
         Assert(isMissing);
         Assert(prototypeObjectWithProperty);
 
-        const TypePropertyCacheElement &element = elements[ElementIndex(id)];
-        if(element.Id() != id || (!checkMissing && element.IsMissing()))
+        if(!element || element->Id() != id || (!checkMissing && element->IsMissing()))
             return false;
 
-        *index = element.Index();
-        *isInlineSlot = element.IsInlineSlot();
-        *isMissing = checkMissing ? element.IsMissing() : false;
-        *prototypeObjectWithProperty = element.PrototypeObjectWithProperty();
+        *index = element->Index();
+        *isInlineSlot = element->IsInlineSlot();
+        *isMissing = checkMissing ? element->IsMissing() : false;
+        *prototypeObjectWithProperty = element->PrototypeObjectWithProperty();
         return true;
     }
 
     inline bool TypePropertyCache::TryGetIndexForStore(
+        const TypePropertyCacheElement *const element,
         const PropertyId id,
         PropertyIndex *const index,
-        bool *const isInlineSlot) const
+        bool *const isInlineSlot)
     {
         Assert(index);
         Assert(isInlineSlot);
 
-        const TypePropertyCacheElement &element = elements[ElementIndex(id)];
-        if(element.Id() != id ||
-            !element.IsSetPropertyAllowed() ||
-            element.PrototypeObjectWithProperty())
+        if(!element ||
+            element->Id() != id ||
+            !element->IsSetPropertyAllowed() ||
+            element->PrototypeObjectWithProperty())
         {
             return false;
         }
 
-        Assert(!element.IsMissing());
-        *index = element.Index();
-        *isInlineSlot = element.IsInlineSlot();
+        Assert(!element->IsMissing());
+        *index = element->Index();
+        *isInlineSlot = element->IsInlineSlot();
         return true;
     }
 
@@ -158,6 +190,50 @@ namespace Js
         ScriptContext *const requestContext,
         PropertyCacheOperationInfo *const operationInfo,
         PropertyValueInfo *const propertyValueInfo)
+    {
+        return
+            TryGetProperty(
+                &elements[ElementIndex(propertyId)],
+                TypePropertyCachePhase,
+                checkMissing,
+                propertyObject,
+                propertyId,
+                propertyValue,
+                requestContext,
+                operationInfo,
+                propertyValueInfo);
+    }
+
+    bool TypePropertyCache::TrySetProperty(
+        RecyclableObject *const object,
+        const PropertyId propertyId,
+        Var propertyValue,
+        ScriptContext *const requestContext,
+        PropertyCacheOperationInfo *const operationInfo,
+        PropertyValueInfo *const propertyValueInfo)
+    {
+        return
+            TrySetProperty(
+                &elements[ElementIndex(propertyId)],
+                TypePropertyCachePhase,
+                object,
+                propertyId,
+                propertyValue,
+                requestContext,
+                operationInfo,
+                propertyValueInfo);
+    }
+
+    bool TypePropertyCache::TryGetProperty(
+        const TypePropertyCacheElement *const element,
+        const Phase tracePhase,
+        const bool checkMissing,
+        RecyclableObject *const propertyObject,
+        const PropertyId propertyId,
+        Var *const propertyValue,
+        ScriptContext *const requestContext,
+        PropertyCacheOperationInfo *const operationInfo,
+        PropertyValueInfo *const propertyValueInfo)
     {
         Assert(propertyValueInfo);
         Assert(propertyValueInfo->GetInlineCache() || propertyValueInfo->GetPolymorphicInlineCache());
@@ -166,6 +242,7 @@ namespace Js
         DynamicObject *prototypeObjectWithProperty;
         bool isInlineSlot, isMissing;
         if(!TryGetIndexForLoad(
+                element,
                 checkMissing,
                 propertyId,
                 &propertyIndex,
@@ -174,15 +251,7 @@ namespace Js
                 &prototypeObjectWithProperty))
         {
         #if DBG_DUMP
-            if(PHASE_TRACE1(TypePropertyCachePhase))
-            {
-                CacheOperators::TraceCache(
-                    static_cast<InlineCache *>(nullptr),
-                    _u("TypePropertyCache get miss"),
-                    propertyId,
-                    requestContext,
-                    propertyObject);
-            }
+            TracePropertyCache(tracePhase, _u("get miss"), propertyId, requestContext, propertyObject);
         #endif
             return false;
         }
@@ -190,15 +259,7 @@ namespace Js
         if(!prototypeObjectWithProperty)
         {
         #if DBG_DUMP
-            if(PHASE_TRACE1(TypePropertyCachePhase))
-            {
-                CacheOperators::TraceCache(
-                    static_cast<InlineCache *>(nullptr),
-                    _u("TypePropertyCache get hit"),
-                    propertyId,
-                    requestContext,
-                    propertyObject);
-            }
+            TracePropertyCache(tracePhase, _u("get hit"), propertyId, requestContext, propertyObject);
         #endif
 
         #if DBG
@@ -247,15 +308,7 @@ namespace Js
         }
 
     #if DBG_DUMP
-        if(PHASE_TRACE1(TypePropertyCachePhase))
-        {
-            CacheOperators::TraceCache(
-                static_cast<InlineCache *>(nullptr),
-                _u("TypePropertyCache get hit prototype"),
-                propertyId,
-                requestContext,
-                propertyObject);
-        }
+        TracePropertyCache(tracePhase, _u("get hit prototype"), propertyId, requestContext, propertyObject);
     #endif
 
     #if DBG
@@ -308,6 +361,8 @@ namespace Js
     }
 
     bool TypePropertyCache::TrySetProperty(
+        const TypePropertyCacheElement *const element,
+        const Phase tracePhase,
         RecyclableObject *const object,
         const PropertyId propertyId,
         Var propertyValue,
@@ -320,32 +375,16 @@ namespace Js
 
         PropertyIndex propertyIndex;
         bool isInlineSlot;
-        if(!TryGetIndexForStore(propertyId, &propertyIndex, &isInlineSlot))
+        if(!TryGetIndexForStore(element, propertyId, &propertyIndex, &isInlineSlot))
         {
         #if DBG_DUMP
-            if(PHASE_TRACE1(TypePropertyCachePhase))
-            {
-                CacheOperators::TraceCache(
-                    static_cast<InlineCache *>(nullptr),
-                    _u("TypePropertyCache set miss"),
-                    propertyId,
-                    requestContext,
-                    object);
-            }
+            TracePropertyCache(tracePhase, _u("set miss"), propertyId, requestContext, object);
         #endif
             return false;
         }
 
     #if DBG_DUMP
-        if(PHASE_TRACE1(TypePropertyCachePhase))
-        {
-            CacheOperators::TraceCache(
-                static_cast<InlineCache *>(nullptr),
-                _u("TypePropertyCache set hit"),
-                propertyId,
-                requestContext,
-                object);
-        }
+        TracePropertyCache(tracePhase, _u("set hit"), propertyId, requestContext, object);
     #endif
 
         Assert(!object->IsFixedProperty(propertyId));
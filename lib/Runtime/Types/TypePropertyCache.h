@@ -36,6 +36,13 @@ namespace Js
         DynamicObject *PrototypeObjectWithProperty() const;
 
         void Cache(const PropertyId id, const PropertyIndex index, const bool isInlineSlot, const bool isSetPropertyAllowed);
+        void Cache(
+            const PropertyId id,
+            const PropertyIndex index,
+            const bool isInlineSlot,
+            const bool isSetPropertyAllowed,
+            const bool isMissing,
+            DynamicObject *const prototypeObjectWithProperty);
         void Cache(
             const PropertyId id,
             const PropertyIndex index,
@@ -54,13 +61,18 @@ namespace Js
 
     private:
         static size_t ElementIndex(const PropertyId id);
-        bool TryGetIndexForLoad(const bool checkMissing, const PropertyId id, PropertyIndex *const index, bool *const isInlineSlot, bool *const isMissing, DynamicObject * *const prototypeObjectWithProperty) const;
-        bool TryGetIndexForStore(const PropertyId id, PropertyIndex *const index, bool *const isInlineSlot) const;
+        static bool TryGetIndexForLoad(const TypePropertyCacheElement *const element, const bool checkMissing, const PropertyId id, PropertyIndex *const index, bool *const isInlineSlot, bool *const isMissing, DynamicObject * *const prototypeObjectWithProperty);
+        static bool TryGetIndexForStore(const TypePropertyCacheElement *const element, const PropertyId id, PropertyIndex *const index, bool *const isInlineSlot);
 
     public:
         bool TryGetProperty(const bool checkMissing, RecyclableObject *const propertyObject, const PropertyId propertyId, Var *const propertyValue, ScriptContext *const requestContext, PropertyCacheOperationInfo *const operationInfo, PropertyValueInfo *const propertyValueInfo);
         bool TrySetProperty(RecyclableObject *const object, const PropertyId propertyId, Var propertyValue, ScriptContext *const requestContext, PropertyCacheOperationInfo *const operationInfo, PropertyValueInfo *const propertyValueInfo);
 
+        // Lookups through an element that applies to the object's type, or null if there is none. MegamorphicPropertyCache
+        // shares its elements among types, and uses these once it has found the element for the object's type.
+        static bool TryGetProperty(const TypePropertyCacheElement *const element, const Phase tracePhase, const bool checkMissing, RecyclableObject *const propertyObject, const PropertyId propertyId, Var *const propertyValue, ScriptContext *const requestContext, PropertyCacheOperationInfo *const operationInfo, PropertyValueInfo *const propertyValueInfo);
+        static bool TrySetProperty(const TypePropertyCacheElement *const element, const Phase tracePhase, RecyclableObject *const object, const PropertyId propertyId, Var propertyValue, ScriptContext *const requestContext, PropertyCacheOperationInfo *const operationInfo, PropertyValueInfo *const propertyValueInfo);
+
     public:
         void Cache(const PropertyId id, const PropertyIndex index, const bool isInlineSlot, const bool isSetPropertyAllowed);
         void Cache(const PropertyId id, const PropertyIndex index, const bool isInlineSlot, const bool isSetPropertyAllowed, const bool isMissing, DynamicObject *const prototypeObjectWithProperty, Type *const myParentType);
@@ -3567,6 +3567,7 @@ SetErrorMode(
 #define MEM_MAPPED                      0x40000
 #define MEM_TOP_DOWN                    0x100000
 #define MEM_WRITE_WATCH                 0x200000
+#define MEM_LARGE_PAGES                 0x20000000
 #define MEM_RESERVE_EXECUTABLE          0x40000000 // reserve memory using executable memory allocator
 
 PALIMPORT
@@ -3835,6 +3836,10 @@ GetModuleHandleExW(
 #define GetModuleHandleEx GetModuleHandleExW
 #endif
 
+#define GET_MODULE_HANDLE_EX_FLAG_PIN                 0x00000001
+#define GET_MODULE_HANDLE_EX_FLAG_UNCHANGED_REFCOUNT  0x00000002
+#define GET_MODULE_HANDLE_EX_FLAG_FROM_ADDRESS        0x00000004
+
 // Get base address of the module containing a given symbol
 PALAPI
 LPCVOID
@@ -3941,6 +3946,12 @@ VirtualQueryEx(
          OUT PMEMORY_BASIC_INFORMATION lpBuffer,
          IN SIZE_T dwLength);
 
+PALIMPORT
+SIZE_T
+PALAPI
+GetLargePageMinimum(
+         VOID);
+
 PALIMPORT
 BOOL
 PALAPI
@@ -6068,6 +6079,8 @@ RtlCaptureContext(
   OUT PCONTEXT ContextRecord
 );
 
+#define WRITE_WATCH_FLAG_RESET 0x01
+
 PALIMPORT
 UINT
 PALAPI
@@ -7142,6 +7155,20 @@ PALAPI
 PAL_SetHardwareExceptionHandler(
     IN PHARDWARE_EXCEPTION_HANDLER exceptionHandler);
 
+//
+// Access violations are passed to this handler before they are dispatched
+// as exceptions. The handler can fix up the context record and return TRUE
+// to resume execution with it, like an exception filter returning
+// EXCEPTION_CONTINUE_EXECUTION.
+//
+typedef BOOL (PALAPI *PACCESS_VIOLATION_RESUME_HANDLER)(PEXCEPTION_POINTERS pointers);
+
+PALIMPORT
+VOID
+PALAPI
+PAL_SetAccessViolationResumeHandler(
+    IN PACCESS_VIOLATION_RESUME_HANDLER resumeHandler);
+
 //
 // This holder is used to indicate that a hardware
 // exception should be raised as a C++ exception
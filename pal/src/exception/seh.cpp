@@ -57,6 +57,7 @@ const UINT RESERVED_SEH_BIT = 0x800000;
 /* Internal variables definitions **********************************************/
 
 PHARDWARE_EXCEPTION_HANDLER g_hardwareExceptionHandler = NULL;
+PACCESS_VIOLATION_RESUME_HANDLER g_accessViolationResumeHandler = NULL;
 
 /* Internal function definitions **********************************************/
 
@@ -133,6 +134,45 @@ PAL_SetHardwareExceptionHandler(
     g_hardwareExceptionHandler = exceptionHandler;
 }
 
+/*++
+Function:
+    PAL_SetAccessViolationResumeHandler
+
+    Register a handler that can resume execution after an access violation.
+
+Parameters:
+    resumeHandler - resume handler
+
+Return value:
+    None
+--*/
+VOID
+PALAPI
+PAL_SetAccessViolationResumeHandler(
+    IN PACCESS_VIOLATION_RESUME_HANDLER resumeHandler)
+{
+    g_accessViolationResumeHandler = resumeHandler;
+}
+
+/*++
+Function:
+    SEHTryResumeAccessViolation
+
+    Give the registered resume handler a chance to handle an access violation.
+
+Parameters:
+    PEXCEPTION_POINTERS pointers
+
+Return value:
+    TRUE if execution should resume with the (possibly updated) context record
+--*/
+BOOL
+SEHTryResumeAccessViolation(PEXCEPTION_POINTERS pointers)
+{
+    PACCESS_VIOLATION_RESUME_HANDLER resumeHandler = g_accessViolationResumeHandler;
+    return resumeHandler != NULL && resumeHandler(pointers);
+}
+
 /*++
 Function:
     SEHProcessException
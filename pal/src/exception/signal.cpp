@@ -68,6 +68,9 @@ static void sigbus_handler(int code, siginfo_t *siginfo, void *context);
 
 static void common_signal_handler(PEXCEPTION_POINTERS pointers, int code, 
                                   native_context_t *ucontext);
+#if ENABLE_FAST_ARRAYBUFFER
+static BOOL resume_access_violation(siginfo_t *siginfo, native_context_t *ucontext);
+#endif
 
 static void inject_activation_handler(int code, siginfo_t *siginfo, void *context);
 
@@ -269,6 +272,16 @@ static void sigsegv_handler(int code, siginfo_t *siginfo, void *context)
 {
     if (PALIsInitialized())
     {
+#if ENABLE_FAST_ARRAYBUFFER
+        // An access that the resume handler completed (e.g. an out of bounds
+        // access from jitted code into the guard region of an array buffer)
+        // continues with the updated context.
+        if (resume_access_violation(siginfo, (native_context_t *)context))
+        {
+            return;
+        }
+#endif
+
         EXCEPTION_RECORD record;
         EXCEPTION_POINTERS pointers;
         native_context_t *ucontext;
@@ -560,6 +573,60 @@ static void common_signal_handler(PEXCEPTION_POINTERS pointers, int code,
     SEHProcessException(pointers);
 }
 
+#if ENABLE_FAST_ARRAYBUFFER
+/*++
+Function :
+    resume_access_violation
+
+    Pass an access violation to the handler registered with
+    PAL_SetAccessViolationResumeHandler, and if it handled it, update the
+    native context with the context record the handler returned
+
+Parameters :
+    siginfo_t *siginfo : signal info of the SIGSEGV
+    native_context_t *ucontext : context of the faulting thread
+
+Return :
+    TRUE if execution should resume with the updated native context
+--*/
+static BOOL resume_access_violation(siginfo_t *siginfo, native_context_t *ucontext)
+{
+    EXCEPTION_RECORD record;
+    EXCEPTION_POINTERS pointers;
+    CONTEXT context;
+
+    ULONG contextFlags = CONTEXT_CONTROL | CONTEXT_INTEGER;
+#if HAVE_GREGSET_T
+    if (ucontext->uc_mcontext.fpregs != nullptr)
+#elif HAVE___GREGSET_T
+    if (ucontext->uc_mcontext.__fpregs != nullptr)
+#endif
+    {
+        contextFlags |= CONTEXT_FLOATING_POINT;
+    }
+    CONTEXTFromNativeContext(ucontext, &context, contextFlags);
+
+    record.ExceptionCode = EXCEPTION_ACCESS_VIOLATION;
+    record.ExceptionFlags = EXCEPTION_IS_SIGNAL;
+    record.ExceptionRecord = NULL;
+    record.ExceptionAddress = GetNativeContextPC(ucontext);
+    record.NumberParameters = 2;
+    record.ExceptionInformation[0] = 0;
+    record.ExceptionInformation[1] = (size_t)siginfo->si_addr;
+
+    pointers.ExceptionRecord = &record;
+    pointers.ContextRecord = &context;
+
+    if (!SEHTryResumeAccessViolation(&pointers))
+    {
+        return FALSE;
+    }
+
+    CONTEXTToNativeContext(&context, ucontext);
+    return TRUE;
+}
+#endif // ENABLE_FAST_ARRAYBUFFER
+
 /*++
 Function :
     handle_signal
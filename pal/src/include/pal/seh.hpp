@@ -74,6 +74,22 @@ Return value:
 VOID 
 SEHProcessException(PEXCEPTION_POINTERS pointers);
 
+/*++
+Function:
+    SEHTryResumeAccessViolation
+
+    Give the handler registered with PAL_SetAccessViolationResumeHandler a
+    chance to handle an access violation.
+
+Parameters:
+    PEXCEPTION_POINTERS pointers
+
+Return value:
+    TRUE if execution should resume with the (possibly updated) context record
+--*/
+BOOL
+SEHTryResumeAccessViolation(PEXCEPTION_POINTERS pointers);
+
 #if !HAVE_MACH_EXCEPTIONS
 // TODO: Implement for Mach exceptions.  Not in CoreCLR surface area.
 /*++
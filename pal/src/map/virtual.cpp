@@ -92,6 +92,37 @@ static int gBackingFile PAL_GLOBAL = -1;
 #define MAP_ANON MAP_ANONYMOUS
 #endif
 
+/*
+ * Write watch (MEM_WRITE_WATCH)
+ *
+ * There is no OS support for tracking writes to a range of pages, and doing
+ * it with page protection would fault the kernel's own writes (system calls
+ * into the range fail with EFAULT) and split the mapping at every page that
+ * changes state. So write watch here doesn't track anything: every committed
+ * page of the region is reported as written, and resetting it does nothing.
+ * That is always correct, only imprecise; callers that need to know which
+ * pages changed have to track writes themselves (the recycler has a card
+ * table for its write barrier segments).
+ */
+
+/*
+ * Large pages (MEM_LARGE_PAGES)
+ *
+ * On Windows, MEM_LARGE_PAGES allocations are backed by large pages up front
+ * and need a privilege. Here the flag is only a hint, given when reserving:
+ * the region is reserved on a huge page boundary and advised with
+ * MADV_HUGEPAGE as it is committed, so that the kernel can back it with
+ * transparent huge pages. Committing, decommitting or protecting part of a
+ * huge page splits it, so callers should work in whole huge pages.
+ */
+#if defined(MADV_HUGEPAGE) && !MMAP_IGNORES_HINT && !HAVE_VM_ALLOCATE
+#define LARGE_PAGES_SUPPORTED 1
+#else
+#define LARGE_PAGES_SUPPORTED 0
+#endif
+
+#define VIRTUAL_LARGE_PAGE_SIZE 0x200000
+
 /*++
 Function:
     ReserveVirtualMemory()
@@ -900,6 +931,48 @@ done:
     return bRetVal;
 }
 
+#if LARGE_PAGES_SUPPORTED
+/******
+ *
+ *  VIRTUALReserveLargePageAlignedMemory() - Reserves memory starting on a
+ *  huge page boundary, by reserving a huge page more than needed and
+ *  releasing what lies outside the aligned range. Returns NULL on failure,
+ *  leaving the caller to reserve without alignment.
+ *
+ */
+static LPVOID VIRTUALReserveLargePageAlignedMemory(
+                IN CPalThread *pthrCurrent, /* Currently executing thread */
+                IN SIZE_T MemSize)          /* Size of Region */
+{
+    SIZE_T ReserveSize = MemSize + VIRTUAL_LARGE_PAGE_SIZE - VIRTUAL_PAGE_SIZE;
+    UINT_PTR ReserveStart;
+    UINT_PTR AlignedStart;
+
+    if (ReserveSize < MemSize)
+    {
+        return NULL;
+    }
+
+    ReserveStart = (UINT_PTR)ReserveVirtualMemory(pthrCurrent, NULL, ReserveSize);
+    if (ReserveStart == 0)
+    {
+        return NULL;
+    }
+
+    AlignedStart = (ReserveStart + VIRTUAL_LARGE_PAGE_SIZE - 1) & ~((UINT_PTR)VIRTUAL_LARGE_PAGE_SIZE - 1);
+    if (AlignedStart != ReserveStart)
+    {
+        munmap((LPVOID)ReserveStart, AlignedStart - ReserveStart);
+    }
+    if (AlignedStart + MemSize != ReserveStart + ReserveSize)
+    {
+        munmap((LPVOID)(AlignedStart + MemSize), ReserveStart + ReserveSize - (AlignedStart + MemSize));
+    }
+
+    return (LPVOID)AlignedStart;
+}
+#endif // LARGE_PAGES_SUPPORTED
+
 /******
  *
  *  VIRTUALReserveMemory() - Helper function that actually reserves the memory.
@@ -938,6 +1011,13 @@ static LPVOID VIRTUALReserveMemory(
         pRetVal = g_executableMemoryAllocator.AllocateMemory(MemSize);
     }
 
+#if LARGE_PAGES_SUPPORTED
+    if (((flAllocationType & MEM_LARGE_PAGES) != 0) && (lpAddress == NULL))
+    {
+        pRetVal = VIRTUALReserveLargePageAlignedMemory(pthrCurrent, MemSize);
+    }
+#endif // LARGE_PAGES_SUPPORTED
+
     if (pRetVal == NULL)
     {
         // Try to reserve memory from the OS
@@ -1233,6 +1313,15 @@ static LPVOID VIRTUALCommitMemory(
                 ERROR("mmap() failed! Error(%d)=%s\n", errno, strerror(errno));
                 goto error;
             }
+#if LARGE_PAGES_SUPPORTED
+            // Committing replaced the mapping, so the advice has to be given
+            // again. Without it the pages are simply backed by small pages.
+            if ((pInformation->allocationType & MEM_LARGE_PAGES) &&
+                madvise((void *) StartBoundary, MemSize, MADV_HUGEPAGE) != 0)
+            {
+                WARN("madvise(MADV_HUGEPAGE) failed! Error(%d)=%s\n", errno, strerror(errno));
+            }
+#endif // LARGE_PAGES_SUPPORTED
             VIRTUALSetAllocState(MEM_COMMIT, runStart, runLength, pInformation);
 #if MMAP_DOESNOT_ALLOW_REMAP
             VIRTUALSetDirtyPages (0, runStart, runLength, pInformation);
@@ -1627,9 +1716,15 @@ Function:
   VirtualAlloc
 
 Note:
-  MEM_TOP_DOWN, MEM_PHYSICAL, MEM_WRITE_WATCH are not supported.
+  MEM_TOP_DOWN, MEM_PHYSICAL are not supported.
   Unsupported flags are ignored.
 
+  MEM_WRITE_WATCH is accepted when reserving, but writes aren't tracked,
+  see the notes on write watch at the top of this file.
+
+  MEM_LARGE_PAGES is a hint for transparent huge pages, see the notes on
+  large pages at the top of this file.
+
   Page size on i386 is set to 4k.
 
 See MSDN doc.
@@ -1651,17 +1746,36 @@ VirtualAlloc(
 
     pthrCurrent = InternalGetCurrentThread();
 
-    if ( ( flAllocationType & MEM_WRITE_WATCH )  != 0 )
+    if ( ( flAllocationType & MEM_WRITE_WATCH )  != 0 &&
+         ( flAllocationType & MEM_RESERVE ) == 0 )
     {
+        // Write watch can only be requested when reserving the region
         pthrCurrent->SetLastError( ERROR_INVALID_PARAMETER );
         goto done;
     }
 
+    if ( ( flAllocationType & MEM_LARGE_PAGES ) != 0 )
+    {
+        // Large pages are a hint given when reserving, see the notes on
+        // large pages at the top of this file
+        if ( ( flAllocationType & MEM_RESERVE ) == 0 ||
+             ( flAllocationType & MEM_RESERVE_EXECUTABLE ) != 0 )
+        {
+            pthrCurrent->SetLastError( ERROR_INVALID_PARAMETER );
+            goto done;
+        }
+#if !LARGE_PAGES_SUPPORTED
+        WARN( "Ignoring the allocation flag MEM_LARGE_PAGES.\n" );
+        flAllocationType &= ~MEM_LARGE_PAGES;
+#endif // !LARGE_PAGES_SUPPORTED
+    }
+
     /* Test for un-supported flags. */
-    if ( ( flAllocationType & ~( MEM_COMMIT | MEM_RESERVE | MEM_TOP_DOWN | MEM_RESERVE_EXECUTABLE ) ) != 0 )
+    if ( ( flAllocationType & ~( MEM_COMMIT | MEM_RESERVE | MEM_TOP_DOWN | MEM_RESERVE_EXECUTABLE |
+                                 MEM_WRITE_WATCH | MEM_LARGE_PAGES ) ) != 0 )
     {
         ASSERT( "flAllocationType can be one, or any combination of MEM_COMMIT, \
-               MEM_RESERVE, MEM_TOP_DOWN, or MEM_RESERVE_EXECUTABLE.\n" );
+               MEM_RESERVE, MEM_TOP_DOWN, MEM_RESERVE_EXECUTABLE, MEM_WRITE_WATCH or MEM_LARGE_PAGES.\n" );
         pthrCurrent->SetLastError( ERROR_INVALID_PARAMETER );
         goto done;
     }
@@ -2357,11 +2471,61 @@ ExitVirtualQuery:
     return sizeof( *lpBuffer );
 }
 
+/*++
+Function:
+  GetLargePageMinimum
+
+See MSDN doc. Returns the huge page size when MEM_LARGE_PAGES is supported,
+and 0 otherwise.
+--*/
+SIZE_T
+PALAPI
+GetLargePageMinimum(
+         VOID)
+{
+    SIZE_T size;
+
+    ENTRY("GetLargePageMinimum()\n");
+
+#if LARGE_PAGES_SUPPORTED
+    size = VIRTUAL_LARGE_PAGE_SIZE;
+#else // LARGE_PAGES_SUPPORTED
+    size = 0;
+#endif // LARGE_PAGES_SUPPORTED
+
+    LOGEXIT("GetLargePageMinimum returning %u.\n", size);
+    return size;
+}
+
+/*++
+Function :
+    VIRTUALFindWriteWatchRegion
+
+    Returns the information of the region reserved with MEM_WRITE_WATCH
+    that contains the whole range, NULL if there is none. The caller must
+    own virtual_critsec.
+--*/
+static PCMI VIRTUALFindWriteWatchRegion( UINT_PTR StartBoundary, SIZE_T MemSize )
+{
+    PCMI pInformation = VIRTUALFindRegionInformation( StartBoundary );
+
+    if ( pInformation == NULL ||
+         ( pInformation->allocationType & MEM_WRITE_WATCH ) == 0 ||
+         MemSize == 0 ||
+         MemSize > pInformation->memSize - ( StartBoundary - pInformation->startBoundary ) )
+    {
+        return NULL;
+    }
+    return pInformation;
+}
+
 /*++
 Function:
   GetWriteWatch
 
-See MSDN doc.
+See MSDN doc. Writes aren't tracked (see the notes on write watch at the top
+of this file), so every committed page of the range is reported as written
+and WRITE_WATCH_FLAG_RESET has nothing to reset.
 --*/
 UINT
 PALAPI
@@ -2374,18 +2538,72 @@ GetWriteWatch(
   OUT PULONG lpdwGranularity
 )
 {
-    // TODO: implement this method
-    *lpAddresses = NULL;
-    *lpdwCount = 0;
-    // Until it is implemented, return non-zero value as an indicator of failure
-    return 1;
+    CPalThread *pthrCurrent;
+    PCMI pInformation;
+    UINT_PTR StartBoundary;
+    SIZE_T MemSize;
+    SIZE_T index;
+    SIZE_T endIndex;
+    ULONG_PTR count = 0;
+    UINT uRetVal = 1;
+
+    PERF_ENTRY(GetWriteWatch);
+    ENTRY("GetWriteWatch(dwFlags=%#x, lpBaseAddress=%p, dwRegionSize=%u, \
+          lpAddresses=%p, lpdwCount=%p, lpdwGranularity=%p)\n",
+          dwFlags, lpBaseAddress, dwRegionSize, lpAddresses, lpdwCount, lpdwGranularity);
+
+    pthrCurrent = InternalGetCurrentThread();
+
+    if ( lpAddresses == NULL || lpdwCount == NULL || lpdwGranularity == NULL )
+    {
+        ERROR( "lpAddresses, lpdwCount and lpdwGranularity can't be NULL.\n" );
+        pthrCurrent->SetLastError( ERROR_INVALID_PARAMETER );
+        goto done;
+    }
+
+    StartBoundary = (UINT_PTR)lpBaseAddress & ~VIRTUAL_PAGE_MASK;
+    MemSize = ( ((UINT_PTR)lpBaseAddress + dwRegionSize + VIRTUAL_PAGE_MASK) & ~VIRTUAL_PAGE_MASK ) -
+              StartBoundary;
+
+    InternalEnterCriticalSection(pthrCurrent, &virtual_critsec);
+
+    pInformation = VIRTUALFindWriteWatchRegion( StartBoundary, MemSize );
+    if ( pInformation == NULL )
+    {
+        ERROR( "The range is not within a region reserved with MEM_WRITE_WATCH.\n" );
+        pthrCurrent->SetLastError( ERROR_INVALID_PARAMETER );
+        InternalLeaveCriticalSection(pthrCurrent, &virtual_critsec);
+        goto done;
+    }
+
+    index = ( StartBoundary - pInformation->startBoundary ) / VIRTUAL_PAGE_SIZE;
+    endIndex = index + MemSize / VIRTUAL_PAGE_SIZE;
+    for ( ; index < endIndex && count < *lpdwCount; index++ )
+    {
+        if ( VIRTUALIsPageCommitted( index, pInformation ) )
+        {
+            lpAddresses[ count++ ] = (PVOID)( pInformation->startBoundary + index * VIRTUAL_PAGE_SIZE );
+        }
+    }
+
+    InternalLeaveCriticalSection(pthrCurrent, &virtual_critsec);
+
+    *lpdwCount = count;
+    *lpdwGranularity = VIRTUAL_PAGE_SIZE;
+    uRetVal = 0;
+
+done:
+    LOGEXIT( "GetWriteWatch returning %u.\n", uRetVal );
+    PERF_EXIT(GetWriteWatch);
+    return uRetVal;
 }
 
 /*++
 Function:
   ResetWriteWatch
 
-See MSDN doc.
+See MSDN doc. Writes aren't tracked (see the notes on write watch at the top
+of this file), so this only checks that the range is write watched.
 --*/
 UINT
 PALAPI
@@ -2394,9 +2612,32 @@ ResetWriteWatch(
   IN SIZE_T dwRegionSize
 )
 {
-    // TODO: implement this method
-    // Until it is implemented, return non-zero value as an indicator of failure
-    return 1;
+    CPalThread *pthrCurrent;
+    UINT_PTR StartBoundary;
+    SIZE_T MemSize;
+    UINT uRetVal = 0;
+
+    PERF_ENTRY(ResetWriteWatch);
+    ENTRY("ResetWriteWatch(lpBaseAddress=%p, dwRegionSize=%u)\n", lpBaseAddress, dwRegionSize);
+
+    pthrCurrent = InternalGetCurrentThread();
+
+    StartBoundary = (UINT_PTR)lpBaseAddress & ~VIRTUAL_PAGE_MASK;
+    MemSize = ( ((UINT_PTR)lpBaseAddress + dwRegionSize + VIRTUAL_PAGE_MASK) & ~VIRTUAL_PAGE_MASK ) -
+              StartBoundary;
+
+    InternalEnterCriticalSection(pthrCurrent, &virtual_critsec);
+    if ( VIRTUALFindWriteWatchRegion( StartBoundary, MemSize ) == NULL )
+    {
+        ERROR( "The range is not within a region reserved with MEM_WRITE_WATCH.\n" );
+        pthrCurrent->SetLastError( ERROR_INVALID_PARAMETER );
+        uRetVal = 1;
+    }
+    InternalLeaveCriticalSection(pthrCurrent, &virtual_critsec);
+
+    LOGEXIT( "ResetWriteWatch returning %u.\n", uRetVal );
+    PERF_EXIT(ResetWriteWatch);
+    return uRetVal;
 }
 
 /*++
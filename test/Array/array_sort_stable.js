@@ -0,0 +1,198 @@
+//-------------------------------------------------------------------------------------------------------
+// Copyright (C) Microsoft. All rights reserved.
+// Licensed under the MIT license. See LICENSE.txt file in the project root for full license information.
+//-------------------------------------------------------------------------------------------------------
+
+// Array.prototype.sort with a comparator must be stable and must not lose or duplicate elements, even when the
+// comparator throws or mutates the array in the middle of a merge.
+
+if (this.WScript && this.WScript.LoadScriptFile) { // Check for running in ch
+    this.WScript.LoadScriptFile("..\\UnitTestFramework\\UnitTestFramework.js");
+}
+
+function makeRecords(keys) {
+    return keys.map(function (key, index) { return { key: key, index: index }; });
+}
+
+function byKey(a, b) {
+    return a.key - b.key;
+}
+
+function assertSortedAndStable(records, message) {
+    for (var i = 1; i < records.length; i++) {
+        var prev = records[i - 1];
+        var cur = records[i];
+        assert.isTrue(prev.key < cur.key || (prev.key === cur.key && prev.index < cur.index), message + " at index " + i);
+    }
+}
+
+function assertSameElements(records, original, message) {
+    assert.areEqual(original.length, records.length, message + ": length");
+    var seen = [];
+    for (var i = 0; i < records.length; i++) {
+        assert.isFalse(seen[records[i].index] === true, message + ": duplicate element " + records[i].index);
+        seen[records[i].index] = true;
+    }
+    for (var i = 0; i < original.length; i++) {
+        assert.isTrue(seen[i] === true, message + ": missing element " + i);
+    }
+}
+
+// Deterministic pseudo-random numbers so failures are reproducible.
+var seed = 12345;
+function random(range) {
+    seed = (seed * 1103515245 + 12345) & 0x7fffffff;
+    return seed % range;
+}
+
+var lengths = [0, 1, 2, 31, 32, 33, 64, 100, 513, 1000, 5000];
+
+var tests = [
+    {
+        name: "Random keys with many duplicates sort stably",
+        body: function () {
+            lengths.forEach(function (n) {
+                var keys = [];
+                for (var i = 0; i < n; i++) {
+                    keys.push(random(10));
+                }
+                var records = makeRecords(keys);
+                records.sort(byKey);
+                assertSortedAndStable(records, "random length " + n);
+            });
+        }
+    },
+    {
+        name: "Ascending, descending and partially sorted inputs sort stably",
+        body: function () {
+            lengths.forEach(function (n) {
+                var ascending = [], descending = [], sawtooth = [], mostlySorted = [];
+                for (var i = 0; i < n; i++) {
+                    ascending.push(i >> 2);
+                    descending.push((n - i) >> 2);
+                    sawtooth.push(i % 50);
+                    mostlySorted.push(i % 10 === 0 ? random(n) : i);
+                }
+                [ascending, descending, sawtooth, mostlySorted].forEach(function (keys, kind) {
+                    var records = makeRecords(keys);
+                    records.sort(byKey);
+                    assertSortedAndStable(records, "kind " + kind + " length " + n);
+                });
+            });
+        }
+    },
+    {
+        name: "Already sorted and reversed inputs need only n - 1 comparisons",
+        body: function () {
+            var n = 1000;
+            var ascending = [], descending = [];
+            for (var i = 0; i < n; i++) {
+                ascending.push(i);
+                descending.push(n - i);
+            }
+            [ascending, descending].forEach(function (a) {
+                var calls = 0;
+                a.sort(function (x, y) { calls++; return x - y; });
+                assert.areEqual(n - 1, calls, "comparator call count");
+            });
+        }
+    },
+    {
+        name: "Sparse arrays and undefined elements keep working with a comparator",
+        body: function () {
+            var a = [3, undefined, 1];
+            a[10] = 2;
+            a[20] = 1;
+            a.sort(function (x, y) { return x - y; });
+            assert.areEqual(21, a.length, "length is preserved");
+            assert.areEqual("1,1,2,3,,,,,,,,,,,,,,,,,", a.toString(), "holes and undefined are moved to the end");
+        }
+    },
+    {
+        name: "Throwing comparator does not lose or duplicate elements",
+        body: function () {
+            [50, 500, 5000].forEach(function (n) {
+                var keys = [];
+                for (var i = 0; i < n; i++) {
+                    keys.push(random(n));
+                }
+                var original = makeRecords(keys);
+                [n >> 1, n, n * 2].forEach(function (throwAt) {
+                    var records = original.slice(0);
+                    var calls = 0;
+                    assert.throws(function () {
+                        records.sort(function (a, b) {
+                            if (++calls === throwAt) {
+                                throw new Error("stop");
+                            }
+                            return a.key - b.key;
+                        });
+                    }, Error, "comparator exception propagates", "stop");
+                    assertSameElements(records, original, "throw after " + throwAt + " calls, length " + n);
+                });
+            });
+        }
+    },
+    {
+        name: "Comparator that mutates the array does not lose or duplicate elements",
+        body: function () {
+            // The sort works on the elements the array had when it started; the result is those elements, sorted.
+            var mutations = [
+                function (a) { a.push({ key: -1, index: -1 }); },
+                function (a) { a.pop(); },
+                function (a) { a.shift(); },
+                function (a) { a.length = 0; },
+                function (a) { a[0] = { key: -1, index: -1 }; },
+                function (a) { a[1000] = { key: -1, index: -1 }; },
+                function (a) { a.splice(0, 5, { key: -1, index: -1 }); },
+                function (a) { a.reverse(); }
+            ];
+            [50, 500].forEach(function (n) {
+                var keys = [];
+                for (var i = 0; i < n; i++) {
+                    keys.push(random(10));
+                }
+                var original = makeRecords(keys);
+                mutations.forEach(function (mutate, m) {
+                    var records = original.slice(0);
+                    var calls = 0;
+                    records.sort(function (a, b) {
+                        if (++calls % 7 === 0) {
+                            mutate(records);
+                        }
+                        return a.key - b.key;
+                    });
+                    assertSameElements(records, original, "mutation " + m + ", length " + n);
+                    assertSortedAndStable(records, "mutation " + m + ", length " + n);
+
+                    // Mutate, then throw from the same merge
+                    records = original.slice(0);
+                    calls = 0;
+                    assert.throws(function () {
+                        records.sort(function (a, b) {
+                            if (++calls % 7 === 0) {
+                                mutate(records);
+                            }
+                            if (calls === n) {
+                                throw new Error("stop");
+                            }
+                            return a.key - b.key;
+                        });
+                    }, Error, "comparator exception propagates", "stop");
+                    assertSameElements(records, original, "mutation " + m + " then throw, length " + n);
+                });
+            });
+        }
+    },
+    {
+        name: "Inconsistent comparator does not lose or duplicate elements",
+        body: function () {
+            var original = makeRecords(new Array(3000).fill(0));
+            var records = original.slice(0);
+            records.sort(function () { return random(3) - 1; });
+            assertSameElements(records, original, "random comparator");
+        }
+    }
+];
+
+testRunner.runTests(tests, { verbose: WScript.Arguments[0] != "summary" });
@@ -0,0 +1,62 @@
+//-------------------------------------------------------------------------------------------------------
+// Copyright (C) Microsoft. All rights reserved.
+// Licensed under the MIT license. See LICENSE.txt file in the project root for full license information.
+//-------------------------------------------------------------------------------------------------------
+
+// With -ForceExpireOnNonCacheCollect, the ordinary collections of CollectGarbage complete entry point
+// expiration. The native code of the functions that aren't called while the collections profile them is
+// freed (emptying code pages that go back to the page allocator), and the functions go back to the
+// interpreter until they get hot again. Their results must not change along the way.
+
+var functionCount = 200;
+var functions = [];
+for (var i = 0; i < functionCount; i++) {
+    functions.push(new Function("a", "b",
+        "var s = 0; for (var j = 0; j < a; j++) { s = (s + j * " + i + " + b) | 0; } return s;"));
+}
+
+function expected(i, a, b) {
+    var s = 0;
+    for (var j = 0; j < a; j++) {
+        s = (s + j * i + b) | 0;
+    }
+    return s;
+}
+
+var failed = false;
+
+function callAll(filter, round) {
+    for (var i = 0; i < functionCount; i++) {
+        if (!filter(i)) {
+            continue;
+        }
+        for (var k = 0; k < 50; k++) {
+            var a = 10 + ((i + k) % 7), b = round * 1000 + k;
+            var result = functions[i](a, b);
+            if (result !== expected(i, a, b)) {
+                WScript.Echo("FAILED function " + i + " round " + round + ": " + result + " !== " + expected(i, a, b));
+                failed = true;
+                return;
+            }
+        }
+    }
+}
+
+function all() { return true; }
+function even(i) { return (i & 1) === 0; }
+
+for (var round = 0; round < 4 && !failed; round++) {
+    callAll(all, round);
+
+    // Only the even functions are used across these collections, the odd ones expire
+    for (var gc = 0; gc < 4; gc++) {
+        callAll(even, round);
+        CollectGarbage();
+    }
+}
+
+callAll(all, 4);
+
+if (!failed) {
+    WScript.Echo("pass");
+}
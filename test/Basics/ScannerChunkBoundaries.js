@@ -0,0 +1,184 @@
+//-------------------------------------------------------------------------------------------------------
+// Copyright (C) Microsoft. All rights reserved.
+// Licensed under the MIT license. See LICENSE.txt file in the project root for full license information.
+//-------------------------------------------------------------------------------------------------------
+
+// The scanner skips plain runs of UTF-8 source 16 bytes at a time in string and template literals, comments,
+// blanks and identifiers. These scripts put the character that ends a run, or is part of it, at every offset
+// around the 16 and 32 byte boundaries, with short and 16 byte tails behind it, and end runs at the end of the
+// source. WScript.LoadScript passes its script to the engine as UTF-8.
+
+var r;
+var failures = 0;
+
+function run(source) {
+    r = undefined;
+    try {
+        WScript.LoadScript(source, "self");
+    } catch (e) {
+        return "error";
+    }
+    return r;
+}
+
+function check(source, expected) {
+    var actual = run(source);
+    if (actual !== expected) {
+        failures++;
+        WScript.Echo("FAILED " + JSON.stringify(source) + ": " + JSON.stringify(actual) + " !== " + JSON.stringify(expected));
+    }
+}
+
+var offsets = [];
+for (var k = 0; k <= 34; k++) {
+    offsets.push(k);
+}
+var tails = [0, 1, 16];
+
+function run_of(c, length) {
+    return c.repeat(length);
+}
+
+// String literals. Each case is the source text put in the run and the value it scans to, or "error".
+var stringCases = [
+    ["\u00e9", "\u00e9"],
+    ["\u20ac", "\u20ac"],
+    ["\ud83d\ude00", "\ud83d\ude00"],
+    ["'", "'"],
+    ["\\n", "\n"],
+    ["\\\"", "\""],
+    ["\\\n", ""],
+    ["\\\r\n", ""],
+    ["\n", "error"],
+    ["\r", "error"]
+];
+offsets.forEach(function (k) {
+    tails.forEach(function (m) {
+        stringCases.forEach(function (c) {
+            var expected = c[1] === "error" ? "error" : run_of("a", k) + c[1] + run_of("b", m);
+            check("r = \"" + run_of("a", k) + c[0] + run_of("b", m) + "\";", expected);
+        });
+    });
+});
+
+// Template literals keep line terminators, normalizing CR LF and CR to LF
+var templateCases = [
+    ["\u20ac", "\u20ac"],
+    ["\n", "\n"],
+    ["\r\n", "\n"],
+    ["\r", "\n"],
+    ["$", "$"],
+    ["${1 + 1}", "2"],
+    ["\\`", "`"]
+];
+offsets.forEach(function (k) {
+    tails.forEach(function (m) {
+        templateCases.forEach(function (c) {
+            check("r = `" + run_of("a", k) + c[0] + run_of("b", m) + "`;", run_of("a", k) + c[1] + run_of("b", m));
+        });
+    });
+});
+
+// A block comment with a line terminator in it ends the return statement
+var commentCases = [
+    ["*", 5],
+    ["**", 5],
+    ["\u20ac", 5],
+    ["/", 5],
+    ["\n", undefined],
+    ["\r", undefined],
+    ["\r\n", undefined],
+    ["\u2028", undefined],
+    ["\u2029", undefined]
+];
+offsets.forEach(function (k) {
+    tails.forEach(function (m) {
+        commentCases.forEach(function (c) {
+            check("r = (function () { return /*" + run_of("a", k) + c[0] + run_of("b", m) + "*/ 5; })();", c[1]);
+        });
+    });
+});
+
+// A line comment ends at the first line terminator
+[["\u20ac", 5], ["*/", 5], ["\n", 6], ["\r", 6], ["\u2028", 6]].forEach(function (c) {
+    offsets.forEach(function (k) {
+        check("r = 5; //" + run_of("a", k) + c[0] + "r = 6;", c[1]);
+    });
+});
+
+// Blanks, including the whitespace outside of ASCII, before the returned value or the line terminator that
+// ends the return statement
+var blankCases = [
+    ["\u00a0", 5],
+    ["\ufeff", 5],
+    ["\v", 5],
+    ["\f", 5],
+    ["\n", undefined],
+    ["\r\n", undefined],
+    ["\u2028", undefined]
+];
+offsets.forEach(function (k) {
+    tails.forEach(function (m) {
+        var blanks = run_of(" \t", k + 1).substr(0, k + 1);
+        blankCases.forEach(function (c) {
+            check("r = (function () { return" + blanks + c[0] + run_of(" ", m) + "5; })();", c[1]);
+        });
+    });
+});
+
+// Identifiers declared and referenced with different spellings of the same name, and ended by the ASCII
+// characters next to the ranges of identifier characters
+var identifierCases = [
+    ["\u00e9", "\u00e9"],
+    ["\\u00e9", "\u00e9"],
+    ["\\u0041", "A"],
+    ["A", "\\u0041"],
+    ["$", "$"],
+    ["_", "_"],
+    ["Z", "Z"],
+    ["0", "0"],
+    ["9", "9"]
+];
+offsets.forEach(function (k) {
+    tails.forEach(function (m) {
+        identifierCases.forEach(function (c) {
+            var declared = "v" + run_of("a", k) + c[0] + run_of("b", m);
+            var referenced = "v" + run_of("a", k) + c[1] + run_of("b", m);
+            check("r = (function () { var " + declared + " = 7; return " + referenced + "; })();", 7);
+        });
+    });
+
+    var name = "v" + run_of("a", k);
+    check("r = (function () { var " + name + " = 8; return " + name + "/2; })();", 4);
+    check("r = (function () { var " + name + " = 8; return " + name + ">9; })();", false);
+    check("r = (function () { var " + name + " = [8]; return " + name + "[0]; })();", 8);
+    check("r = (function () { var " + name + " = 8; return {" + name + ":3}." + name + "; })();", 3);
+    check("r = (function () { var " + name + " = function () { return 8; }; return " + name + "`x`; })();", 8);
+    check("r = (function () { var " + name + "@ = 8; })();", "error");
+    check("r = (function () { var " + name + "{ = 8; })();", "error");
+});
+
+// Inputs shorter than a block, and runs that end at the end of the source
+check("r=1", 1);
+check("r=''", "");
+check("r='\u20ac'", "\u20ac");
+check("r=`\r\n`", "\n");
+check("/**/r=2", 2);
+check("r=3//\u20ac", 3);
+check("r=4 \t ", 4);
+check("r='", "error");
+check("r=`", "error");
+check("r=1/*", "error");
+offsets.forEach(function (k) {
+    var name = "v" + run_of("a", k);
+    check("var " + name + " = 9; r = " + name, 9);
+    check("r = 1; //" + run_of("a", k), 1);
+    check("r = 1;" + run_of(" ", k), 1);
+    check("r = \"" + run_of("a", k), "error");
+    check("r = `" + run_of("a", k), "error");
+    check("r = 1; /*" + run_of("a", k), "error");
+});
+
+if (failures === 0) {
+    WScript.Echo("pass");
+}
@@ -0,0 +1,42 @@
+//-------------------------------------------------------------------------------------------------------
+// Copyright (C) Microsoft. All rights reserved.
+// Licensed under the MIT license. See LICENSE.txt file in the project root for full license information.
+//-------------------------------------------------------------------------------------------------------
+
+// Loads the same library into several contexts of the runtime. Run with -ShareByteCode, the first context parses
+// it and the others load its cached byte code, or parse it again when the cached byte code is damaged.
+
+var library =
+    "var counter = 0;\n" +
+    "function makeAdder(n) {\n" +
+    "    return function (x) { counter++; return x + n; };\n" +
+    "}\n" +
+    "function nested() {\n" +
+    "    function inner(s) { return s.split('').reverse().join(''); }\n" +
+    "    return inner('abc') + /b+/.exec('abbbc')[0] + `${counter}`;\n" +
+    "}\n" +
+    "var table = { one: 1, two: [2, 2], three: 'three' };\n";
+
+function check(global, name) {
+    var add5 = global.makeAdder(5);
+    var results = [add5(1), add5(2), global.counter, global.nested(), JSON.stringify(global.table), global.makeAdder.toString()];
+    var expected = [6, 7, 2, "cbabbb2", '{"one":1,"two":[2,2],"three":"three"}', "function makeAdder(n) {\n    return function (x) { counter++; return x + n; };\n}"];
+    for (var i = 0; i < expected.length; i++) {
+        if (results[i] !== expected[i]) {
+            WScript.Echo("FAILED " + name + ": " + results[i] + " !== " + expected[i]);
+        }
+    }
+}
+
+for (var i = 0; i < 3; i++) {
+    check(WScript.LoadScript(library, "samethread"), "context " + i);
+}
+
+// A library that differs in one character gets byte code of its own
+var changed = WScript.LoadScript(library.replace("x + n", "x - n"), "samethread");
+if (changed.makeAdder(5)(1) !== -4) {
+    WScript.Echo("FAILED changed library");
+}
+check(WScript.LoadScript(library, "samethread"), "context after the changed library");
+
+WScript.Echo("pass");
@@ -0,0 +1,23 @@
+//-------------------------------------------------------------------------------------------------------
+// Copyright (C) Microsoft. All rights reserved.
+// Licensed under the MIT license. See LICENSE.txt file in the project root for full license information.
+//-------------------------------------------------------------------------------------------------------
+
+// The probe lists of a script context are allocated when the first probe is added or the debugger first
+// breaks in. Run code before the debugger attaches, then set breakpoints and break in after the attach,
+// detach (which removes all probes) and attach again.
+
+function Run() {
+    var o = { a: 1, b: 2 };
+    var r = new RegExp();
+    o.a; /**bp:evaluate('o.a + o.b == 3');evaluate('r.source == "(?:)"')**/
+    return o.a + o.b;
+}
+
+Run();
+Run();
+WScript.Attach(Run);
+WScript.Detach(Run);
+WScript.Attach(Run);
+
+WScript.Echo('pass');
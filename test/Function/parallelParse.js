@@ -0,0 +1,92 @@
+//-------------------------------------------------------------------------------------------------------
+// Copyright (C) Microsoft. All rights reserved.
+// Licensed under the MIT license. See LICENSE.txt file in the project root for full license information.
+//-------------------------------------------------------------------------------------------------------
+
+// Top-level functions are parsed on background threads with -ParallelParseThreshold.
+// Check that closures, regexes, strict mode and hoisting survive the split.
+
+var counter = 0;
+
+function increment() {
+    counter++;
+    return counter;
+}
+
+function makeAdder(x) {
+    return function (y) { return x + y; };
+}
+
+function matchDigits(s) {
+    return /^\d+$/.test(s);
+}
+
+function strictThis() {
+    "use strict";
+    return this;
+}
+
+function usesLater() {
+    return later();
+}
+
+function later() {
+    return "later";
+}
+
+var expr = function (a, b) {
+    var o = { a: a, b: b };
+    return o.a * o.b;
+};
+
+var success = true;
+function check(actual, expected, message) {
+    if (actual !== expected) {
+        WScript.Echo("Failed: " + message + ", expected " + expected + ", got " + actual);
+        success = false;
+    }
+}
+
+increment();
+check(increment(), 2, "increment");
+check(makeAdder(3)(4), 7, "makeAdder");
+check(matchDigits("12345"), true, "matchDigits");
+check(matchDigits("12a45"), false, "matchDigits");
+check(strictThis(), undefined, "strictThis");
+check(usesLater(), "later", "usesLater");
+check(expr(6, 7), 42, "expr");
+
+// Eval code is never split, so load the broken functions as a script of their own. The error comes from
+// the background parse of the function and must be the one the serial parse reports: the first in the source.
+function checkSyntaxError(source, line, column, message) {
+    try {
+        WScript.LoadScript(source, "samethread");
+        check(false, true, message + ": no error");
+    } catch (e) {
+        check(e.name, "SyntaxError", message + ": error type");
+        check(e.line, line, message + ": line");
+        check(e.column, column, message + ": column");
+    }
+}
+
+checkSyntaxError(
+    "function before() { return 1; }\n" +
+    "function broken() {\n" +
+    "    return 1 +;\n" +
+    "}\n" +
+    "function after() { return 2; }\n",
+    2, 14, "syntax error in a top-level function");
+
+checkSyntaxError(
+    "function first() {\n" +
+    "    var x = ;\n" +
+    "}\n" +
+    "function ok() { return 1; }\n" +
+    "function second() {\n" +
+    "    return 1 +;\n" +
+    "}\n",
+    1, 12, "syntax errors in two top-level functions");
+
+if (success) {
+    WScript.Echo("Pass");
+}
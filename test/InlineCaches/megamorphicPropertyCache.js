@@ -0,0 +1,93 @@
+//-------------------------------------------------------------------------------------------------------
+// Copyright (C) Microsoft. All rights reserved.
+// Licensed under the MIT license. See LICENSE.txt file in the project root for full license information.
+//-------------------------------------------------------------------------------------------------------
+
+//
+// Property accesses at sites that see more types than a polymorphic inline cache can hold go through
+// the per-thread megamorphic property cache. Check loads, stores and 'in' through it, and that it is
+// invalidated when prototypes change.
+//
+var echo = this.WScript ? WScript.Echo : function () { console.log([].join.apply(arguments, [", "])); };
+function assert(value, msg) { if (!value) { throw new Error("Failed: " + msg); } }
+
+var shapeCount = 100;
+
+function makeObjects(proto) {
+    var objects = [];
+    for (var i = 0; i < shapeCount; i++) {
+        var o = proto ? Object.create(proto) : {};
+        o["p" + i] = i;
+        if (!proto) {
+            o.x = i;
+        }
+        objects.push(o);
+    }
+    return objects;
+}
+
+function getX(o) { return o.x; }
+function getY(o) { return o.y; }
+function setX(o, v) { o.x = v; }
+function hasX(o) { return "x" in o; }
+function hasY(o) { return "y" in o; }
+
+// Own properties
+var own = makeObjects();
+for (var iter = 0; iter < 3; iter++) {
+    for (var i = 0; i < shapeCount; i++) {
+        assert(getX(own[i]) === i + iter * 1000, "own load " + i);
+        assert(hasX(own[i]), "own has " + i);
+        setX(own[i], i + (iter + 1) * 1000);
+        assert(own[i].x === i + (iter + 1) * 1000, "own store " + i);
+    }
+}
+
+// Properties on a prototype, and missing properties
+var proto = { x: "proto" };
+var inherited = makeObjects(proto);
+for (var iter = 0; iter < 3; iter++) {
+    for (var i = 0; i < shapeCount; i++) {
+        assert(getX(inherited[i]) === "proto", "proto load " + i);
+        assert(hasX(inherited[i]), "proto has " + i);
+        assert(getY(inherited[i]) === undefined, "missing load " + i);
+        assert(!hasY(inherited[i]), "missing has " + i);
+    }
+}
+
+// Changing the prototype must be seen by the cached sites
+proto.x = "changed";
+Object.defineProperty(proto, "y", { value: "added", writable: true, configurable: true });
+for (var i = 0; i < shapeCount; i++) {
+    assert(getX(inherited[i]) === "changed", "changed proto load " + i);
+    assert(getY(inherited[i]) === "added", "added proto load " + i);
+    assert(hasY(inherited[i]), "added proto has " + i);
+}
+
+delete proto.x;
+delete proto.y;
+for (var i = 0; i < shapeCount; i++) {
+    assert(getX(inherited[i]) === undefined, "deleted proto load " + i);
+    assert(!hasX(inherited[i]), "deleted proto has " + i);
+    assert(getY(inherited[i]) === undefined, "deleted added proto load " + i);
+}
+
+// Making a property read-only must stop cached stores
+for (var i = 0; i < shapeCount; i++) {
+    Object.defineProperty(own[i], "x", { writable: false });
+    setX(own[i], -1);
+    assert(own[i].x !== -1, "read-only store " + i);
+}
+
+// A store through a prototype setter must not be treated as a store to the object
+var setterCalls = 0;
+var setterProto = {};
+Object.defineProperty(setterProto, "x", { set: function (v) { setterCalls++; }, get: function () { return "getter"; } });
+var withSetter = makeObjects(setterProto);
+for (var i = 0; i < shapeCount; i++) {
+    setX(withSetter[i], i);
+    assert(getX(withSetter[i]) === "getter", "setter load " + i);
+}
+assert(setterCalls === shapeCount, "setter calls");
+
+echo("pass");
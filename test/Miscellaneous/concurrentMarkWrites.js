@@ -0,0 +1,112 @@
+//-------------------------------------------------------------------------------------------------------
+// Copyright (C) Microsoft. All rights reserved.
+// Licensed under the MIT license. See LICENSE.txt file in the project root for full license information.
+//-------------------------------------------------------------------------------------------------------
+
+// Objects that are only reachable through stores made while the recycler marks in the background must survive.
+// Run with the concurrent recycler stressed and concurrent mark forced on, so that a background mark is running
+// around every allocation below and the final rescan has to find each of these stores.
+
+if (this.WScript && this.WScript.LoadScriptFile) { // Check for running in ch
+    this.WScript.LoadScriptFile("..\\UnitTestFramework\\UnitTestFramework.js");
+}
+
+function makeNode(id) {
+    return { id: id, left: null, right: null, payload: [id, "n" + id] };
+}
+
+function buildTree(depth, nextId) {
+    var node = makeNode(nextId.value++);
+    if (depth > 0) {
+        node.left = buildTree(depth - 1, nextId);
+        node.right = buildTree(depth - 1, nextId);
+    }
+    return node;
+}
+
+function checkTree(node) {
+    var count = 0;
+    var sum = 0;
+    var stack = [node];
+    while (stack.length !== 0) {
+        var cur = stack.pop();
+        if (cur === null) {
+            continue;
+        }
+        assert.areEqual(cur.id, cur.payload[0], "payload of node " + cur.id);
+        assert.areEqual("n" + cur.id, cur.payload[1], "payload string of node " + cur.id);
+        count++;
+        sum += cur.id;
+        stack.push(cur.left, cur.right);
+    }
+    return { count: count, sum: sum };
+}
+
+var tests = [
+    {
+        name: "New objects stored into old objects",
+        body: function () {
+            var nextId = { value: 0 };
+            var root = buildTree(6, nextId);
+            var expected = checkTree(root);
+
+            // Replace every leaf's payload with a fresh array and string; the old objects hold the only references.
+            var stack = [root];
+            while (stack.length !== 0) {
+                var cur = stack.pop();
+                if (cur.left === null) {
+                    cur.payload = [cur.id, "n" + cur.id];
+                } else {
+                    stack.push(cur.left, cur.right);
+                }
+            }
+
+            var actual = checkTree(root);
+            assert.areEqual(expected.count, actual.count, "node count");
+            assert.areEqual(expected.sum, actual.sum, "id sum");
+        }
+    },
+    {
+        name: "Subtrees moved from unvisited to visited objects",
+        body: function () {
+            var nextId = { value: 0 };
+            var root = buildTree(7, nextId);
+            var expected = checkTree(root);
+
+            // Detach a subtree from the right side and hang it off the left side, leaving the right side without it,
+            // so that a mark that has already passed the left side can only find it again by rescanning.
+            for (var i = 0; i < 32; i++) {
+                var from = root.right;
+                var to = root.left;
+                while (from.right.right !== null) {
+                    from = (i & 1) ? from.left : from.right;
+                    to = (i & 1) ? to.right : to.left;
+                }
+                var moved = from.right;
+                from.right = to.right;
+                to.right = moved;
+                CollectGarbage();
+            }
+
+            var actual = checkTree(root);
+            assert.areEqual(expected.count, actual.count, "node count");
+            assert.areEqual(expected.sum, actual.sum, "id sum");
+        }
+    },
+    {
+        name: "Array elements replaced while growing",
+        body: function () {
+            var arr = [];
+            for (var i = 0; i < 2000; i++) {
+                arr.push({ value: i });
+                // Overwrite an older element with a new object, it is reachable only from the array's segment
+                arr[i >> 1] = { value: i >> 1, replaced: true };
+            }
+            for (var i = 0; i < arr.length; i++) {
+                assert.areEqual(i, arr[i].value, "element " + i);
+            }
+        }
+    }
+];
+
+testRunner.runTests(tests, { verbose: WScript.Arguments[0] != "summary" });
@@ -0,0 +1,120 @@
+//-------------------------------------------------------------------------------------------------------
+// Copyright (C) Microsoft. All rights reserved.
+// Licensed under the MIT license. See LICENSE.txt file in the project root for full license information.
+//-------------------------------------------------------------------------------------------------------
+
+// Run with -TransparentHugePages in a build with huge page segments (build.sh --transparent-huge-pages). Each
+// segment is then a single huge page that is only decommitted once it is entirely empty, so fill many segments,
+// empty most of them and check that what is still reachable survives the decommits in ReleasePages/DecommitNow.
+// CollectGarbage decommits now; the stress variants collect around every allocation besides.
+
+if (this.WScript && this.WScript.LoadScriptFile) { // Check for running in ch
+    this.WScript.LoadScriptFile("..\\UnitTestFramework\\UnitTestFramework.js");
+}
+
+// The stress variants pass a smaller number of rounds, every allocation collects there
+var rounds = Array.prototype.indexOf.call(WScript.Arguments, "stress") != -1 ? 1 : 2;
+
+function makeSmall(round, i) {
+    return { round: round, index: i, name: "s" + i };
+}
+
+function makeLarge(round, i) {
+    // Well above the medium object size, so that these come from the large block page allocator
+    var arr = new Array(20000);
+    for (var j = 0; j < arr.length; j += 1000) {
+        arr[j] = round * 100000 + i * 1000 + j;
+    }
+    return arr;
+}
+
+function checkSmall(obj, round, i) {
+    assert.areEqual(round, obj.round, "round of small object " + i);
+    assert.areEqual(i, obj.index, "index of small object " + i);
+    assert.areEqual("s" + i, obj.name, "name of small object " + i);
+}
+
+function checkLarge(arr, round, i) {
+    assert.areEqual(20000, arr.length, "length of large object " + i);
+    for (var j = 0; j < arr.length; j += 1000) {
+        assert.areEqual(round * 100000 + i * 1000 + j, arr[j], "element " + j + " of large object " + i);
+    }
+}
+
+var tests = [
+    {
+        name: "Small objects kept across emptied segments",
+        body: function () {
+            var kept = [];
+            for (var round = 0; round < rounds; round++) {
+                var objects = [];
+                for (var i = 0; i < 50000 * rounds; i++) {
+                    objects.push(makeSmall(round, i));
+                }
+
+                // Keep one object in every few thousand, so that most pages empty out but a few segments don't
+                for (var i = 0; i < objects.length; i += 4096) {
+                    kept.push(objects[i]);
+                }
+                objects = null;
+                CollectGarbage();
+
+                for (var k = 0; k < kept.length; k++) {
+                    var obj = kept[k];
+                    checkSmall(obj, obj.round, obj.index);
+                }
+            }
+        }
+    },
+    {
+        name: "Large objects kept across emptied segments",
+        body: function () {
+            var kept = [];
+            for (var round = 0; round < rounds; round++) {
+                var arrays = [];
+                for (var i = 0; i < 10 * rounds; i++) {
+                    arrays.push(makeLarge(round, i));
+                }
+
+                kept.push({ round: round, index: 0, value: arrays[0] });
+                arrays = null;
+                CollectGarbage();
+
+                for (var k = 0; k < kept.length; k++) {
+                    checkLarge(kept[k].value, kept[k].round, kept[k].index);
+                }
+            }
+        }
+    },
+    {
+        name: "Segments reused after being decommitted",
+        body: function () {
+            // The objects allocated after the last collection of a round are the ones checked
+            var count = 20000 * rounds + 1234;
+            var lastCollected = 20000 * rounds;
+            for (var round = 0; round < rounds; round++) {
+                var objects = [];
+                for (var i = 0; i < count; i++) {
+                    objects.push(i % 64 == 0 ? makeLarge(round, i % 100) : makeSmall(round, i));
+                    if (i % 5000 == 4999) {
+                        // Drop everything allocated so far and collect, then refill the same segments
+                        objects = [];
+                        CollectGarbage();
+                    }
+                }
+
+                assert.areEqual(count - lastCollected, objects.length, "objects left in round " + round);
+                for (var i = 0; i < objects.length; i++) {
+                    var absolute = lastCollected + i;
+                    if (absolute % 64 == 0) {
+                        checkLarge(objects[i], round, absolute % 100);
+                    } else {
+                        checkSmall(objects[i], round, absolute);
+                    }
+                }
+            }
+        }
+    }
+];
+
+testRunner.runTests(tests, { verbose: Array.prototype.indexOf.call(WScript.Arguments, "summary") == -1 });
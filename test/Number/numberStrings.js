@@ -0,0 +1,96 @@
+//-------------------------------------------------------------------------------------------------------
+// Copyright (C) Microsoft. All rights reserved.
+// Licensed under the MIT license. See LICENSE.txt file in the project root for full license information.
+//-------------------------------------------------------------------------------------------------------
+
+// Number to string conversion gives the shortest digits that round trip, and string to number conversion gives the
+// correctly rounded double
+
+var failed = false;
+function check(actual, expected, message) {
+    if (actual !== expected) {
+        WScript.Echo("FAILED: " + message + ": expected " + expected + ", got " + actual);
+        failed = true;
+    }
+}
+
+var toStringCases = [
+    [0.1, "0.1"],
+    [0.1 + 0.2, "0.30000000000000004"],
+    [1 / 3, "0.3333333333333333"],
+    [Math.pow(2, -24), "5.960464477539063e-8"],
+    [Math.pow(2, 60), "1152921504606847000"],
+    [Math.pow(2, -1074), "5e-324"],
+    [Math.pow(2, -1022), "2.2250738585072014e-308"],
+    [Number.MAX_VALUE, "1.7976931348623157e+308"],
+    [Number.EPSILON, "2.220446049250313e-16"],
+    [9007199254740993, "9007199254740992"],
+    [1e21, "1e+21"],
+    [1e-7, "1e-7"],
+    [123456789.123456789, "123456789.12345679"],
+    [1.2345678901234568e+200, "1.2345678901234567e+200"],
+    [-2.5e-310, "-2.5e-310"],
+    [4.35, "4.35"],
+    [0.000001, "0.000001"],
+    [299792458, "299792458"],
+];
+
+toStringCases.forEach(function (testCase) {
+    check(String(testCase[0]), testCase[1], "String(" + testCase[1] + ")");
+});
+
+var parseCases = [
+    ["9007199254740993", 9007199254740992],
+    ["9007199254740995", 9007199254740996],
+    ["2.4703282292062327e-324", 0],
+    ["2.4703282292062328e-324", Math.pow(2, -1074)],
+    ["1.7976931348623158e308", Number.MAX_VALUE],
+    ["1.7976931348623159e308", Infinity],
+    ["7.2057594037927933e16", 72057594037927940],
+    ["1e-400", 0],
+    ["1e400", Infinity],
+    ["0.30000000000000004", 0.1 + 0.2],
+    ["123456789012345678901234567890", 1.2345678901234568e+29],
+];
+
+parseCases.forEach(function (testCase) {
+    check(parseFloat(testCase[0]), testCase[1], "parseFloat(" + testCase[0] + ")");
+    check(Number(testCase[0]), testCase[1], "Number(" + testCase[0] + ")");
+    check(JSON.parse(testCase[0]), testCase[1], "JSON.parse(" + testCase[0] + ")");
+});
+
+// Round trip doubles from all over the range, including denormals and powers of 2
+var view = new DataView(new ArrayBuffer(8));
+var seed = 12345;
+function random32() {
+    seed = (Math.imul(seed, 1103515245) + 12345) | 0;
+    return seed >>> 0;
+}
+
+var values = [];
+for (var i = 0; i < 20000; i++) {
+    var hi = random32() & 0x7FFFFFFF;
+    var lo = random32();
+    if (i % 4 === 1) {
+        hi &= 0x000FFFFF;
+    } else if (i % 4 === 2) {
+        hi &= 0x7FF00000;
+        lo = 0;
+    }
+    view.setUint32(0, hi);
+    view.setUint32(4, lo);
+    var value = view.getFloat64(0);
+    if (isFinite(value)) {
+        values.push(value);
+        check(parseFloat(String(value)), value, "round trip of " + hi.toString(16) + " " + lo.toString(16));
+    }
+}
+
+var parsed = JSON.parse(JSON.stringify(values));
+for (var i = 0; i < values.length; i++) {
+    check(parsed[i], values[i], "JSON round trip of " + values[i]);
+}
+
+if (!failed) {
+    WScript.Echo("pass");
+}
@@ -0,0 +1,82 @@
+//-------------------------------------------------------------------------------------------------------
+// Copyright (C) Microsoft. All rights reserved.
+// Licensed under the MIT license. See LICENSE.txt file in the project root for full license information.
+//-------------------------------------------------------------------------------------------------------
+
+// Keyed loads and stores with non-literal strings on objects that are used as hash tables
+
+function key(i) {
+    return "k" + i;
+}
+
+function makeHashTable(count) {
+    var o = {};
+    for (var i = 0; i < count; ++i) {
+        o[key(i)] = i;
+    }
+    // Enough deletes to switch the object to the string keyed type handler
+    for (var i = 0; i < count; i += 2) {
+        delete o[key(i)];
+    }
+    return o;
+}
+
+function assertAreEqual(expected, actual, message) {
+    if (expected !== actual) {
+        throw new Error(message + ": expected " + expected + ", actual " + actual);
+    }
+}
+
+function test() {
+    var o = makeHashTable(128);
+    for (var i = 0; i < 128; ++i) {
+        assertAreEqual(i & 1 ? i : undefined, o[key(i)], "load " + key(i));
+    }
+
+    // Stores to existing properties, and adds into deleted slots
+    for (var i = 0; i < 128; ++i) {
+        o[key(i)] = -i;
+    }
+    for (var i = 0; i < 128; ++i) {
+        assertAreEqual(-i, o[key(i)], "load after store " + key(i));
+    }
+
+    // A property that is not own comes from the prototype chain
+    var proto = { inherited: "fromProto" };
+    var p = makeHashTable(64);
+    Object.setPrototypeOf(p, proto);
+    assertAreEqual("fromProto", p["inh" + "erited"], "inherited load");
+
+    // Read-only and accessor properties are not plain stores
+    var ro = makeHashTable(64);
+    Object.defineProperty(ro, key(1), { value: "ro", writable: false, configurable: true });
+    ro[key(1)] = "changed";
+    assertAreEqual("ro", ro[key(1)], "store to read-only property");
+    assertAreEqual(true, (function () { "use strict"; try { ro[key(1)] = 1; } catch (e) { return e instanceof TypeError; } return false; })(), "strict store to read-only property");
+
+    var setterValue;
+    var acc = makeHashTable(64);
+    Object.defineProperty(acc, key(3), { get: function () { return "getter"; }, set: function (v) { setterValue = v; }, configurable: true });
+    acc[key(3)] = "set";
+    assertAreEqual("set", setterValue, "setter called");
+    assertAreEqual("getter", acc[key(3)], "getter called");
+
+    var frozen = Object.freeze(makeHashTable(64));
+    frozen[key(5)] = "changed";
+    assertAreEqual(5, frozen[key(5)], "store to frozen object");
+
+    // Overriding valueOf through a keyed store has to be seen by later conversions
+    var v = makeHashTable(64);
+    v["value" + "Of"] = function () { return 1; };
+    v["value" + "Of"] = function () { return 42; };
+    assertAreEqual(43, v + 1, "valueOf override");
+
+    // Numeric strings are still elements
+    var n = makeHashTable(64);
+    n["1" + "0"] = "ten";
+    assertAreEqual("ten", n[10], "numeric string key");
+}
+
+test();
+test();
+print("pass");
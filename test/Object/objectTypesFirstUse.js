@@ -0,0 +1,93 @@
+//-------------------------------------------------------------------------------------------------------
+// Copyright (C) Microsoft. All rights reserved.
+// Licensed under the MIT license. See LICENSE.txt file in the project root for full license information.
+//-------------------------------------------------------------------------------------------------------
+
+// The object types of a script context with more than the smallest inline slot capacities are created when
+// an object first asks for them. Each size runs in a new script context, so that the object literal or
+// constructed object of that size is the first one.
+
+var failed = false;
+
+function fail(message) {
+    WScript.Echo("FAILED " + message);
+    failed = true;
+}
+
+function literalSource(count) {
+    var properties = [];
+    for (var i = 0; i < count; i++) {
+        properties.push("p" + i + ": " + i);
+    }
+    return "({" + properties.join(", ") + "})";
+}
+
+function constructorSource(count) {
+    var body = "";
+    for (var i = 0; i < count; i++) {
+        body += "this.p" + i + " = " + i + ";";
+    }
+    return "(function C() {" + body + "})";
+}
+
+function checkObject(name, count, o) {
+    var keys = Object.keys(o);
+    if (keys.length !== count) {
+        fail(name + ": " + keys.length + " properties");
+        return;
+    }
+    for (var i = 0; i < count; i++) {
+        if (keys[i] !== "p" + i || o["p" + i] !== i) {
+            fail(name + ": property " + i + " is " + keys[i] + " = " + o[keys[i]]);
+            return;
+        }
+    }
+    if (Object.getPrototypeOf(o) === null || o.hasOwnProperty("p" + count)) {
+        fail(name + ": bad prototype or extra property");
+    }
+
+    // Properties past the inline slots of the type and deleted ones
+    for (var i = count; i < count + 20; i++) {
+        o["p" + i] = i;
+    }
+    delete o.p0;
+    for (var i = 1; i < count + 20; i++) {
+        if (o["p" + i] !== i) {
+            fail(name + ": added property " + i + " is " + o["p" + i]);
+            return;
+        }
+    }
+    if ("p0" in o) {
+        fail(name + ": deleted property is still there");
+    }
+}
+
+function testSize(count) {
+    var context = WScript.LoadScript("", "samethread");
+
+    var literal = context.eval("function makeLiteral() { return " + literalSource(count) + "; } makeLiteral");
+    var first = literal();
+    var second = literal();
+    checkObject("literal of " + count, count, first);
+    checkObject("second literal of " + count, count, second);
+    for (var i = 0; i < 10; i++) {
+        checkObject("repeated literal of " + count, count, literal());
+    }
+
+    var C = context.eval(constructorSource(count));
+    for (var i = 0; i < 10; i++) {
+        checkObject("constructed object of " + count, count, new C());
+    }
+
+    if (context.eval("new Object()").constructor !== context.Object) {
+        fail("new Object() after objects of " + count);
+    }
+}
+
+for (var count = 0; count <= 40; count++) {
+    testSize(count);
+}
+
+if (!failed) {
+    WScript.Echo("pass");
+}
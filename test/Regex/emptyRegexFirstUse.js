@@ -0,0 +1,41 @@
+//-------------------------------------------------------------------------------------------------------
+// Copyright (C) Microsoft. All rights reserved.
+// Licensed under the MIT license. See LICENSE.txt file in the project root for full license information.
+//-------------------------------------------------------------------------------------------------------
+
+// The empty regex pattern of a script context is compiled when it is first used. Each case runs in a new
+// script context, so that the use under test is the first one.
+
+var failed = false;
+
+function check(name, source, expected) {
+    var context = WScript.LoadScript("", "samethread");
+    var actual = String(context.eval(source));
+    if (actual !== expected) {
+        WScript.Echo("FAILED " + name + ": expected '" + expected + "', got '" + actual + "'");
+        failed = true;
+    }
+}
+
+check("new RegExp()",
+    "var r = new RegExp(); [r.source, r.global, r.test('abc'), 'abc'.replace(r, '-')].join('|')",
+    "(?:)|false|true|-abc");
+check("RegExp()",
+    "RegExp().source",
+    "(?:)");
+check("compile()",
+    "var r = /a+/g; r.compile(); [r.source, r.global, r.exec('xa').index, r.exec('xa')[0].length].join('|')",
+    "(?:)|false|0|0");
+check("split",
+    "'abc'.split(new RegExp()).join(',')",
+    "a,b,c");
+check("distinct objects",
+    "var a = new RegExp(), b = new RegExp(); a.lastIndex = 3; [a !== b, a.source === b.source, b.lastIndex].join('|')",
+    "true|true|0");
+check("used again after a new context",
+    "WScript.LoadScript('', 'samethread').eval('new RegExp()'); new RegExp().test('')",
+    "true");
+
+if (!failed) {
+    WScript.Echo("pass");
+}
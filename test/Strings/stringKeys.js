@@ -0,0 +1,63 @@
+//-------------------------------------------------------------------------------------------------------
+// Copyright (C) Microsoft. All rights reserved.
+// Licensed under the MIT license. See LICENSE.txt file in the project root for full license information.
+//-------------------------------------------------------------------------------------------------------
+
+// Strings that are not property strings, used as property and Map keys over and over
+
+var failed = false;
+function check(actual, expected, message) {
+    if (actual !== expected) {
+        WScript.Echo("FAILED: " + message + ": expected " + expected + ", got " + actual);
+        failed = true;
+    }
+}
+
+function makeKeys(prefix) {
+    var keys = [];
+    for (var i = 0; i < 64; i++) {
+        keys.push(prefix + i + "_" + (i * 7));
+    }
+    // Empty string, a string whose hash is 0, single characters and indices
+    keys.push("" + "", "x".substring(1), "a" + "", "" + "b", "1" + "2", "4294967295".substring(0, 10));
+    return keys;
+}
+
+function test(iteration) {
+    var keys = makeKeys("key" + iteration + "_");
+    var o = {};
+    var m = new Map();
+
+    for (var j = 0; j < 3; j++) {
+        for (var i = 0; i < keys.length; i++) {
+            var key = keys[i];
+            o[key] = i;
+            m.set(key, i);
+            check(o[key], i, "get " + key);
+            check(key in o, true, "in " + key);
+            check(o.hasOwnProperty(key), true, "hasOwnProperty " + key);
+            check(m.get(key), i, "Map get " + key);
+            check(m.get(key.split("").join("")), i, "Map get with a different string " + key);
+            check(o[key.split("").join("")], i, "get with a different string " + key);
+        }
+        CollectGarbage();
+    }
+
+    check(o[""], keys.lastIndexOf(""), "empty string key");
+    check(o["12"], keys.indexOf("12"), "index key");
+    check(("nope" + iteration) in o, false, "missing key");
+    check(m.size, keys.length - 1, "Map size");
+
+    for (var i = 0; i < keys.length; i++) {
+        delete o[keys[i]];
+        check(keys[i] in o, false, "deleted " + keys[i]);
+    }
+}
+
+for (var i = 0; i < 4; i++) {
+    test(i);
+}
+
+if (!failed) {
+    WScript.Echo("pass");
+}
@@ -0,0 +1,53 @@
+//-------------------------------------------------------------------------------------------------------
+// Copyright (C) Microsoft. All rights reserved.
+// Licensed under the MIT license. See LICENSE.txt file in the project root for full license information.
+//-------------------------------------------------------------------------------------------------------
+
+// The sources of the eval code are written to the log, 2 bytes per character. The random text alone fills more
+// than the first 2MB block, which doesn't compress and is stored as is, and the repeated text fills the next
+// blocks, which compress well. The replay reparses the functions from the sources it decompressed.
+
+function makeRandomText(length)
+{
+    // CJK ideographs from a fixed seed, so that the text is the same in the replay
+    var seed = 1;
+    var chunks = [];
+    for(var i = 0; i < length; i += 4096)
+    {
+        var codes = [];
+        for(var j = i; j < length && j < i + 4096; ++j)
+        {
+            seed = (Math.imul(seed, 1103515245) + 12345) | 0;
+            codes.push(0x4E00 + ((seed >>> 8) % 20992));
+        }
+        chunks.push(String.fromCharCode.apply(null, codes));
+    }
+    return chunks.join("");
+}
+
+function makeRepeatedText(length)
+{
+    return "0123456789".repeat(length / 10);
+}
+
+var randomTextLength = 1100000;
+var repeatedTextLength = 2000000;
+
+var getRandomText = eval("(function() { return '" + makeRandomText(randomTextLength) + "'; })");
+var getRepeatedText = eval("(function() { return '" + makeRepeatedText(repeatedTextLength) + "'; })");
+
+WScript.SetTimeout(testFunction, 50);
+
+/////////////////
+
+function testFunction()
+{
+    var randomText = getRandomText();
+    var repeatedText = getRepeatedText();
+
+    telemetryLog(`randomText.length: ${randomText.length}`, true); //1100000
+    telemetryLog(`randomText matches: ${randomText === makeRandomText(randomTextLength)}`, true); //true
+
+    telemetryLog(`repeatedText.length: ${repeatedText.length}`, true); //2000000
+    telemetryLog(`repeatedText matches: ${repeatedText === makeRepeatedText(repeatedTextLength)}`, true); //true
+}
\ No newline at end of file
@@ -0,0 +1,57 @@
+//-------------------------------------------------------------------------------------------------------
+// Copyright (C) Microsoft. All rights reserved.
+// Licensed under the MIT license. See LICENSE.txt file in the project root for full license information.
+//-------------------------------------------------------------------------------------------------------
+
+// Array.prototype.sort with a script comparator on sorted, reversed, partially sorted and random inputs.
+// Reports the time per input shape and the number of comparator calls, followed by the total time in the
+// "### TIME:" format understood by perftest.pl.
+
+var length = 100000;
+var iterations = 10;
+
+var seed = 42;
+function random(range) {
+    seed = (seed * 1103515245 + 12345) & 0x7fffffff;
+    return seed % range;
+}
+
+function makeInput(kind) {
+    var a = new Array(length);
+    for (var i = 0; i < length; i++) {
+        switch (kind) {
+            case "sorted":       a[i] = { key: i }; break;
+            case "reversed":     a[i] = { key: length - i }; break;
+            case "mostlySorted": a[i] = { key: i % 100 === 0 ? random(length) : i }; break;
+            case "sawtooth":     a[i] = { key: i % 1000 }; break;
+            case "fewUnique":    a[i] = { key: random(16) }; break;
+            default:             a[i] = { key: random(length) }; break;
+        }
+    }
+    return a;
+}
+
+var calls = 0;
+function compare(a, b) {
+    calls++;
+    return a.key - b.key;
+}
+
+var kinds = ["sorted", "reversed", "mostlySorted", "sawtooth", "fewUnique", "random"];
+var total = 0;
+
+for (var k = 0; k < kinds.length; k++) {
+    var input = makeInput(kinds[k]);
+    var elapsed = 0;
+    calls = 0;
+    for (var iter = 0; iter < iterations; iter++) {
+        var a = input.slice(0);
+        var start = Date.now();
+        a.sort(compare);
+        elapsed += Date.now() - start;
+    }
+    total += elapsed;
+    WScript.Echo(kinds[k] + ": " + (elapsed / iterations).toFixed(2) + " ms, " + Math.round(calls / iterations) + " comparator calls");
+}
+
+WScript.Echo("### TIME:", total, "ms");
@@ -0,0 +1,85 @@
+//-------------------------------------------------------------------------------------------------------
+// Copyright (C) Microsoft. All rights reserved.
+// Licensed under the MIT license. See LICENSE.txt file in the project root for full license information.
+//-------------------------------------------------------------------------------------------------------
+
+// Recycler allocation and collection throughput. The kernels allocate short lived small objects, keep a large
+// graph alive while it is mutated, grow arrays and allocate large buffers, so that the time is dominated by the
+// allocators and by the collections they trigger. Run with "ch -PrintRuntimeStatistics" to see the collections
+// and their pauses.
+
+function shortLived(n) {
+    var sum = 0;
+    for (var i = 0; i < n; i++) {
+        var o = { x: i, y: i + 1, next: null };
+        o.next = { x: o.y, y: o.x, next: o };
+        sum += o.next.x - o.x;
+    }
+    return sum;
+}
+
+function makeTree(depth) {
+    return depth === 0 ? { left: null, right: null } : { left: makeTree(depth - 1), right: makeTree(depth - 1) };
+}
+
+function checkTree(node) {
+    return node.left === null ? 1 : 1 + checkTree(node.left) + checkTree(node.right);
+}
+
+function longLived(n) {
+    // About 256K live nodes, half of which are replaced by new subtrees during the run
+    var roots = [];
+    for (var i = 0; i < 16; i++) {
+        roots.push(makeTree(14));
+    }
+    for (var i = 0; i < n / 100000; i++) {
+        var root = roots[i & 15];
+        root.left = makeTree(10);
+        root.right.left = makeTree(8);
+    }
+    var count = 0;
+    for (var i = 0; i < roots.length; i++) {
+        count += checkTree(roots[i]);
+    }
+    return count;
+}
+
+function arrayGrowth(n) {
+    var total = 0;
+    for (var i = 0; i < n / 10000; i++) {
+        var a = [];
+        for (var j = 0; j < 10000; j++) {
+            a.push(j & 1 ? j : { value: j });
+        }
+        total += a.length;
+    }
+    return total;
+}
+
+function largeBuffers(n) {
+    var total = 0;
+    for (var i = 0; i < n / 2000; i++) {
+        var buffer = new Float64Array(16384 + (i & 1023));
+        buffer[i & 1023] = i;
+        var strings = new Array(64);
+        for (var j = 0; j < strings.length; j++) {
+            strings[j] = "item" + i + "-" + j;
+        }
+        total += buffer.length + strings.join(",").length;
+    }
+    return total;
+}
+
+var iterations = 2000000;
+var kernels = [shortLived, longLived, arrayGrowth, largeBuffers];
+var total = 0;
+
+for (var k = 0; k < kernels.length; k++) {
+    var start = Date.now();
+    var result = kernels[k](iterations);
+    var elapsed = Date.now() - start;
+    total += elapsed;
+    WScript.Echo(kernels[k].name + ": " + elapsed + " ms (result " + result + ")");
+}
+
+WScript.Echo("### TIME:", total, "ms");
@@ -0,0 +1,73 @@
+//-------------------------------------------------------------------------------------------------------
+// Copyright (C) Microsoft. All rights reserved.
+// Licensed under the MIT license. See LICENSE.txt file in the project root for full license information.
+//-------------------------------------------------------------------------------------------------------
+
+// Bytecode dispatch throughput. Each kernel is a tight loop of cheap OpCodes so that the time is dominated
+// by the interpreter loop itself rather than by runtime helpers. Run with "ch -InterpreterBenchmark:5" to
+// measure the interpreter alone over several runs; "-BytecodeHist" on a debug build shows which OpCodes each
+// kernel executes.
+
+var iterations = 2000000;
+
+function arithmetic(n) {
+    var a = 0, b = 1, c = 2;
+    for (var i = 0; i < n; i++) {
+        a = (a + b) | 0;
+        b = (b ^ c) + 1;
+        c = (a - c) & 0xffff;
+    }
+    return a + b + c;
+}
+
+function compareAndBranch(n) {
+    var even = 0, odd = 0;
+    for (var i = 0; i < n; i++) {
+        if ((i & 1) === 0) {
+            even++;
+        } else if (i > odd) {
+            odd += 2;
+        }
+    }
+    return even + odd;
+}
+
+function fieldAccess(n) {
+    var o = { x: 1, y: 2, z: 3 };
+    for (var i = 0; i < n; i++) {
+        o.x = o.y + o.z;
+        o.y = o.x - i;
+    }
+    return o.x + o.y;
+}
+
+function calls(n) {
+    var o = { value: 0, inc: function (d) { this.value += d; } };
+    for (var i = 0; i < n; i++) {
+        o.inc(1);
+    }
+    return o.value;
+}
+
+function arrays(n) {
+    var a = [0, 1, 2, 3, 4, 5, 6, 7];
+    var sum = 0;
+    for (var i = 0; i < n; i++) {
+        sum += a[i & 7];
+        a[(i + 1) & 7] = i;
+    }
+    return sum;
+}
+
+var kernels = [arithmetic, compareAndBranch, fieldAccess, calls, arrays];
+var total = 0;
+
+for (var k = 0; k < kernels.length; k++) {
+    var start = Date.now();
+    var result = kernels[k](iterations);
+    var elapsed = Date.now() - start;
+    total += elapsed;
+    WScript.Echo(kernels[k].name + ": " + elapsed + " ms (" + Math.round(iterations / Math.max(elapsed, 1)) + " iterations/ms, result " + result + ")");
+}
+
+WScript.Echo("### TIME:", total, "ms");
@@ -0,0 +1,65 @@
+//-------------------------------------------------------------------------------------------------------
+// Copyright (C) Microsoft. All rights reserved.
+// Licensed under the MIT license. See LICENSE.txt file in the project root for full license information.
+//-------------------------------------------------------------------------------------------------------
+
+// Cost of the Jsrt boundary as ch uses it. Each kernel goes through one path of the host: calls of native
+// functions created with JsCreateNamedFunction, scripts run with JsRun, contexts created with JsCreateContext
+// and callbacks run from the host's message queue. The last kernel is asynchronous, so the total is printed
+// once its timers have run.
+
+var nativeCallCount = 1000000;
+var scriptCount = 2000;
+var contextCount = 200;
+var timerCount = 20000;
+
+function nativeCalls() {
+    // Clearing a timer that doesn't exist converts the argument and returns undefined
+    for (var i = 0; i < nativeCallCount; i++) {
+        WScript.ClearTimeout(0);
+    }
+    return nativeCallCount;
+}
+
+function scripts() {
+    var sum = 0;
+    for (var i = 0; i < scriptCount; i++) {
+        // Runs in this context, whose global object is returned
+        sum += WScript.LoadScript("var scriptValue = " + i + ";").scriptValue;
+    }
+    return sum;
+}
+
+function contexts() {
+    var sum = 0;
+    for (var i = 0; i < contextCount; i++) {
+        sum += WScript.LoadScript("var contextValue = " + i + ";", "samethread").contextValue;
+    }
+    return sum;
+}
+
+var kernels = [nativeCalls, scripts, contexts];
+var total = 0;
+
+for (var k = 0; k < kernels.length; k++) {
+    var start = Date.now();
+    var result = kernels[k]();
+    var elapsed = Date.now() - start;
+    total += elapsed;
+    WScript.Echo(kernels[k].name + ": " + elapsed + " ms (result " + result + ")");
+}
+
+var timersRun = 0;
+var timersStart = Date.now();
+function timer() {
+    if (++timersRun < timerCount) {
+        WScript.SetTimeout(timer, 0);
+        return;
+    }
+
+    var elapsed = Date.now() - timersStart;
+    total += elapsed;
+    WScript.Echo("timers: " + elapsed + " ms (result " + timersRun + ")");
+    WScript.Echo("### TIME:", total, "ms");
+}
+WScript.SetTimeout(timer, 0);
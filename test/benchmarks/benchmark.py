@@ -0,0 +1,421 @@
+#!/usr/bin/env python
+#-------------------------------------------------------------------------------------------------------
+# Copyright (C) Microsoft. All rights reserved.
+# Licensed under the MIT license. See LICENSE.txt file in the project root for full license information.
+#-------------------------------------------------------------------------------------------------------
+
+from __future__ import print_function
+from datetime import datetime
+import sys
+import os
+import subprocess as SP
+import argparse
+import json
+import math
+import re
+import tempfile
+
+# handle command line args
+parser = argparse.ArgumentParser(
+    description='ChakraCore benchmark runner',
+    formatter_class=argparse.RawDescriptionHelpFormatter,
+    epilog='''\
+Runs each benchmark in a new ch process: the warmup runs are discarded and the
+trials are reported as a mean with a Student's t confidence interval. With a
+base binary, the trials of the two binaries are interleaved and every benchmark
+is compared with the confidence interval of the difference of their means.
+
+Samples:
+
+run all suites with a release build:
+    benchmark.py -b BuildLinux/Release/ch
+
+compare a change with the build it is based on:
+    benchmark.py -b test/ch --base base/ch -o report.json
+
+run a few benchmarks of a suite, interpreted only:
+    benchmark.py -b ch --variant interpreted octane/richards octane/splay
+''')
+
+SUITES = ['octane', 'kraken', 'sunspider', 'jetstream', 'micro']
+SUITE_FOLDERS = {
+    'octane': 'Octane',
+    'kraken': 'Kraken',
+    'sunspider': 'SunSpider',
+    'jetstream': 'jetstream',
+    'micro': 'Micro'
+}
+VARIANTS = {
+    'native': [],
+    'interpreted': ['-NoNative']
+}
+DEFAULT_TIMEOUT = 600
+
+parser.add_argument('benchmarks', metavar='benchmark', nargs='*',
+                    help='suites (' + ', '.join(SUITES) + ') or suite/name of '
+                    'benchmarks to run (default: all suites)')
+parser.add_argument('-b', '--binary', metavar='bin', help='ch full path')
+parser.add_argument('--base', metavar='bin',
+                    help='ch full path of the build to compare with')
+parser.add_argument('--variant', choices=sorted(VARIANTS), default='native',
+                    help='run with or without the JIT (default native)')
+parser.add_argument('-w', '--warmup', type=int, default=1,
+                    help='runs discarded before the trials (default 1)')
+parser.add_argument('-n', '--trials', type=int, default=10,
+                    help='runs measured per benchmark and binary (default 10)')
+parser.add_argument('-c', '--confidence', type=float, default=0.95,
+                    help='level of the confidence intervals (default 0.95)')
+parser.add_argument('--switches', metavar='switch', nargs='+', default=[],
+                    help='additional ch switches, e.g. --switches=-off:simpleJit')
+parser.add_argument('--no-counters', action='store_true',
+                    help="don't collect the JIT and GC counters of the runs")
+parser.add_argument('--timeout', type=int, default=DEFAULT_TIMEOUT,
+                    help='timeout of a run (default ' + str(DEFAULT_TIMEOUT) + ' seconds)')
+parser.add_argument('-o', '--output', metavar='report', help='file to write the JSON report to')
+args = parser.parse_args()
+
+
+benchmark_root = os.path.dirname(os.path.realpath(__file__))
+repo_root = os.path.dirname(os.path.dirname(benchmark_root))
+
+if args.trials < 2:
+    print('ERROR: at least 2 trials are needed for a confidence interval.')
+    sys.exit(1)
+if not 0 < args.confidence < 1:
+    print('ERROR: the confidence level must be between 0 and 1.')
+    sys.exit(1)
+
+def find_binary(binary):
+    if binary == None:
+        if sys.platform == 'win32':
+            binary = 'Build/VcBuild/bin/x64_Release/ch.exe'
+        else:
+            binary = 'BuildLinux/Release/ch'
+        binary = os.path.join(repo_root, binary)
+    binary = os.path.realpath(binary)
+    if not os.path.isfile(binary):
+        print('{} not found. Did you run ./build.sh already?'.format(binary))
+        sys.exit(1)
+    return binary
+
+binaries = [('test', find_binary(args.binary))]
+if args.base:
+    binaries.insert(0, ('base', find_binary(args.base)))
+
+
+# Output of the benchmarks, in the format of perftest.pl, and of ch -PrintRuntimeStatistics
+METRIC_PATTERNS = [
+    ('score', re.compile(r'^### SCORE:\s*([\d.]+)', re.M)),
+    ('time', re.compile(r'^### TIME:\s*([\d.]+)\s*ms', re.M)),
+    ('latency', re.compile(r'^### LATENCY:\s*([\d.]+)', re.M))
+]
+COUNTER_PATTERNS = [
+    ('jit', re.compile(r'^### JIT:(.*)$', re.M)),
+    ('gc', re.compile(r'^### GC:(.*)$', re.M))
+]
+HIGHER_IS_BETTER = {'score': True, 'time': False, 'latency': False}
+
+class RunError(Exception):
+    pass
+
+def run_ch(binary, flags, path, timeout):
+    command = [binary] + flags + [os.path.basename(path)]
+    # Some benchmarks load files next to them
+    process = SP.Popen(command, cwd=os.path.dirname(path),
+                       stdout=SP.PIPE, stderr=SP.STDOUT)
+    start_time = datetime.now()
+    try:
+        output = process.communicate(timeout=timeout)[0] \
+            if sys.version_info >= (3, 3) else process.communicate()[0]
+    except SP.TimeoutExpired:
+        process.kill()
+        process.communicate()
+        raise RunError('timed out after {} seconds'.format(timeout))
+    elapsed = datetime.now() - start_time
+    output = output.decode('utf-8', 'replace')
+    if process.returncode != 0:
+        raise RunError('exit code {}:\n{}'.format(process.returncode, output))
+    return output, elapsed.total_seconds()
+
+def parse_counters(text):
+    # "name value name value ..."
+    fields = text.split()
+    return dict((fields[i], float(fields[i + 1]))
+                for i in range(0, len(fields) - 1, 2))
+
+def parse_run(output, seconds):
+    result = {'metrics': {}, 'counters': {}, 'seconds': seconds}
+    for name, pattern in METRIC_PATTERNS:
+        match = pattern.search(output)
+        if match:
+            result['metrics'][name] = float(match.group(1))
+    for name, pattern in COUNTER_PATTERNS:
+        match = pattern.search(output)
+        if match:
+            result['counters'][name] = parse_counters(match.group(1))
+    if not result['metrics']:
+        raise RunError('no ### SCORE, TIME or LATENCY in the output:\n' + output)
+    return result
+
+def supports_counters(binary):
+    # ch builds that predate -PrintRuntimeStatistics reject it, so try it once
+    handle, path = tempfile.mkstemp(suffix='.js')
+    try:
+        os.write(handle, b'WScript.Echo("### TIME: 0 ms");\n')
+        os.close(handle)
+        output = run_ch(binary, ['-PrintRuntimeStatistics'], path, 60)[0]
+        return '### JIT:' in output
+    except RunError:
+        return False
+    finally:
+        os.remove(path)
+
+
+# Statistics
+
+def mean(samples):
+    return sum(samples) / len(samples)
+
+def variance(samples):
+    m = mean(samples)
+    return sum((x - m) ** 2 for x in samples) / (len(samples) - 1)
+
+def incomplete_beta(a, b, x):
+    # Regularized incomplete beta function, by its continued fraction (Numerical Recipes, 6.4)
+    if x <= 0:
+        return 0.0
+    if x >= 1:
+        return 1.0
+    if x > (a + 1) / (a + b + 2):
+        return 1.0 - incomplete_beta(b, a, 1 - x)
+    front = math.exp(math.lgamma(a + b) - math.lgamma(a) - math.lgamma(b) +
+                     a * math.log(x) + b * math.log(1 - x)) / a
+    tiny = 1e-300
+    c, d = 1.0, 1.0 - (a + b) * x / (a + 1)
+    d = 1.0 / (d if abs(d) > tiny else tiny)
+    f = d
+    for m in range(1, 300):
+        for numerator in (m * (b - m) * x / ((a + 2 * m - 1) * (a + 2 * m)),
+                          -(a + m) * (a + b + m) * x / ((a + 2 * m) * (a + 2 * m + 1))):
+            d = 1.0 + numerator * d
+            d = 1.0 / (d if abs(d) > tiny else tiny)
+            c = 1.0 + numerator / c
+            c = c if abs(c) > tiny else tiny
+            f *= c * d
+        if abs(c * d - 1.0) < 1e-12:
+            break
+    return front * f
+
+def t_quantile(p, df):
+    # Quantile of Student's t distribution for p > 0.5, by bisection of its CDF
+    def cdf(t):
+        return 1.0 - 0.5 * incomplete_beta(df / 2.0, 0.5, df / (df + t * t))
+    low, high = 0.0, 1.0
+    while cdf(high) < p:
+        high *= 2
+    for _ in range(100):
+        middle = (low + high) / 2
+        if cdf(middle) < p:
+            low = middle
+        else:
+            high = middle
+    return (low + high) / 2
+
+def summarize(samples):
+    m = mean(samples)
+    s = math.sqrt(variance(samples))
+    half_width = t_quantile((1 + args.confidence) / 2, len(samples) - 1) * s / math.sqrt(len(samples))
+    return {
+        'samples': samples,
+        'mean': m,
+        'stdev': s,
+        'ci': [m - half_width, m + half_width],
+        'ci_percent': 100.0 * half_width / m if m else 0.0
+    }
+
+def compare(base, test, higher_is_better):
+    # Welch's t interval of the difference of the means, relative to the base
+    base_variance = variance(base) / len(base)
+    test_variance = variance(test) / len(test)
+    difference = mean(test) - mean(base)
+    error = math.sqrt(base_variance + test_variance)
+    if error == 0:
+        half_width = 0.0
+    else:
+        df = (base_variance + test_variance) ** 2 / \
+            (base_variance ** 2 / (len(base) - 1) + test_variance ** 2 / (len(test) - 1))
+        half_width = t_quantile((1 + args.confidence) / 2, df) * error
+    scale = 100.0 / mean(base) if mean(base) else 0.0
+    if difference - half_width > 0 or difference + half_width < 0:
+        verdict = 'improved' if (difference > 0) == higher_is_better else 'regressed'
+    else:
+        verdict = 'unchanged'
+    return {
+        'percent': difference * scale,
+        'ci_percent': [(difference - half_width) * scale, (difference + half_width) * scale],
+        'ratio': mean(test) / mean(base) if mean(base) else None,
+        'verdict': verdict
+    }
+
+def summarize_counters(runs):
+    # Mean of each counter over the trials
+    counters = {}
+    for group in sorted(set(g for run in runs for g in run['counters'])):
+        names = set(n for run in runs for n in run['counters'].get(group, {}))
+        counters[group] = dict(
+            (name, mean([run['counters'][group][name] for run in runs
+                         if name in run['counters'].get(group, {})]))
+            for name in sorted(names))
+    return counters
+
+
+# Benchmarks
+
+def select_benchmarks():
+    selected = args.benchmarks or SUITES
+    benchmarks = []
+    for item in selected:
+        suite, _, name = item.lower().partition('/')
+        if suite not in SUITE_FOLDERS:
+            print('ERROR: unknown suite {}, expected one of {}'.format(suite, ', '.join(SUITES)))
+            sys.exit(1)
+        folder = os.path.join(benchmark_root, SUITE_FOLDERS[suite])
+        files = sorted(f for f in os.listdir(folder) if f.endswith('.js'))
+        if name:
+            files = [f for f in files if f.lower() in (name, name + '.js')]
+            if not files:
+                print('ERROR: {} not found in {}'.format(name, folder))
+                sys.exit(1)
+        for f in files:
+            benchmarks.append((suite, f[:-3], os.path.join(folder, f)))
+    return benchmarks
+
+def run_benchmark(suite, name, path, counter_binaries):
+    flags = VARIANTS[args.variant] + args.switches
+    runs = dict((label, []) for label, _ in binaries)
+    print('{}/{}'.format(suite, name), end='')
+    sys.stdout.flush()
+    for i in range(args.warmup + args.trials):
+        # Interleaved, so that a drift of the machine affects both binaries alike
+        for label, binary in binaries:
+            binary_flags = flags + (['-PrintRuntimeStatistics'] if binary in counter_binaries else [])
+            run = parse_run(*run_ch(binary, binary_flags, path, args.timeout))
+            if i >= args.warmup:
+                runs[label].append(run)
+        print('.', end='')
+        sys.stdout.flush()
+    print()
+
+    metrics = sorted(set.intersection(*(set(run['metrics']) for label in runs for run in runs[label])))
+    result = {'suite': suite, 'name': name, 'metrics': {}}
+    for metric in metrics:
+        entry = {'higher_is_better': HIGHER_IS_BETTER[metric]}
+        for label in runs:
+            entry[label] = summarize([run['metrics'][metric] for run in runs[label]])
+        if 'base' in runs:
+            entry['change'] = compare(entry['base']['samples'], entry['test']['samples'],
+                                      HIGHER_IS_BETTER[metric])
+        result['metrics'][metric] = entry
+    result['primary_metric'] = 'score' if 'score' in metrics else metrics[0]
+    result['counters'] = dict((label, summarize_counters(runs[label])) for label in runs)
+    result['seconds'] = dict((label, summarize([run['seconds'] for run in runs[label]])) for label in runs)
+    return result
+
+def geometric_mean(values):
+    return math.exp(sum(math.log(v) for v in values) / len(values)) if values else None
+
+def summarize_suites(results):
+    # Geometric mean of the primary metric of the benchmarks, and of their ratios to the base
+    suites = {}
+    for suite in SUITES:
+        entries = [r['metrics'][r['primary_metric']] for r in results if r['suite'] == suite]
+        if not entries:
+            continue
+        summary = {}
+        for label, _ in binaries:
+            summary[label] = geometric_mean([e[label]['mean'] for e in entries if e[label]['mean'] > 0])
+        if args.base:
+            ratios = [e['change']['ratio'] for e in entries if e['change']['ratio']]
+            summary['ratio'] = geometric_mean(ratios)
+            summary['verdicts'] = dict((v, sum(1 for e in entries if e['change']['verdict'] == v))
+                                       for v in ('improved', 'regressed', 'unchanged'))
+        suites[suite] = summary
+    return suites
+
+def print_results(results, suites):
+    print()
+    if args.base:
+        print('{:<40} {:>8} {:>14} {:>14} {:>20}  {}'.format(
+            'benchmark', 'metric', 'base', 'test', 'change (CI)', ''))
+    else:
+        print('{:<40} {:>8} {:>14} {:>10}'.format('benchmark', 'metric', 'mean', 'CI'))
+    for r in results:
+        metric = r['primary_metric']
+        entry = r['metrics'][metric]
+        name = '{}/{}'.format(r['suite'], r['name'])
+        if args.base:
+            change = entry['change']
+            print('{:<40} {:>8} {:>14.2f} {:>14.2f} {:>+7.2f}% [{:+.2f}, {:+.2f}]  {}'.format(
+                name, metric, entry['base']['mean'], entry['test']['mean'], change['percent'],
+                change['ci_percent'][0], change['ci_percent'][1],
+                change['verdict'].upper() if change['verdict'] != 'unchanged' else ''))
+        else:
+            print('{:<40} {:>8} {:>14.2f} {:>9.2f}%'.format(
+                name, metric, entry['test']['mean'], entry['test']['ci_percent']))
+    print()
+    for suite in sorted(suites):
+        summary = suites[suite]
+        if args.base:
+            print('{:<40} geomean ratio {:.4f} ({} improved, {} regressed)'.format(
+                suite, summary['ratio'], summary['verdicts']['improved'], summary['verdicts']['regressed']))
+        else:
+            print('{:<40} geomean {:.2f}'.format(suite, summary['test']))
+
+def main():
+    benchmarks = select_benchmarks()
+
+    counter_binaries = set()
+    if not args.no_counters:
+        for label, binary in binaries:
+            if supports_counters(binary):
+                counter_binaries.add(binary)
+            else:
+                print('WARNING: {} has no -PrintRuntimeStatistics, its counters are not collected'.format(binary))
+
+    start_time = datetime.now()
+    results = []
+    failed = []
+    for suite, name, path in benchmarks:
+        try:
+            results.append(run_benchmark(suite, name, path, counter_binaries))
+        except RunError as e:
+            print('\nERROR: {}/{}: {}'.format(suite, name, e))
+            failed.append('{}/{}'.format(suite, name))
+    elapsed_time = datetime.now() - start_time
+
+    suites = summarize_suites(results)
+    print_results(results, suites)
+
+    if args.output:
+        report = {
+            'date': start_time.isoformat(),
+            'platform': sys.platform,
+            'binaries': dict(binaries),
+            'variant': args.variant,
+            'switches': args.switches,
+            'warmup': args.warmup,
+            'trials': args.trials,
+            'confidence': args.confidence,
+            'benchmarks': results,
+            'suites': suites,
+            'failed': failed
+        }
+        with open(args.output, 'w') as f:
+            json.dump(report, f, indent=2, sort_keys=True)
+        print('\nReport written to {}'.format(args.output))
+
+    print('\n[{}] {}'.format(str(elapsed_time), 'Success!' if not failed else 'Failed!'))
+    return 1 if failed else 0
+
+if __name__ == '__main__':
+    sys.exit(main())
@@ -819,6 +819,82 @@ var tests = [
             assert.areEqual("test", map.get(key), "1.0 should be equal to the key 1 and map to 'test'");
         }
     },
+
+    {
+        name: "Iterators stay in step while the map grows, shrinks and is cleared underneath them",
+        body: function() {
+            var map = new Map();
+            var i;
+            for (i = 0; i < 10; i++) {
+                map.set(i, i * 10);
+            }
+
+            var iter = map.keys();
+            assert.areEqual(0, iter.next().value, "first key is 0");
+            assert.areEqual(1, iter.next().value, "second key is 1");
+
+            // Delete most of the entries, including the current one, so that the map shrinks,
+            // then add enough new ones that it has to grow again
+            for (i = 0; i < 8; i++) {
+                map.delete(i);
+            }
+            for (i = 100; i < 200; i++) {
+                map.set(i, i * 10);
+            }
+            map.set(9, "nine");
+
+            var seen = [];
+            var result;
+            while (!(result = iter.next()).done) {
+                seen.push(result.value);
+            }
+            assert.areEqual(102, seen.length, "iterator visits every remaining and added key exactly once");
+            assert.areEqual(8, seen[0], "iterator resumes at the first surviving key after its position");
+            assert.areEqual(9, seen[1], "updating an existing key keeps its position");
+            assert.areEqual(100, seen[2], "added keys follow in insertion order");
+            assert.areEqual(199, seen[101], "last added key is visited last");
+            assert.areEqual("nine", map.get(9), "value of an existing key is updated in place");
+
+            var entries = map.entries();
+            entries.next();
+            map.clear();
+            map.set("a", 1);
+            map.set("b", 2);
+            assert.areEqual(["a", 1], entries.next().value, "after clear an iterator continues with newly added entries");
+            assert.areEqual(["b", 2], entries.next().value, "after clear an iterator continues with newly added entries");
+            assert.isTrue(entries.next().done, "iterator is done");
+            map.set("c", 3);
+            assert.isTrue(entries.next().done, "iterator stays done once it has finished");
+        }
+    },
+
+    {
+        name: "Large maps with many deletions keep insertion order and lookups",
+        body: function() {
+            var map = new Map();
+            var count = 50000;
+            var i;
+            for (i = 0; i < count; i++) {
+                map.set("key" + i, i);
+            }
+            for (i = 0; i < count; i += 3) {
+                map.delete("key" + i);
+            }
+            assert.areEqual(count - Math.ceil(count / 3), map.size, "size accounts for deleted keys");
+
+            var expected = 1;
+            var ordered = true;
+            map.forEach(function (value, key) {
+                if (value !== expected || key !== "key" + expected) {
+                    ordered = false;
+                }
+                expected += (expected % 3 === 2) ? 2 : 1;
+            });
+            assert.isTrue(ordered, "forEach visits surviving keys in insertion order");
+            assert.isFalse(map.has("key3"), "deleted key is gone");
+            assert.areEqual(4, map.get("key4"), "surviving key maps to its value");
+        }
+    },
 ];
 
 testRunner.runTests(tests, { verbose: WScript.Arguments[0] != "summary" });
@@ -742,6 +742,33 @@ var tests = [
             assert.isTrue(set.has(value), "1.0 should be equal to the value 1 and set has it");
         }
     },
+
+    {
+        name: "forEach sees values added and skips values deleted while it runs, across resizes",
+        body: function() {
+            var set = new Set([0, 1, 2, 3, 4, 5, 6, 7]);
+            var seen = [];
+
+            set.forEach(function (value) {
+                seen.push(value);
+                if (value === 1) {
+                    // Delete the rest of the original values so the set compacts, then grow it past its original size
+                    for (var i = 2; i < 8; i++) {
+                        set.delete(i);
+                    }
+                    for (var j = 100; j < 120; j++) {
+                        set.add(j);
+                    }
+                }
+            });
+
+            assert.areEqual(22, seen.length, "forEach visits the two original values that survived and every added value");
+            assert.areEqual(0, seen[0], "first value");
+            assert.areEqual(1, seen[1], "second value");
+            assert.areEqual(100, seen[2], "first value added during forEach");
+            assert.areEqual(119, seen[21], "last value added during forEach");
+        }
+    },
 ];
 
 testRunner.runTests(tests, { verbose: WScript.Arguments[0] != "summary" });
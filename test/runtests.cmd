@@ -454,6 +454,8 @@ goto :main
   set _rlArgs=%_Binary%
   set _rlArgs=%_rlArgs% -target:%_BuildArchMapped%
   set _rlArgs=%_rlArgs% -nottags:fail
+  :: Huge page segments are only built on Linux
+  set _rlArgs=%_rlArgs% -nottags:require_huge_pages
   set _rlArgs=%_rlArgs% %_RL_THREAD_FLAGS%
   set _rlArgs=%_rlArgs% %_DIRS%
   set _rlArgs=%_rlArgs% -verbose
@@ -56,6 +56,8 @@ parser.add_argument('--tag', nargs='*',
                     help='select tests with given tags')
 parser.add_argument('--not-tag', nargs='*',
                     help='exclude tests with given tags')
+parser.add_argument('--transparent-huge-pages', action='store_true',
+                    help='include tests that need a build with --transparent-huge-pages')
 parser.add_argument('--timeout', type=int, default=DEFAULT_TIMEOUT,
                     help='test timeout (default ' + str(DEFAULT_TIMEOUT) + ' seconds)')
 parser.add_argument('-l', '--logfile', metavar='logfile', help='file to log results to', default=None)
@@ -117,6 +119,10 @@ elif args.include_slow and args.timeout == DEFAULT_TIMEOUT:
 
 not_tags.add('exclude_nightly' if args.nightly else 'nightly')
 
+# -TransparentHugePages only exists in builds that opted into huge page segments
+if not args.transparent_huge_pages:
+    not_tags.add('require_huge_pages')
+
 # xplat: temp hard coded to exclude unsupported tests
 if sys.platform != 'win32':
     not_tags.add('exclude_xplat')
@@ -0,0 +1,161 @@
+//-------------------------------------------------------------------------------------------------------
+// Copyright (C) Microsoft. All rights reserved.
+// Licensed under the MIT license. See LICENSE.txt file in the project root for full license information.
+//-------------------------------------------------------------------------------------------------------
+
+// Out of bounds accesses to typed arrays and asm.js heaps over buffers with an asm.js compatible length. Where
+// those buffers are virtual (ENABLE_FAST_ARRAYBUFFER), jitted code skips the bounds checks of loads that are
+// converted to numbers and of the asm.js heap accesses. The accesses then fault in the guard region, and the
+// access violation handler completes them: loads produce 0 or NaN, stores are dropped.
+
+var failures = 0;
+
+function check(actual, expected, description) {
+    if (actual !== expected && !(actual !== actual && expected !== expected)) {
+        failures++;
+        WScript.Echo("FAILED " + description + ": " + actual + " !== " + expected);
+    }
+}
+
+var bufferLength = 0x10000;
+var constructors = [Int8Array, Uint8Array, Int16Array, Uint16Array, Int32Array, Uint32Array, Float32Array, Float64Array];
+
+// Indices from the end of the array to deep in the guard region, and past it
+function indicesOf(length) {
+    return [length - 1, length, length + 1, length + 15, length * 2, 0x100000, 0x3FFFFFFF, 0x7FFFFFFF];
+}
+
+function loadInt(array, indices, results) {
+    for (var i = 0; i < indices.length; i++) {
+        results[i] = array[indices[i]] | 0;
+    }
+}
+
+function loadNumber(array, indices, results) {
+    for (var i = 0; i < indices.length; i++) {
+        results[i] = +array[indices[i]];
+    }
+}
+
+function loadValue(array, indices, results) {
+    for (var i = 0; i < indices.length; i++) {
+        results[i] = array[indices[i]];
+    }
+}
+
+function store(array, indices, value) {
+    for (var i = 0; i < indices.length; i++) {
+        array[indices[i]] = value;
+    }
+}
+
+constructors.forEach(function (TypedArray) {
+    var array = new TypedArray(new ArrayBuffer(bufferLength));
+    var length = array.length;
+    var indices = indicesOf(length);
+    var name = TypedArray.name;
+    array[length - 1] = 7;
+
+    // Enough iterations for the loops to be jitted with the array types they see
+    for (var iteration = 0; iteration < 200; iteration++) {
+        var ints = [], numbers = [], values = [];
+        loadInt(array, indices, ints);
+        loadNumber(array, indices, numbers);
+        loadValue(array, indices, values);
+        store(array, indices.slice(1), 9);
+
+        check(ints[0], 7, name + " last element as int");
+        check(numbers[0], 7, name + " last element as number");
+        check(values[0], 7, name + " last element");
+        for (var i = 1; i < indices.length; i++) {
+            check(ints[i], 0, name + "[" + indices[i] + "] as int");
+            check(numbers[i], NaN, name + "[" + indices[i] + "] as number");
+            check(values[i], undefined, name + "[" + indices[i] + "]");
+        }
+    }
+
+    check(array.length, length, name + " length after out of bounds stores");
+    check(array[length - 1], 7, name + " last element after out of bounds stores");
+    check(Object.keys(array).length, length, name + " keys after out of bounds stores");
+});
+
+// An asm.js module over a heap of the same length, with the byte offsets of the accesses as parameters
+function AsmModule(stdlib, foreign, heap) {
+    "use asm";
+
+    var HEAP8 = new stdlib.Int8Array(heap);
+    var HEAP32 = new stdlib.Int32Array(heap);
+    var HEAPF32 = new stdlib.Float32Array(heap);
+    var HEAPF64 = new stdlib.Float64Array(heap);
+
+    function load8(offset) {
+        offset = offset | 0;
+        return HEAP8[offset] | 0;
+    }
+
+    function load32(offset) {
+        offset = offset | 0;
+        return HEAP32[offset >> 2] | 0;
+    }
+
+    function loadF32(offset) {
+        offset = offset | 0;
+        return +HEAPF32[offset >> 2];
+    }
+
+    function loadF64(offset) {
+        offset = offset | 0;
+        return +HEAPF64[offset >> 3];
+    }
+
+    function store8(offset, value) {
+        offset = offset | 0;
+        value = value | 0;
+        HEAP8[offset] = value;
+    }
+
+    function store32(offset, value) {
+        offset = offset | 0;
+        value = value | 0;
+        HEAP32[offset >> 2] = value;
+    }
+
+    function storeF64(offset, value) {
+        offset = offset | 0;
+        value = +value;
+        HEAPF64[offset >> 3] = value;
+    }
+
+    return { load8: load8, load32: load32, loadF32: loadF32, loadF64: loadF64, store8: store8, store32: store32, storeF64: storeF64 };
+}
+
+var heap = new ArrayBuffer(bufferLength);
+var asm = AsmModule(this, {}, heap);
+var bytes = new Int8Array(heap);
+var outOfBoundsOffsets = [bufferLength, bufferLength + 8, bufferLength * 2, 0x100000, 0x7FFFFFF8, -8, -bufferLength];
+
+asm.store32(bufferLength - 4, 0x01020304);
+asm.storeF64(bufferLength - 16, 2.5);
+for (var iteration = 0; iteration < 200; iteration++) {
+    check(asm.load32(bufferLength - 4), 0x01020304, "asm.js last int32");
+    check(asm.loadF64(bufferLength - 16), 2.5, "asm.js last float64");
+    check(asm.load8(bufferLength - 1), 1, "asm.js last int8");
+
+    outOfBoundsOffsets.forEach(function (offset) {
+        check(asm.load8(offset), 0, "asm.js int8 at " + offset);
+        check(asm.load32(offset), 0, "asm.js int32 at " + offset);
+        check(asm.loadF32(offset), NaN, "asm.js float32 at " + offset);
+        check(asm.loadF64(offset), NaN, "asm.js float64 at " + offset);
+        asm.store8(offset, 5);
+        asm.store32(offset, 5);
+        asm.storeF64(offset, 5.5);
+    });
+}
+
+check(asm.load32(bufferLength - 4), 0x01020304, "asm.js last int32 after out of bounds stores");
+check(asm.loadF64(bufferLength - 16), 2.5, "asm.js last float64 after out of bounds stores");
+check(bytes.indexOf(5), -1, "asm.js heap after out of bounds stores");
+
+if (failures === 0) {
+    WScript.Echo("pass");
+}
@@ -0,0 +1,107 @@
+//-------------------------------------------------------------------------------------------------------
+// Copyright (C) Microsoft. All rights reserved.
+// Licensed under the MIT license. See LICENSE.txt file in the project root for full license information.
+//-------------------------------------------------------------------------------------------------------
+
+// Out of bounds accesses to a memory of one page must trap, also where the memory is a virtual buffer and the
+// jitted code leaves the bounds checks to the access violation handler. A trapping store writes nothing.
+
+function leb(value) {
+    var bytes = [];
+    do {
+        var b = value & 0x7F;
+        value >>>= 7;
+        bytes.push(value !== 0 ? b | 0x80 : b);
+    } while (value !== 0);
+    return bytes;
+}
+
+function section(id, entries) {
+    var payload = leb(entries.length);
+    entries.forEach(function (entry) { payload = payload.concat(entry); });
+    return [id].concat(leb(payload.length), payload);
+}
+
+function name(s) {
+    return leb(s.length).concat(s.split("").map(function (c) { return c.charCodeAt(0); }));
+}
+
+function body(code) {
+    var locals = [0];
+    return leb(locals.length + code.length + 1).concat(locals, code, [0x0B]);
+}
+
+var i32 = 0x7F, f64 = 0x7C;
+var getLocal = 0x20, i32Load = 0x28, f64Load = 0x2B, i32Load8U = 0x2D, i32Store = 0x36;
+
+var exports = ["load32", "load8", "loadF64", "load32Offset16", "store32"];
+var binary = [0x00, 0x61, 0x73, 0x6D, 0x0D, 0x00, 0x00, 0x00].concat(
+    section(1, [
+        [0x60, 1, i32, 1, i32],
+        [0x60, 2, i32, i32, 0],
+        [0x60, 1, i32, 1, f64]
+    ]),
+    section(3, [[0], [0], [2], [0], [1]]),
+    section(5, [[1, 1, 1]]),
+    section(7, exports.map(function (exportName, index) { return name(exportName).concat([0, index]); })),
+    section(10, [
+        body([getLocal, 0, i32Load, 2, 0]),
+        body([getLocal, 0, i32Load8U, 0, 0]),
+        body([getLocal, 0, f64Load, 3, 0]),
+        body([getLocal, 0, i32Load, 2, 16]),
+        body([getLocal, 0, getLocal, 1, i32Store, 2, 0])
+    ]));
+
+var instance = new WebAssembly.Instance(new WebAssembly.Module(new Uint8Array(binary).buffer), {});
+var wasm = instance.exports;
+var pageSize = 0x10000;
+var failures = 0;
+
+function check(actual, expected, description) {
+    if (actual !== expected) {
+        failures++;
+        print("FAILED " + description + ": " + actual + " !== " + expected);
+    }
+}
+
+function traps(f, description) {
+    try {
+        f();
+    } catch (e) {
+        return;
+    }
+    failures++;
+    print("FAILED " + description + " didn't trap");
+}
+
+// The addresses are unsigned, -1 is 4GB - 1, and the offset is added to them without wrapping around
+var outOfBounds = {
+    load32: [pageSize - 3, pageSize, pageSize + 4, 0x10000000, 0x7FFFFFFF, -4, -1],
+    load8: [pageSize, pageSize + 1, 0x7FFFFFFF, -1],
+    loadF64: [pageSize - 7, pageSize, 0x7FFFFFF8, -8],
+    load32Offset16: [pageSize - 19, pageSize - 16, 0x7FFFFFF0, -16, -4]
+};
+
+wasm.store32(pageSize - 4, 0x01020304);
+for (var iteration = 0; iteration < 100; iteration++) {
+    check(wasm.load32(pageSize - 4), 0x01020304, "last int32");
+    check(wasm.load8(pageSize - 1), 1, "last byte");
+    check(wasm.loadF64(pageSize - 8) > 0, true, "last float64");
+    check(wasm.load32Offset16(pageSize - 20), 0x01020304, "last int32 at offset 16");
+
+    Object.keys(outOfBounds).forEach(function (exportName) {
+        outOfBounds[exportName].forEach(function (address) {
+            traps(function () { wasm[exportName](address); }, exportName + "(" + address + ")");
+        });
+    });
+
+    [pageSize - 3, pageSize - 1, pageSize, 0x7FFFFFFC, -4].forEach(function (address) {
+        traps(function () { wasm.store32(address, 0x05050505); }, "store32(" + address + ")");
+    });
+}
+
+check(wasm.load32(pageSize - 4), 0x01020304, "last int32 after out of bounds stores");
+
+if (failures === 0) {
+    print("pass");
+}